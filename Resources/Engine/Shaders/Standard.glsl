@@ -4,7 +4,7 @@
 layout (location = 0) in vec3 geo_Pos;
 layout (location = 1) in vec2 geo_TexCoords;
 layout (location = 2) in vec3 geo_Normal;
-layout (location = 3) in vec3 geo_Tangent;
+layout (location = 3) in vec4 geo_Tangent; /* w: Sign of the bitangent */
 layout (location = 4) in vec3 geo_Bitangent;
 
 /* Global information sent by the engine */
@@ -15,8 +15,24 @@ layout (std140) uniform EngineUBO
     mat4    ubo_Projection;
     vec3    ubo_ViewPos;
     float   ubo_Time;
+    mat4    ubo_UserMatrix;
 };
 
+/* Per-instance model matrices sent by the engine when it batches identical drawables */
+layout (std430, binding = 1) buffer InstancesSSBO
+{
+    mat4 ssbo_Instances[];
+};
+
+/* Set by the engine while drawing a batch of instances */
+uniform bool engine_Instanced = false;
+
+/* Model matrix of the drawn instance, use it instead of ubo_Model (A batch shares its user matrix, ubo_UserMatrix stays valid) */
+mat4 GetModelMatrix()
+{
+    return engine_Instanced ? ssbo_Instances[gl_InstanceID] : ubo_Model;
+}
+
 /* Information passed to the fragment shader */
 out VS_OUT
 {
@@ -30,17 +46,22 @@ out VS_OUT
 
 void main()
 {
+    const mat4 modelMatrix = GetModelMatrix();
+
+    /* Compressed vertices don't store the bitangent (The unbound attribute reads as zero), it is rebuilt from the tangent sign */
+    vec3 bitangent = dot(geo_Bitangent, geo_Bitangent) > 0.0 ? geo_Bitangent : cross(geo_Normal, geo_Tangent.xyz) * (geo_Tangent.w < 0.0 ? -1.0 : 1.0);
+
     vs_out.TBN = mat3
     (
-        normalize(vec3(ubo_Model * vec4(geo_Tangent,   0.0))),
-        normalize(vec3(ubo_Model * vec4(geo_Bitangent, 0.0))),
-        normalize(vec3(ubo_Model * vec4(geo_Normal,    0.0)))
+        normalize(vec3(modelMatrix * vec4(geo_Tangent.xyz, 0.0))),
+        normalize(vec3(modelMatrix * vec4(bitangent,       0.0))),
+        normalize(vec3(modelMatrix * vec4(geo_Normal,    0.0)))
     );
 
     mat3 TBNi = transpose(vs_out.TBN);
 
-    vs_out.FragPos          = vec3(ubo_Model * vec4(geo_Pos, 1.0));
-    vs_out.Normal           = normalize(mat3(transpose(inverse(ubo_Model))) * geo_Normal);
+    vs_out.FragPos          = vec3(modelMatrix * vec4(geo_Pos, 1.0));
+    vs_out.Normal           = normalize(mat3(transpose(inverse(modelMatrix))) * geo_Normal);
     vs_out.TexCoords        = geo_TexCoords;
     vs_out.TangentViewPos   = TBNi * ubo_ViewPos;
     vs_out.TangentFragPos   = TBNi * vs_out.FragPos;
@@ -226,8 +247,9 @@ void main()
 
         if (u_EnableNormalMapping)
         {
-            g_Normal = texture(u_NormalMap, g_TexCoords).rgb;
-            g_Normal = normalize(g_Normal * 2.0 - 1.0);   
+            /* Z is rebuilt from X and Y, which also supports two channels (BC5) normal maps */
+            g_Normal.xy = texture(u_NormalMap, g_TexCoords).rg * 2.0 - 1.0;
+            g_Normal.z = sqrt(max(1.0 - dot(g_Normal.xy, g_Normal.xy), 0.0));
             g_Normal = normalize(fs_in.TBN * g_Normal);
         }
         else
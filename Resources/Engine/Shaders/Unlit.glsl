@@ -12,8 +12,24 @@ layout (std140) uniform EngineUBO
     mat4    ubo_Projection;
     vec3    ubo_ViewPos;
     float   ubo_Time;
+    mat4    ubo_UserMatrix;
 };
 
+/* Per-instance model matrices sent by the engine when it batches identical drawables */
+layout (std430, binding = 1) buffer InstancesSSBO
+{
+    mat4 ssbo_Instances[];
+};
+
+/* Set by the engine while drawing a batch of instances */
+uniform bool engine_Instanced = false;
+
+/* Model matrix of the drawn instance, use it instead of ubo_Model (A batch shares its user matrix, ubo_UserMatrix stays valid) */
+mat4 GetModelMatrix()
+{
+    return engine_Instanced ? ssbo_Instances[gl_InstanceID] : ubo_Model;
+}
+
 out VS_OUT
 {
     vec2 TexCoords;
@@ -21,9 +37,11 @@ out VS_OUT
 
 void main()
 {
+    const mat4 modelMatrix = GetModelMatrix();
+
     vs_out.TexCoords = geo_TexCoords;
 
-    gl_Position = ubo_Projection * ubo_View * ubo_Model * vec4(geo_Pos, 1.0);
+    gl_Position = ubo_Projection * ubo_View * modelMatrix * vec4(geo_Pos, 1.0);
 }
 
 #shader fragment
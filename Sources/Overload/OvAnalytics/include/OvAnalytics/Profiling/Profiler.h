@@ -9,21 +9,28 @@
 #include <unordered_map>
 #include <chrono>
 #include <mutex>
-
+#include <atomic>
+#include <limits>
 
 #include "OvAnalytics/Profiling/ProfilerReport.h"
 
 namespace OvAnalytics::Profiling
 {
-	/* Forward declaration of the profiler spy structure */
-	struct ProfilerSpy;
-
 	/**
-	* The profiler collect data about the running program
+	* The profiler collect data about the running program.
+	* Spies write their samples into a lock-free buffer owned by their thread, a background thread
+	* aggregates them while the profiler is enabled. Recording a sample never locks nor allocates
 	*/
 	class Profiler final
 	{
 	public:
+		/**
+		* Identifier of an interned scope name
+		*/
+		using ScopeID = uint32_t;
+
+		static constexpr ScopeID NO_SCOPE = std::numeric_limits<ScopeID>::max();
+
 		/**
 		* Create the profiler
 		*/
@@ -46,10 +53,31 @@ namespace OvAnalytics::Profiling
 		void Update(float p_deltaTime);
 
 		/**
-		* Save the given spy collected data to the profiler history
-		* @param p_spy (Spy to collect data from)
+		* Returns the identifier of the given scope name, registering it on the first call (Locks, should be cached)
+		* @param p_name
 		*/
-		static void Save(ProfilerSpy& p_spy);
+		static ScopeID RegisterScope(const std::string& p_name);
+
+		/**
+		* Make the given scope the current scope of the calling thread and return the previous one (Its parent)
+		* @param p_scope
+		*/
+		static ScopeID EnterScope(ScopeID p_scope);
+
+		/**
+		* Record a sample of the given scope and restore its parent as the current scope of the calling thread
+		* @param p_scope
+		* @param p_parent
+		* @param p_start
+		* @param p_end
+		*/
+		static void LeaveScope(ScopeID p_scope, ScopeID p_parent, std::chrono::steady_clock::time_point p_start, std::chrono::steady_clock::time_point p_end);
+
+		/**
+		* Move the samples recorded by every thread into the history.
+		* Called periodically by a background thread while the profiler is enabled, and before generating a report
+		*/
+		static void Collect();
 
 		/**
 		* Verify if the profiler is currently enabled
@@ -72,17 +100,25 @@ namespace OvAnalytics::Profiling
 		static void Disable();
 
 	private:
+		/**
+		* Aggregated samples of a scope called from a given parent scope
+		*/
+		struct ScopeHistory
+		{
+			std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::duration::zero();
+			uint64_t calls = 0;
+		};
+
 		/* Time relatives */
 		std::chrono::steady_clock::time_point m_lastTime;
 
 		/* Profiler settings */
-		static bool __ENABLED;
-
-		/* Collected data */
-		static std::mutex									__SAVE_MUTEX;
-		static std::unordered_map<std::string, double>		__ELPASED_HISTORY;
-		static std::unordered_map<std::string, uint64_t>	__CALLS_COUNTER;
-		static std::vector<std::thread::id>					__WORKING_THREADS;
-		static uint32_t										__ELAPSED_FRAMES;
+		static std::atomic<bool> __ENABLED;
+
+		/* Collected data, keyed by parent and scope identifiers */
+		static std::mutex											__COLLECT_MUTEX;
+		static std::unordered_map<uint64_t, ScopeHistory>			__SCOPES_HISTORY;
+		static uint16_t												__WORKING_THREADS;
+		static uint32_t												__ELAPSED_FRAMES;
 	};
 }
\ No newline at end of file
@@ -7,7 +7,7 @@
 #pragma once
 
 #include <vector>
-
+#include <string>
 
 namespace OvAnalytics::Profiling
 {
@@ -17,11 +17,12 @@ namespace OvAnalytics::Profiling
 	struct ProfilerReport final
 	{
 		/**
-		* Data about an action (Called method)
+		* Data about an action (Called method). An action called from different parent scopes is reported once per parent
 		*/
 		struct Action final
 		{
 			std::string name;
+			std::string parent;
 			double duration;
 			double percentage;
 			uint64_t calls;
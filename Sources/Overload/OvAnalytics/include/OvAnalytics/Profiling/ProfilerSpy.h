@@ -9,18 +9,17 @@
 #include <string>
 #include <chrono>
 
-
 #include "OvAnalytics/Profiling/Profiler.h"
-#include "OvAnalytics/Profiling/ProfilerSpy.h"
 
 /**
 * This macro allow the creation of profiler spies
 * Any spy will die and send data to the profiler at
-* the end of the scope where this macro get called
+* the end of the scope where this macro get called.
+* The name is interned once per call site, the spy itself lives on the stack
 */
 #define PROFILER_SPY(name)\
-		std::unique_ptr<OvAnalytics::Profiling::ProfilerSpy> __profiler_spy__ = \
-		OvAnalytics::Profiling::Profiler::IsEnabled() ? std::make_unique<OvAnalytics::Profiling::ProfilerSpy>(name) : nullptr
+		static const OvAnalytics::Profiling::Profiler::ScopeID __profiler_scope__ = OvAnalytics::Profiling::Profiler::RegisterScope(name); \
+		const OvAnalytics::Profiling::ProfilerSpy __profiler_spy__(__profiler_scope__)
 
 namespace OvAnalytics::Profiling
 {
@@ -32,10 +31,10 @@ namespace OvAnalytics::Profiling
 	struct ProfilerSpy final
 	{
 		/**
-		* Create the profiler spy with the given name.
-		* @param p_name
+		* Create the profiler spy for the given scope
+		* @param p_scope
 		*/
-		ProfilerSpy(const std::string& p_name);
+		ProfilerSpy(Profiler::ScopeID p_scope);
 
 		/**
 		* Destroy the profiler spy.
@@ -43,8 +42,12 @@ namespace OvAnalytics::Profiling
 		*/
 		~ProfilerSpy();
 
-		const	std::string								name;
-		const	std::chrono::steady_clock::time_point	start;
-				std::chrono::steady_clock::time_point	end;
+		ProfilerSpy(const ProfilerSpy&) = delete;
+		ProfilerSpy& operator=(const ProfilerSpy&) = delete;
+
+		const	Profiler::ScopeID						scope;
+		const	bool									recording;
+				Profiler::ScopeID						parent = Profiler::NO_SCOPE;
+				std::chrono::steady_clock::time_point	start;
 	};
 }
\ No newline at end of file
@@ -4,25 +4,194 @@
 * @licence: MIT
 */
 
-#include <iostream>
-#include <iomanip>
-#include <map>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <memory>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "OvAnalytics/Profiling/Profiler.h"
 #include "OvAnalytics/Profiling/ProfilerSpy.h"
 
-bool											OvAnalytics::Profiling::Profiler::__ENABLED;
-std::mutex										OvAnalytics::Profiling::Profiler::__SAVE_MUTEX;
-std::unordered_map<std::string, double>			OvAnalytics::Profiling::Profiler::__ELPASED_HISTORY;
-std::unordered_map<std::string, uint64_t>		OvAnalytics::Profiling::Profiler::__CALLS_COUNTER;
-std::vector<std::thread::id>					OvAnalytics::Profiling::Profiler::__WORKING_THREADS;
-uint32_t										OvAnalytics::Profiling::Profiler::__ELAPSED_FRAMES;
+namespace
+{
+	using ScopeID = OvAnalytics::Profiling::Profiler::ScopeID;
+
+	/* A finished spy, as written by the thread that owned it */
+	struct Sample
+	{
+		ScopeID scope;
+		ScopeID parent;
+		std::chrono::steady_clock::time_point start;
+		std::chrono::steady_clock::time_point end;
+	};
+
+	/*
+	* Single producer (The owning thread), single consumer (The collector) ring of samples.
+	* Samples recorded while the ring is full are dropped rather than blocking the producer
+	*/
+	struct ThreadBuffer
+	{
+		static constexpr uint64_t CAPACITY = 8192;
+
+		bool Push(const Sample& p_sample)
+		{
+			const uint64_t head = m_head.load(std::memory_order_relaxed);
+
+			if (head - m_tail.load(std::memory_order_acquire) == CAPACITY)
+			{
+				dropped.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			m_samples[head & (CAPACITY - 1)] = p_sample;
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		template<typename Consumer>
+		size_t Drain(Consumer p_consumer)
+		{
+			const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+			const uint64_t head = m_head.load(std::memory_order_acquire);
+
+			for (uint64_t i = tail; i < head; ++i)
+				p_consumer(m_samples[i & (CAPACITY - 1)]);
+
+			m_tail.store(head, std::memory_order_release);
+			return static_cast<size_t>(head - tail);
+		}
+
+		std::atomic<bool> owned = false;
+		std::atomic<uint64_t> dropped = 0;
+
+	private:
+		std::array<Sample, CAPACITY> m_samples;
+		alignas(64) std::atomic<uint64_t> m_head = 0;
+		alignas(64) std::atomic<uint64_t> m_tail = 0;
+	};
+
+	/* Thread buffers are never freed, a buffer released by a finished thread is reused by the next one */
+	std::mutex									g_buffersMutex;
+	std::vector<std::unique_ptr<ThreadBuffer>>	g_buffers;
+
+	/* Interned scope names */
+	std::mutex									g_scopesMutex;
+	std::unordered_map<std::string, ScopeID>	g_scopesIDs;
+	std::vector<std::string>					g_scopesNames;
+
+	ThreadBuffer* AcquireThreadBuffer()
+	{
+		std::unique_lock lock(g_buffersMutex);
+
+		for (auto& buffer : g_buffers)
+			if (!buffer->owned.exchange(true, std::memory_order_acquire))
+				return buffer.get();
+
+		g_buffers.push_back(std::make_unique<ThreadBuffer>());
+		g_buffers.back()->owned.store(true, std::memory_order_release);
+		return g_buffers.back().get();
+	}
+
+	/* Gives its buffer back when the owning thread exits */
+	struct ThreadBufferHandle
+	{
+		~ThreadBufferHandle()
+		{
+			if (buffer)
+				buffer->owned.store(false, std::memory_order_release);
+		}
+
+		ThreadBuffer* buffer = nullptr;
+	};
+
+	thread_local ThreadBufferHandle	t_bufferHandle;
+	thread_local ScopeID			t_currentScope = OvAnalytics::Profiling::Profiler::NO_SCOPE;
+
+	/* Background thread draining the thread buffers while the profiler is enabled */
+	class Collector
+	{
+	public:
+		static constexpr std::chrono::milliseconds PERIOD { 10 };
+
+		~Collector()
+		{
+			Stop();
+		}
+
+		void Start()
+		{
+			std::unique_lock lock(m_mutex);
+
+			if (m_thread.joinable())
+				return;
+
+			m_stopRequested = false;
+			m_thread = std::thread([this]
+			{
+				std::unique_lock lock(m_mutex);
+
+				while (!m_stopRequested)
+				{
+					m_condition.wait_for(lock, PERIOD, [this] { return m_stopRequested; });
+
+					lock.unlock();
+					OvAnalytics::Profiling::Profiler::Collect();
+					lock.lock();
+				}
+			});
+		}
+
+		void Stop()
+		{
+			std::thread thread;
+
+			{
+				std::unique_lock lock(m_mutex);
+				m_stopRequested = true;
+				thread = std::move(m_thread);
+			}
+
+			m_condition.notify_all();
+
+			if (thread.joinable())
+				thread.join();
+		}
+
+	private:
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::thread m_thread;
+		bool m_stopRequested = false;
+	};
+
+	std::unordered_set<ThreadBuffer*> g_workingBuffers;
+
+	uint64_t MakeHistoryKey(ScopeID p_parent, ScopeID p_scope)
+	{
+		return (static_cast<uint64_t>(p_parent) << 32) | p_scope;
+	}
+}
+
+std::atomic<bool>																OvAnalytics::Profiling::Profiler::__ENABLED = false;
+std::mutex																		OvAnalytics::Profiling::Profiler::__COLLECT_MUTEX;
+std::unordered_map<uint64_t, OvAnalytics::Profiling::Profiler::ScopeHistory>	OvAnalytics::Profiling::Profiler::__SCOPES_HISTORY;
+uint16_t																		OvAnalytics::Profiling::Profiler::__WORKING_THREADS;
+uint32_t																		OvAnalytics::Profiling::Profiler::__ELAPSED_FRAMES;
+
+namespace
+{
+	/* Defined after the history so that it is destroyed (And joined) before it */
+	Collector g_collector;
+}
 
 OvAnalytics::Profiling::Profiler::Profiler()
 {
-	m_lastTime = std::chrono::high_resolution_clock::now();
-	__ENABLED = false;
+	m_lastTime = std::chrono::steady_clock::now();
+	Disable();
 }
 
 OvAnalytics::Profiling::ProfilerReport OvAnalytics::Profiling::Profiler::GenerateReport()
@@ -32,33 +201,53 @@ OvAnalytics::Profiling::ProfilerReport OvAnalytics::Profiling::Profiler::Generat
 	if (__ELAPSED_FRAMES == 0)
 		return report;
 
-	std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - m_lastTime;
+	Collect();
+
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_lastTime;
 
-	report.workingThreads = static_cast<uint16_t>((__WORKING_THREADS.size() - 1) / __ELAPSED_FRAMES);
 	report.elapsedFrames = __ELAPSED_FRAMES;
 	report.elaspedTime = elapsed.count();
 
-	std::multimap<double, std::string, std::greater<double>> sortedHistory;
+	{
+		std::unique_lock collectLock(__COLLECT_MUTEX);
+		std::unique_lock scopesLock(g_scopesMutex);
+
+		report.workingThreads = __WORKING_THREADS;
+		report.actions.reserve(__SCOPES_HISTORY.size());
 
-	/* Fill the sorted history with the current history (Auto sort) */
-	for (auto& data : __ELPASED_HISTORY)
-		sortedHistory.insert(std::pair<double, std::string>(data.second, data.first));
+		for (auto& [key, history] : __SCOPES_HISTORY)
+		{
+			const ScopeID parent = static_cast<ScopeID>(key >> 32);
+			const ScopeID scope = static_cast<ScopeID>(key & 0xFFFFFFFF);
+			const double duration = std::chrono::duration<double>(history.elapsed).count();
 
-	/* Add every actions to the report */
-	for (auto& data : sortedHistory)
-		report.actions.push_back({ data.second, data.first, (data.first / elapsed.count()) * 100.0, __CALLS_COUNTER[data.second] });
+			report.actions.push_back({ g_scopesNames[scope], parent != NO_SCOPE ? g_scopesNames[parent] : std::string(), duration, (duration / elapsed.count()) * 100.0, history.calls });
+		}
+	}
+
+	std::sort(report.actions.begin(), report.actions.end(), [](const ProfilerReport::Action& p_left, const ProfilerReport::Action& p_right)
+	{
+		return p_left.duration > p_right.duration;
+	});
 
 	return report;
 }
 
 void OvAnalytics::Profiling::Profiler::ClearHistory()
 {
-	__ELPASED_HISTORY.clear();
-	__CALLS_COUNTER.clear();
-	__WORKING_THREADS.clear();
+	/* Samples recorded before the clear are discarded with the history */
+	Collect();
+
+	{
+		std::unique_lock lock(__COLLECT_MUTEX);
+		__SCOPES_HISTORY.clear();
+		g_workingBuffers.clear();
+		__WORKING_THREADS = 0;
+	}
+
 	__ELAPSED_FRAMES = 0;
 
-	m_lastTime = std::chrono::high_resolution_clock::now();
+	m_lastTime = std::chrono::steady_clock::now();
 }
 
 void OvAnalytics::Profiling::Profiler::Update(float p_deltaTime)
@@ -69,51 +258,86 @@ void OvAnalytics::Profiling::Profiler::Update(float p_deltaTime)
 	}
 }
 
-void OvAnalytics::Profiling::Profiler::Save(OvAnalytics::Profiling::ProfilerSpy& p_spy)
+OvAnalytics::Profiling::Profiler::ScopeID OvAnalytics::Profiling::Profiler::RegisterScope(const std::string& p_name)
 {
-	__SAVE_MUTEX.lock();
+	std::unique_lock lock(g_scopesMutex);
 
-	/* Check if this thread is already registered */
-	if (std::find(__WORKING_THREADS.begin(), __WORKING_THREADS.end(), std::this_thread::get_id()) == __WORKING_THREADS.end())
-		__WORKING_THREADS.push_back(std::this_thread::get_id());
+	if (auto found = g_scopesIDs.find(p_name); found != g_scopesIDs.end())
+		return found->second;
 
-	if (__ELPASED_HISTORY.find(p_spy.name) != __ELPASED_HISTORY.end())
-	{
-		__ELPASED_HISTORY[p_spy.name] += std::chrono::duration<double>(p_spy.end - p_spy.start).count();
-	}
-	else
-	{
-		__ELPASED_HISTORY[p_spy.name] = std::chrono::duration<double>(p_spy.end - p_spy.start).count();
-	}
+	const ScopeID id = static_cast<ScopeID>(g_scopesNames.size());
+	g_scopesIDs.emplace(p_name, id);
+	g_scopesNames.push_back(p_name);
+	return id;
+}
+
+OvAnalytics::Profiling::Profiler::ScopeID OvAnalytics::Profiling::Profiler::EnterScope(ScopeID p_scope)
+{
+	const ScopeID parent = t_currentScope;
+	t_currentScope = p_scope;
+	return parent;
+}
+
+void OvAnalytics::Profiling::Profiler::LeaveScope(ScopeID p_scope, ScopeID p_parent, std::chrono::steady_clock::time_point p_start, std::chrono::steady_clock::time_point p_end)
+{
+	t_currentScope = p_parent;
+
+	if (!t_bufferHandle.buffer)
+		t_bufferHandle.buffer = AcquireThreadBuffer();
+
+	t_bufferHandle.buffer->Push({ p_scope, p_parent, p_start, p_end });
+}
+
+void OvAnalytics::Profiling::Profiler::Collect()
+{
+	std::vector<ThreadBuffer*> buffers;
 
-	if (__CALLS_COUNTER.find(p_spy.name) != __CALLS_COUNTER.end())
 	{
-		++__CALLS_COUNTER[p_spy.name];
+		std::unique_lock lock(g_buffersMutex);
+		buffers.reserve(g_buffers.size());
+		for (auto& buffer : g_buffers)
+			buffers.push_back(buffer.get());
 	}
-	else
+
+	std::unique_lock lock(__COLLECT_MUTEX);
+
+	for (auto buffer : buffers)
 	{
-		__CALLS_COUNTER[p_spy.name] = 1;
+		const size_t collected = buffer->Drain([](const Sample& p_sample)
+		{
+			auto& history = __SCOPES_HISTORY[MakeHistoryKey(p_sample.parent, p_sample.scope)];
+			history.elapsed += p_sample.end - p_sample.start;
+			++history.calls;
+		});
+
+		if (collected > 0)
+			g_workingBuffers.insert(buffer);
 	}
 
-	__SAVE_MUTEX.unlock();
+	__WORKING_THREADS = static_cast<uint16_t>(g_workingBuffers.size());
 }
 
 bool OvAnalytics::Profiling::Profiler::IsEnabled()
 {
-	return __ENABLED;
+	return __ENABLED.load(std::memory_order_relaxed);
 }
 
 void OvAnalytics::Profiling::Profiler::ToggleEnable()
 {
-	__ENABLED = !__ENABLED;
+	if (IsEnabled())
+		Disable();
+	else
+		Enable();
 }
 
 void OvAnalytics::Profiling::Profiler::Enable()
 {
 	__ENABLED = true;
+	g_collector.Start();
 }
 
 void OvAnalytics::Profiling::Profiler::Disable()
 {
 	__ENABLED = false;
+	g_collector.Stop();
 }
\ No newline at end of file
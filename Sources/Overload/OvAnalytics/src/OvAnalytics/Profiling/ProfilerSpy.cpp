@@ -7,15 +7,19 @@
 #include "OvAnalytics/Profiling/ProfilerSpy.h"
 #include "OvAnalytics/Profiling/Profiler.h"
 
-OvAnalytics::Profiling::ProfilerSpy::ProfilerSpy(const std::string & p_name) :
-	name(p_name),
-	start(std::chrono::steady_clock::now())
+OvAnalytics::Profiling::ProfilerSpy::ProfilerSpy(Profiler::ScopeID p_scope) :
+	scope(p_scope),
+	recording(Profiler::IsEnabled())
 {
-
+	if (recording)
+	{
+		parent = Profiler::EnterScope(scope);
+		start = std::chrono::steady_clock::now();
+	}
 }
 
 OvAnalytics::Profiling::ProfilerSpy::~ProfilerSpy()
 {
-	end = std::chrono::steady_clock::now();
-	OvAnalytics::Profiling::Profiler::Save(*this);
+	if (recording)
+		Profiler::LeaveScope(scope, parent, start, std::chrono::steady_clock::now());
 }
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace OvBenchmark
+{
+	/**
+	* Timing and reporting helpers shared by the benchmarks
+	*/
+	class Benchmark
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		Benchmark() = delete;
+
+		/**
+		* Returns the average duration in milliseconds of the given callable. It is called once to warm up, then
+		* the given number of times
+		* @param p_iterations
+		* @param p_callable
+		*/
+		template<typename Callable>
+		static double Measure(uint32_t p_iterations, Callable p_callable);
+
+		/**
+		* Print the title of a benchmark
+		* @param p_title
+		*/
+		static void Title(const std::string& p_title);
+
+		/**
+		* Print a measured duration
+		* @param p_name
+		* @param p_milliseconds
+		*/
+		static void Report(const std::string& p_name, double p_milliseconds);
+
+		/**
+		* Print a measured value
+		* @param p_name
+		* @param p_value
+		*/
+		static void Report(const std::string& p_name, const std::string& p_value);
+	};
+}
+
+#include "OvBenchmark/Benchmark.inl"
\ No newline at end of file
@@ -0,0 +1,28 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <chrono>
+
+#include "OvBenchmark/Benchmark.h"
+
+namespace OvBenchmark
+{
+	template<typename Callable>
+	inline double Benchmark::Measure(uint32_t p_iterations, Callable p_callable)
+	{
+		p_callable();
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for (uint32_t i = 0; i < p_iterations; ++i)
+			p_callable();
+
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / p_iterations;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+namespace OvBenchmark
+{
+	/**
+	* Compare the per model renderer sphere test with the SIMD culling of a sphere array, on its own and after
+	* a query of the bounding volume tree (The path used by scenes with many model renderers)
+	*/
+	void RunCullingBenchmark();
+
+	/**
+	* Compare the memory taken by the standard and compressed vertex formats, and the time taken to convert meshes to them
+	*/
+	void RunVertexFormatBenchmark();
+
+	/**
+	* Compare the engine callbacks of 10k scripted actors when the hook is looked up by name on each call,
+	* and when it is resolved once and skipped for the scripts that don't implement it
+	*/
+	void RunLuaHooksBenchmark();
+
+	/**
+	* Compare the Lua maths operators with the in-place and bulk methods, in operations per second and in garbage
+	* allocated per run
+	*/
+	void RunLuaMathsBenchmark();
+}
\ No newline at end of file
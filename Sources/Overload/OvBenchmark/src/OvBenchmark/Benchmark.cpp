@@ -0,0 +1,24 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstdio>
+
+#include "OvBenchmark/Benchmark.h"
+
+void OvBenchmark::Benchmark::Title(const std::string& p_title)
+{
+	std::printf("\n%s\n", p_title.c_str());
+}
+
+void OvBenchmark::Benchmark::Report(const std::string& p_name, double p_milliseconds)
+{
+	std::printf("  %-48s %10.3f ms\n", p_name.c_str(), p_milliseconds);
+}
+
+void OvBenchmark::Benchmark::Report(const std::string& p_name, const std::string& p_value)
+{
+	std::printf("  %-48s %13s\n", p_name.c_str(), p_value.c_str());
+}
\ No newline at end of file
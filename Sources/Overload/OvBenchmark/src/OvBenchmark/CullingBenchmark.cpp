@@ -0,0 +1,107 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <random>
+#include <vector>
+
+#include <OvMaths/FTransform.h>
+
+#include <OvRendering/Data/Frustum.h>
+#include <OvRendering/Geometry/BoundingSphereArray.h>
+#include <OvRendering/Geometry/DynamicAABBTree.h>
+
+#include "OvBenchmark/Benchmark.h"
+#include "OvBenchmark/Benchmarks.h"
+
+void OvBenchmark::RunCullingBenchmark()
+{
+	using namespace OvRendering::Geometry;
+
+	OvRendering::Data::Frustum frustum;
+	frustum.CalculateFrustum
+	(
+		OvMaths::FMatrix4::CreatePerspective(60.0f, 16.0f / 9.0f, 0.1f, 500.0f) *
+		OvMaths::FMatrix4::CreateView(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -1.0f, 0.0f, 1.0f, 0.0f)
+	);
+
+	/* Model renderers spread around the camera: a dense scene (About a quarter visible) and a sparse one (About 1% visible) */
+	for (const float extent : { 500.0f, 5000.0f })
+	for (const uint32_t count : { 10000u, 100000u, 1000000u })
+	{
+		std::mt19937 generator(42);
+		std::uniform_real_distribution<float> position(-extent, extent);
+		std::uniform_real_distribution<float> radius(0.5f, 2.0f);
+
+		const BoundingSphere modelSphere = { { 0.0f, 0.0f, 0.0f }, 1.0f };
+		std::vector<OvMaths::FTransform> transforms(count);
+		BoundingSphereArray spheres;
+		DynamicAABBTree tree;
+
+		spheres.Resize(count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			const OvMaths::FVector3 center(position(generator), position(generator) * 100.0f / extent, position(generator));
+			const float scale = radius(generator);
+
+			transforms[i].GenerateMatricesLocal(center, OvMaths::FQuaternion::Identity, { scale, scale, scale });
+			spheres.Set(i, center, scale);
+			tree.CreateProxy({ center - OvMaths::FVector3(scale, scale, scale), center + OvMaths::FVector3(scale, scale, scale) }, i);
+		}
+
+		/* The transforms are resolved up front, like the scene does before rendering */
+		for (auto& transform : transforms)
+			transform.GetWorldScale();
+
+		std::vector<uint32_t> visible;
+		std::vector<uint32_t> candidates;
+		std::vector<uint32_t> visibleCandidates;
+		BoundingSphereArray candidateSpheres;
+		size_t visibleCount = 0;
+
+		const uint32_t iterations = count >= 1000000 ? 5 : 50;
+
+		const double perModel = Benchmark::Measure(iterations, [&]
+		{
+			visible.clear();
+
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				if (frustum.BoundingSphereInFrustum(modelSphere, transforms[i]))
+					visible.push_back(i);
+			}
+		});
+
+		visibleCount = visible.size();
+
+		const double array = Benchmark::Measure(iterations, [&]
+		{
+			frustum.SpheresInFrustum(spheres, visible);
+		});
+
+		const double treeAndArray = Benchmark::Measure(iterations, [&]
+		{
+			candidates.clear();
+			tree.QueryFrustum(frustum, candidates);
+
+			candidateSpheres.Resize(candidates.size());
+
+			for (size_t i = 0; i < candidates.size(); ++i)
+			{
+				const uint32_t index = candidates[i];
+				candidateSpheres.Set(i, { spheres.GetX()[index], spheres.GetY()[index], spheres.GetZ()[index] }, spheres.GetRadii()[index]);
+			}
+
+			frustum.SpheresInFrustum(candidateSpheres, visibleCandidates);
+		});
+
+		Benchmark::Title("Culling, " + std::to_string(count) + " spheres in " + std::to_string(static_cast<int>(extent) * 2) + " units, " + std::to_string(visibleCount) + " visible");
+		Benchmark::Report("BoundingSphereInFrustum per model renderer", perModel);
+		Benchmark::Report("SpheresInFrustum over the whole array", array);
+		Benchmark::Report("Tree query, then SpheresInFrustum on candidates", treeAndArray);
+		Benchmark::Report("Visible (Array / Tree)", std::to_string(visible.size()) + " / " + std::to_string(visibleCandidates.size()));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <memory>
+#include <vector>
+
+#include <sol.hpp>
+
+#include <OvCore/ECS/Actor.h>
+
+#include "OvBenchmark/Benchmark.h"
+#include "OvBenchmark/Benchmarks.h"
+
+namespace
+{
+	/* Each run of a chunk returns a new table, like a behaviour script */
+	const char* kUpdatedScript =
+		"local Behaviour = { elapsed = 0 }\n"
+		"function Behaviour:OnUpdate(deltaTime) self.elapsed = self.elapsed + deltaTime end\n"
+		"return Behaviour";
+
+	const char* kIdleScript =
+		"local Behaviour = { started = false }\n"
+		"function Behaviour:OnStart() self.started = true end\n"
+		"return Behaviour";
+}
+
+void OvBenchmark::RunLuaHooksBenchmark()
+{
+	using namespace OvCore::ECS;
+
+	constexpr uint32_t kActorCount = 10000;
+	constexpr float kDeltaTime = 1.0f / 60.0f;
+
+	sol::state luaState;
+	luaState.open_libraries(sol::lib::base, sol::lib::math);
+
+	bool playing = true;
+
+	/* A scene with scripts that implement OnUpdate, and one with scripts that don't */
+	for (const char* source : { kUpdatedScript, kIdleScript })
+	{
+		sol::protected_function script = luaState.load(source).get<sol::protected_function>();
+
+		std::vector<std::unique_ptr<Actor>> actors;
+		std::vector<Components::Behaviour*> behaviours;
+
+		for (uint32_t i = 0; i < kActorCount; ++i)
+		{
+			auto& actor = actors.emplace_back(std::make_unique<Actor>(i, "Actor", "", playing));
+			auto& behaviour = actor->AddBehaviour("Behaviour");
+			behaviour.RegisterToLuaContext(script);
+			behaviours.push_back(&behaviour);
+		}
+
+		/* The lookup by name done by every engine callback before the hooks were cached */
+		const double byName = Benchmark::Measure(100, [&]
+		{
+			for (auto behaviour : behaviours)
+				behaviour->LuaCall("OnUpdate", kDeltaTime);
+		});
+
+		/* What Scene::UpdateActors does now */
+		const double cached = Benchmark::Measure(100, [&]
+		{
+			for (auto behaviour : behaviours)
+			{
+				if (behaviour->HasHook(Components::Behaviour::EHook::UPDATE))
+					behaviour->OnUpdate(kDeltaTime);
+			}
+		});
+
+		const bool hasUpdate = behaviours.front()->HasHook(Components::Behaviour::EHook::UPDATE);
+
+		Benchmark::Title("Lua hooks, " + std::to_string(kActorCount) + " scripted actors " + (hasUpdate ? "with" : "without") + " OnUpdate");
+		Benchmark::Report("OnUpdate looked up by name (LuaCall)", byName);
+		Benchmark::Report("Cached OnUpdate, skipped if missing", cached);
+		Benchmark::Report("Lua memory", std::to_string(luaState.memory_used() / 1024) + " KB");
+
+		behaviours.clear();
+		actors.clear();
+		luaState.collect_garbage();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstdio>
+#include <vector>
+
+#include <sol.hpp>
+
+#include <OvCore/Scripting/LuaMathsBinder.h>
+
+#include "OvBenchmark/Benchmark.h"
+#include "OvBenchmark/Benchmarks.h"
+
+namespace
+{
+	/* Each pair of functions does the same maths, with the operators then with the in-place or bulk methods */
+	const char* kScript = R"(
+		function MoveWithOperators(count)
+			local position = Vector3.new(0, 0, 0)
+			local velocity = Vector3.new(1, 2, 3)
+			for i = 1, count do position = position + velocity * 0.016 end
+			return position
+		end
+
+		function MoveInPlace(count)
+			local position = Vector3.new(0, 0, 0)
+			local velocity = Vector3.new(1, 2, 3)
+			for i = 1, count do position:AddScaledInPlace(velocity, 0.016) end
+			return position
+		end
+
+		function RotateWithOperators(count)
+			local rotation = Quaternion.new(0, 0, 0, 1)
+			local delta = Quaternion.new(0, 0.0087, 0, 0.99996)
+			for i = 1, count do rotation = rotation * delta end
+			return rotation
+		end
+
+		function RotateInPlace(count)
+			local rotation = Quaternion.new(0, 0, 0, 1)
+			local delta = Quaternion.new(0, 0.0087, 0, 0.99996)
+			for i = 1, count do rotation:MultiplyInPlace(delta) end
+			return rotation
+		end
+
+		points = {}
+		for i = 1, 1000 do points[i] = Vector3.new(i, i, i) end
+
+		function OffsetWithOperators(count)
+			local offset = Vector3.new(0, 1, 0)
+			for pass = 1, count // #points do
+				for i = 1, #points do points[i] = points[i] + offset end
+			end
+		end
+
+		function OffsetInBulk(count)
+			local offset = Vector3.new(0, 1, 0)
+			for pass = 1, count // #points do Vector3.AddToAll(points, offset) end
+		end
+	)";
+
+	std::string Format(const char* p_format, double p_value)
+	{
+		char result[32];
+		std::snprintf(result, sizeof(result), p_format, p_value);
+		return result;
+	}
+}
+
+void OvBenchmark::RunLuaMathsBenchmark()
+{
+	constexpr uint32_t kOperationCount = 100000;
+
+	sol::state luaState;
+	luaState.open_libraries(sol::lib::base, sol::lib::math);
+	OvCore::Scripting::LuaMathsBinder::BindMaths(luaState);
+	luaState.script(kScript);
+
+	const std::vector<std::pair<const char*, const char*>> functions =
+	{
+		{ "MoveWithOperators",		"position = position + velocity * 0.016" },
+		{ "MoveInPlace",			"position:AddScaledInPlace(velocity, 0.016)" },
+		{ "RotateWithOperators",	"rotation = rotation * delta" },
+		{ "RotateInPlace",			"rotation:MultiplyInPlace(delta)" },
+		{ "OffsetWithOperators",	"points[i] = points[i] + offset" },
+		{ "OffsetInBulk",			"Vector3.AddToAll(points, offset)" }
+	};
+
+	Benchmark::Title("Lua maths, " + std::to_string(kOperationCount) + " operations per run");
+
+	for (const auto& [name, description] : functions)
+	{
+		sol::protected_function function = luaState[name];
+
+		/* The collector is stopped during one run, so the memory growth is everything the run allocated */
+		luaState.collect_garbage();
+		luaState["collectgarbage"]("stop");
+		const size_t memoryBefore = luaState.memory_used();
+		function(kOperationCount);
+		const size_t allocated = luaState.memory_used() - memoryBefore;
+		luaState["collectgarbage"]("restart");
+
+		const double milliseconds = Benchmark::Measure(20, [&]
+		{
+			function(kOperationCount);
+		});
+
+		Benchmark::Report(description, milliseconds);
+		Benchmark::Report("  Operations per second", Format("%.2f M", kOperationCount / milliseconds / 1000.0));
+		Benchmark::Report("  Garbage per run", Format("%.1f KB", allocated / 1024.0));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "OvBenchmark/Benchmarks.h"
+
+int main(int p_argc, char** p_argv)
+{
+	const std::vector<std::pair<std::string, void(*)()>> benchmarks =
+	{
+		{ "culling",		&OvBenchmark::RunCullingBenchmark },
+		{ "vertexformat",	&OvBenchmark::RunVertexFormatBenchmark },
+		{ "luahooks",		&OvBenchmark::RunLuaHooksBenchmark },
+		{ "luamaths",		&OvBenchmark::RunLuaMathsBenchmark }
+	};
+
+	/* Every benchmark runs when none is named on the command line */
+	int ran = 0;
+
+	for (const auto& [name, run] : benchmarks)
+	{
+		bool selected = p_argc == 1;
+
+		for (int i = 1; i < p_argc; ++i)
+			selected |= name == p_argv[i];
+
+		if (selected)
+		{
+			run();
+			++ran;
+		}
+	}
+
+	if (ran == 0)
+	{
+		std::printf("Unknown benchmark, available ones:");
+
+		for (const auto& benchmark : benchmarks)
+			std::printf(" %s", benchmark.first.c_str());
+
+		std::printf("\n");
+		return 1;
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <OvRendering/Geometry/VertexFormat.h>
+
+#include "OvBenchmark/Benchmark.h"
+#include "OvBenchmark/Benchmarks.h"
+
+namespace
+{
+	/* Wavy grid, so normals and tangents vary from one vertex to the next */
+	void CreateGrid(uint32_t p_size, std::vector<OvRendering::Geometry::Vertex>& p_vertices, std::vector<uint32_t>& p_indices)
+	{
+		p_vertices.clear();
+		p_indices.clear();
+
+		for (uint32_t z = 0; z < p_size; ++z)
+		{
+			for (uint32_t x = 0; x < p_size; ++x)
+			{
+				const float height = std::sin(x * 0.1f) * std::cos(z * 0.1f);
+				const float slopeX = 0.1f * std::cos(x * 0.1f) * std::cos(z * 0.1f);
+				const float slopeZ = -0.1f * std::sin(x * 0.1f) * std::sin(z * 0.1f);
+				const float normalLength = std::sqrt(slopeX * slopeX + 1.0f + slopeZ * slopeZ);
+				const float tangentLength = std::sqrt(1.0f + slopeX * slopeX);
+
+				OvRendering::Geometry::Vertex vertex =
+				{
+					{ static_cast<float>(x), height, static_cast<float>(z) },
+					{ static_cast<float>(x) / p_size, static_cast<float>(z) / p_size },
+					{ -slopeX / normalLength, 1.0f / normalLength, -slopeZ / normalLength },
+					{ 1.0f / tangentLength, slopeX / tangentLength, 0.0f },
+					{ 0.0f, 0.0f, 1.0f }
+				};
+
+				p_vertices.push_back(vertex);
+			}
+		}
+
+		for (uint32_t z = 0; z + 1 < p_size; ++z)
+		{
+			for (uint32_t x = 0; x + 1 < p_size; ++x)
+			{
+				const uint32_t corner = z * p_size + x;
+				p_indices.insert(p_indices.end(), { corner, corner + p_size, corner + 1, corner + 1, corner + p_size, corner + p_size + 1 });
+			}
+		}
+	}
+
+	std::string ToMegabytes(size_t p_bytes)
+	{
+		char result[32];
+		std::snprintf(result, sizeof(result), "%.1f MB", p_bytes / (1024.0 * 1024.0));
+		return result;
+	}
+}
+
+void OvBenchmark::RunVertexFormatBenchmark()
+{
+	using namespace OvRendering::Geometry;
+
+	/* 256 x 256 vertices still use 16-bit indices once compressed, 1024 x 1024 vertices don't */
+	for (const uint32_t size : { 256u, 1024u })
+	{
+		std::vector<Vertex> vertices;
+		std::vector<uint32_t> indices;
+		CreateGrid(size, vertices, indices);
+
+		const auto vertexCount = static_cast<uint32_t>(vertices.size());
+		const auto indexCount = static_cast<uint32_t>(indices.size());
+		PackedMesh standard;
+		PackedMesh compressed;
+
+		const double standardTime = Benchmark::Measure(10, [&]
+		{
+			standard = VertexFormat::Pack(vertices.data(), vertexCount, indices.data(), indexCount, 0, EVertexFormat::STANDARD);
+		});
+
+		const double compressedTime = Benchmark::Measure(10, [&]
+		{
+			compressed = VertexFormat::Pack(vertices.data(), vertexCount, indices.data(), indexCount, 0, EVertexFormat::COMPRESSED);
+		});
+
+		const size_t standardBytes = standard.vertices.size() + standard.indices.size();
+		const size_t compressedBytes = compressed.vertices.size() + compressed.indices.size();
+
+		Benchmark::Title("Vertex format, " + std::to_string(vertexCount) + " vertices, " + std::to_string(indexCount) + " indices");
+		Benchmark::Report("Standard vertices + indices", ToMegabytes(standard.vertices.size()) + " + " + ToMegabytes(standard.indices.size()));
+		Benchmark::Report("Compressed vertices + indices", ToMegabytes(compressed.vertices.size()) + " + " + ToMegabytes(compressed.indices.size()));
+		Benchmark::Report("Memory saved", std::to_string(100 - compressedBytes * 100 / standardBytes) + " %");
+		Benchmark::Report("Conversion to the standard format", standardTime);
+		Benchmark::Report("Conversion to the compressed format", compressedTime);
+	}
+}
\ No newline at end of file
@@ -181,24 +181,6 @@ namespace OvCore::ECS
 		*/
 		void OnDestroy();
 
-		/**
-		* Called every frame
-		* @param p_deltaTime
-		*/
-		void OnUpdate(float p_deltaTime);
-
-		/**
-		* Called every physics frame
-		* @param p_deltaTime
-		*/
-		void OnFixedUpdate(float p_deltaTime);
-
-		/**
-		* Called every frame after OnUpdate
-		* @param p_deltaTime
-		*/
-		void OnLateUpdate(float p_deltaTime);
-
 		/**
 		* Called when the actor enter in collision with another physical object
 		* @param p_otherObject
@@ -255,7 +237,8 @@ namespace OvCore::ECS
 		bool RemoveComponent(OvCore::ECS::Components::AComponent& p_component);
 
 		/**
-		* Try to get the given component (Returns nullptr on failure)
+		* Try to get the given component (Returns nullptr on failure). Constant time, components deriving
+		* from T are only found if T is listed in their ComponentBases
 		*/
 		template<typename T>
 		T* GetComponent();
@@ -294,6 +277,20 @@ namespace OvCore::ECS
 		*/
 		std::unordered_map<std::string, Components::Behaviour>& GetBehaviours();
 
+		/**
+		* Add the component matching the given serialized component type (AComponent::GetSerializationID, or the typeid
+		* name written by older scenes). The transform identifier returns the transform of the actor. Returns nullptr for unknown types
+		* @param p_serializationID
+		*/
+		Components::AComponent* AddComponentFromSerializationID(const std::string& p_serializationID);
+
+		/**
+		* Returns the serialization identifier matching the given serialized component type, which can be an identifier or
+		* the typeid name written by older scenes. Unknown types are returned unchanged
+		* @param p_type
+		*/
+		static std::string ResolveSerializationID(const std::string& p_type);
+
 		/**
 		* Serialize all the components
 		*/
@@ -313,6 +310,8 @@ namespace OvCore::ECS
 
 		void RecursiveActiveUpdate();
 		void RecursiveWasActiveUpdate();
+		void RegisterComponentTypes(Components::AComponent& p_component);
+		void UnregisterComponentTypes(Components::AComponent& p_component);
 
 	public:
 		/* Some events that are triggered when an action occur on the actor instance */
@@ -321,6 +320,11 @@ namespace OvCore::ECS
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourAddedEvent;
 		OvTools::Eventing::Event<Components::Behaviour&>	BehaviourRemovedEvent;
 
+		/* Triggered after the name, tag or ID of the actor changed, with the previous value */
+		OvTools::Eventing::Event<Actor&, const std::string&>	NameChangedEvent;
+		OvTools::Eventing::Event<Actor&, const std::string&>	TagChangedEvent;
+		OvTools::Eventing::Event<Actor&, int64_t>			IDChangedEvent;
+
 		/* Some events that are triggered when an action occur on any actor */
 		static OvTools::Eventing::Event<Actor&>				DestroyedEvent;
 		static OvTools::Eventing::Event<Actor&>				CreatedEvent;
@@ -349,6 +353,7 @@ namespace OvCore::ECS
 
 		/* Actors components */
 		std::vector<std::shared_ptr<Components::AComponent>> m_components;
+		std::vector<Components::AComponent*> m_componentsByType;
 		std::unordered_map<std::string, Components::Behaviour> m_behaviours;
 
 	public:
@@ -17,8 +17,13 @@ namespace OvCore::ECS
 
 		if (auto found = GetComponent<T>(); !found)
 		{
-			m_components.insert(m_components.begin(), std::make_shared<T>(*this, p_args...));
-			T& instance = *dynamic_cast<T*>(m_components.front().get());
+			auto component = std::make_shared<T>(*this, p_args...);
+			T& instance = *component;
+			static_cast<Components::AComponent&>(instance).m_typeIDs = GetComponentTypeIDs<T>();
+			static_cast<Components::AComponent&>(instance).m_updateAccess = &GetComponentUpdateAccess<T>();
+			static_cast<Components::AComponent&>(instance).m_serializationID = T::SERIALIZATION_ID;
+			m_components.insert(m_components.begin(), std::move(component));
+			RegisterComponentTypes(instance);
 			ComponentAddedEvent.Invoke(instance);
 			if (m_playing && IsActive())
 			{
@@ -40,18 +45,8 @@ namespace OvCore::ECS
 		static_assert(std::is_base_of<Components::AComponent, T>::value, "T should derive from AComponent");
 		static_assert(!std::is_same<Components::CTransform, T>::value, "You can't remove a CTransform from an actor");
 
-		std::shared_ptr<T> result(nullptr);
-
-		for (auto it = m_components.begin(); it != m_components.end(); ++it)
-		{
-			result = std::dynamic_pointer_cast<T>(*it);
-			if (result)
-			{
-				ComponentRemovedEvent.Invoke(*result.get());
-				m_components.erase(it);
-				return true;
-			}
-		}
+		if (auto found = GetComponent<T>())
+			return RemoveComponent(*found);
 
 		return false;
 	}
@@ -61,17 +56,7 @@ namespace OvCore::ECS
 	{
 		static_assert(std::is_base_of<Components::AComponent, T>::value, "T should derive from AComponent");
 
-		std::shared_ptr<T> result(nullptr);
-
-		for (auto it = m_components.begin(); it != m_components.end(); ++it)
-		{
-			result = std::dynamic_pointer_cast<T>(*it);
-			if (result)
-			{
-				return result.get();
-			}
-		}
-
-		return nullptr;
+		const ComponentTypeID typeID = GetComponentTypeID<T>();
+		return typeID < m_componentsByType.size() ? static_cast<T*>(m_componentsByType[typeID]) : nullptr;
 	}
 }
\ No newline at end of file
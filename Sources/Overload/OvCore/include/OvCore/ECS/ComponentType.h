@@ -0,0 +1,125 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace OvCore::ECS
+{
+	/**
+	* Small contiguous identifier of a component type, usable as an index into per-type tables
+	*/
+	using ComponentTypeID = uint32_t;
+
+	/**
+	* List of the component types a component can also be retrieved as (See AComponent::ComponentBases)
+	*/
+	template<typename... Bases>
+	struct ComponentBaseList {};
+
+	/**
+	* List of component types, used to declare the components an update accesses (See ParallelUpdate)
+	*/
+	template<typename... Types>
+	struct ComponentList {};
+
+	/**
+	* Declares that the update callbacks of a component type run on the main thread (Default, See AComponent::UpdateAccess)
+	*/
+	struct MainThreadUpdate {};
+
+	/**
+	* Declares that the update callbacks of a component type can run on worker threads, concurrently with the
+	* components of other types that don't write what they access. Callbacks must only access their own component
+	* and the listed components of its owner. Writing a CTransform isn't allowed (Transform changes notify the scene),
+	* reading its world matrix is: the scene resolves the world matrices before every parallel stage. The world position,
+	* rotation and scale are decomposed on demand, they must not be read from a parallel update
+	* @tparam Reads (ComponentList of the components of the owner read by the callbacks)
+	* @tparam Writes (ComponentList of the components of the owner written by the callbacks)
+	*/
+	template<typename Reads = ComponentList<>, typename Writes = ComponentList<>>
+	struct ParallelUpdate {};
+
+	/**
+	* Scheduling constraints of the update callbacks of a component type
+	*/
+	struct ComponentUpdateAccess
+	{
+		bool parallel = false;
+		std::vector<ComponentTypeID> reads;
+		std::vector<ComponentTypeID> writes;
+	};
+
+	/**
+	* Returns a new component type identifier (Used by GetComponentTypeID, should not be called directly)
+	*/
+	ComponentTypeID GenerateComponentTypeID();
+
+	/**
+	* Returns the identifier of the given component type. The identifier is generated once per type
+	*/
+	template<typename T>
+	ComponentTypeID GetComponentTypeID()
+	{
+		static const ComponentTypeID typeID = GenerateComponentTypeID();
+		return typeID;
+	}
+
+	/**
+	* Returns the identifiers of T followed by the identifiers of the given bases
+	*/
+	template<typename T, typename... Bases>
+	std::vector<ComponentTypeID> GetComponentTypeIDs(ComponentBaseList<Bases...>)
+	{
+		return { GetComponentTypeID<T>(), GetComponentTypeID<Bases>()... };
+	}
+
+	/**
+	* Returns the identifiers a component of type T can be retrieved with: its own one, then the ones
+	* of the component bases listed in T::ComponentBases
+	*/
+	template<typename T>
+	std::vector<ComponentTypeID> GetComponentTypeIDs()
+	{
+		/* A base class listing itself is inherited as is, so its own identifier can appear twice */
+		auto typeIDs = GetComponentTypeIDs<T>(typename T::ComponentBases{});
+		typeIDs.erase(std::remove(typeIDs.begin() + 1, typeIDs.end(), typeIDs.front()), typeIDs.end());
+		return typeIDs;
+	}
+
+	/**
+	* Returns the update access of T for the given declaration. The component itself counts as written
+	*/
+	template<typename T, typename... Reads, typename... Writes>
+	ComponentUpdateAccess MakeComponentUpdateAccess(ParallelUpdate<ComponentList<Reads...>, ComponentList<Writes...>>)
+	{
+		auto writes = GetComponentTypeIDs<T>();
+		(writes.push_back(GetComponentTypeID<Writes>()), ...);
+		return { true, { GetComponentTypeID<Reads>()... }, std::move(writes) };
+	}
+
+	/**
+	* Returns the update access of a component type updated on the main thread
+	*/
+	template<typename T>
+	ComponentUpdateAccess MakeComponentUpdateAccess(MainThreadUpdate)
+	{
+		return { false, {}, GetComponentTypeIDs<T>() };
+	}
+
+	/**
+	* Returns the update access declared by T::UpdateAccess. The access is built once per type
+	*/
+	template<typename T>
+	const ComponentUpdateAccess& GetComponentUpdateAccess()
+	{
+		static const ComponentUpdateAccess access = MakeComponentUpdateAccess<T>(typename T::UpdateAccess{});
+		return access;
+	}
+}
\ No newline at end of file
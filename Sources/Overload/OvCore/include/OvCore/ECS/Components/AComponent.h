@@ -7,8 +7,10 @@
 #pragma once
 
 #include "OvCore/API/IInspectorItem.h"
+#include "OvCore/ECS/ComponentType.h"
 
 namespace OvCore::ECS { class Actor; }
+namespace OvCore::SceneSystem { class BinaryData; }
 
 namespace OvCore::ECS::Components
 {
@@ -21,6 +23,20 @@ namespace OvCore::ECS::Components
 	class AComponent : public API::IInspectorItem
 	{
 	public:
+		/**
+		* Component types a component can also be retrieved as (Actor::GetComponent, Scene component pools).
+		* A component type meant to be queried through its base class redefines it, for example
+		* "using ComponentBases = ComponentBaseList<CLight>;" in CLight makes every light retrievable as a CLight
+		*/
+		using ComponentBases = ComponentBaseList<>;
+
+		/**
+		* Threads the update callbacks (OnUpdate, OnFixedUpdate, OnLateUpdate) of the component type can run on.
+		* A component type whose updates only touch a few components of its owner can redefine it to be updated in parallel,
+		* for example "using UpdateAccess = ParallelUpdate<ComponentList<CTransform>, ComponentList<CAudioSource>>;"
+		*/
+		using UpdateAccess = MainThreadUpdate;
+
 		/**
 		* Constructor of a AComponent (Must be called by derived classes)
 		* @param p_owner
@@ -113,11 +129,47 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnTriggerExit(Components::CPhysicalObject& p_otherObject) {}
 
+		/**
+		* Called when the component is loaded from a binary scene. The default implementation recreates the data as XML
+		* and calls OnDeserialize, components override it to read their data in place
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data);
+
 		/**
 		* Returns the name of the component
 		*/
 		virtual std::string GetName() = 0;
 
+		/**
+		* Returns the identifier used to serialize the component type. Every component type added through
+		* Actor::AddComponent declares it as "static constexpr const char* SERIALIZATION_ID", which must never change
+		* once scenes are saved with it (Unlike GetName, which is displayed by the editor)
+		*/
+		const char* GetSerializationID() const;
+
+		/**
+		* Returns true if the component can be retrieved as the given component type
+		* @param p_typeID
+		*/
+		bool IsOfType(ComponentTypeID p_typeID) const;
+
+		/**
+		* Returns the component types the component can be retrieved as (Its own type first)
+		*/
+		const std::vector<ComponentTypeID>& GetTypeIDs() const;
+
+		/**
+		* Returns the update access declared by the component type (See UpdateAccess)
+		*/
+		const ComponentUpdateAccess& GetUpdateAccess() const;
+
+	private:
+		friend class ECS::Actor;
+		std::vector<ComponentTypeID> m_typeIDs;
+		const ComponentUpdateAccess* m_updateAccess = nullptr;
+		const char* m_serializationID = nullptr;
+
 	public:
 		ECS::Actor& owner;
 	};
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <array>
+
 #include <sol.hpp>
 
 #include "OvCore/ECS/Components/CPhysicalObject.h"
@@ -21,6 +23,33 @@ namespace OvCore::ECS::Components
 	class Behaviour : public AComponent
 	{
 	public:
+		/**
+		* Functions of the script called by the engine. Retro-compatibility names are hooks of their own
+		*/
+		enum class EHook : uint32_t
+		{
+			AWAKE,
+			START,
+			ENABLE,
+			DISABLE,
+			END,
+			DESTROY,
+			UPDATE,
+			FIXED_UPDATE,
+			LATE_UPDATE,
+			COLLISION_START,
+			COLLISION_ENTER,
+			COLLISION_STAY,
+			COLLISION_STOP,
+			COLLISION_EXIT,
+			TRIGGER_START,
+			TRIGGER_ENTER,
+			TRIGGER_STAY,
+			TRIGGER_STOP,
+			TRIGGER_EXIT,
+			COUNT
+		};
+
 		/**
 		* Constructor of a ABehaviour (Must be called by derived classes)
 		* @param p_owner
@@ -38,12 +67,13 @@ namespace OvCore::ECS::Components
 		virtual std::string GetName() override;
 
 		/**
-		* Register the behaviour to lua
+		* Register the behaviour to lua by running the compiled script, which returns the table of the behaviour.
+		* The hooks the script implements are resolved here, then again after each lifecycle hook (OnAwake, OnStart, OnEnable, OnDisable),
+		* so hooks assigned by these functions are called. Hooks assigned by any other function are only picked at the next lifecycle hook
 		* Returns true on success
-		* @param p_luaState
-		* @param p_rootFolder
+		* @param p_script
 		*/
-		bool RegisterToLuaContext(sol::state& p_luaState, const std::string& p_scriptFolder);
+		bool RegisterToLuaContext(const sol::protected_function& p_script);
 
 		/**
 		* Register the behaviour to lua
@@ -59,6 +89,12 @@ namespace OvCore::ECS::Components
 		template<typename... Args>
 		void LuaCall(const std::string& p_functionName, Args&&... p_args);
 
+		/**
+		* Returns true if the script implements the given hook
+		* @param p_hook
+		*/
+		bool HasHook(EHook p_hook) const;
+
 		/**
 		* Return the lua table attached to this behaviour
 		*/
@@ -159,6 +195,13 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node) override;
 
+		/**
+		* Deserialize the behaviour from a binary scene. The state of a behaviour lives in its script table, which isn't
+		* serialized (OnSerialize writes nothing), so it only skips the XML conversion done by the default implementation
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the behaviour should be drawn in the inspector
 		* @param p_root
@@ -171,8 +214,20 @@ namespace OvCore::ECS::Components
 
 		const std::string name;
 
+	private:
+		/* Look up every hook in the script table, the lookups are string-keyed so they are kept out of the per-frame hooks */
+		void ResolveHooks();
+
+		/* Call a lifecycle hook, then resolve the hooks again as the script table may have been changed by it */
+		void CallLifecycleHook(EHook p_hook);
+
+		template<typename... Args>
+		void CallHook(EHook p_hook, Args&&... p_args);
+
 	private:
 		sol::table m_object = sol::nil;
+		std::array<sol::protected_function, static_cast<size_t>(EHook::COUNT)> m_hooks;
+		uint32_t m_hookMask = 0;
 	};
 }
 
@@ -30,4 +30,18 @@ namespace OvCore::ECS::Components
 			}
 		}
 	}
+
+	template<typename ...Args>
+	inline void Components::Behaviour::CallHook(EHook p_hook, Args&& ...p_args)
+	{
+		if (HasHook(p_hook))
+		{
+			auto pfrResult = m_hooks[static_cast<size_t>(p_hook)].call(m_object, std::forward<Args>(p_args)...);
+			if (!pfrResult.valid())
+			{
+				sol::error err = pfrResult;
+				OVLOG_ERROR(err.what());
+			}
+		}
+	}
 }
\ No newline at end of file
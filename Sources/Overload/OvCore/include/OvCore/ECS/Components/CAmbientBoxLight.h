@@ -18,6 +18,8 @@ namespace OvCore::ECS::Components
 	class CAmbientBoxLight : public CLight
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CAmbientBoxLight";
+
 		/**
 		* Constructor
 		* @param p_owner
@@ -54,6 +56,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -23,6 +23,8 @@ namespace OvCore::ECS::Components
 	class CAudioListener : public AComponent
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CAudioListener";
+
 		/**
 		* Constructor
 		* @param p_owner
@@ -48,6 +50,13 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene. An audio listener has no setting to serialize (OnSerialize writes
+		* nothing), so it only skips the XML conversion done by the default implementation
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
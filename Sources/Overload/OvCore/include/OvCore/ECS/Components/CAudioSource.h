@@ -21,6 +21,8 @@ namespace OvCore::ECS::Components
 	class CAudioSource : public AComponent
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CAudioSource";
+
 		/**
 		* Constructor
 		* @param p_owner
@@ -158,6 +160,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <OvMaths/Internal/TransformNotifier.h>
+
 #include <OvRendering/Entities/Light.h>
 
 #include "OvCore/ECS/Components/AComponent.h"
@@ -20,12 +22,19 @@ namespace OvCore::ECS::Components
 	class CLight : public AComponent
 	{
 	public:
+		using ComponentBases = ComponentBaseList<CLight>;
+
 		/**
 		* Constructor
 		* @param p_owner
 		*/
 		CLight(ECS::Actor& p_owner);
 
+		/**
+		* Destructor
+		*/
+		~CLight();
+
 		/**
 		* Returns light data
 		*/
@@ -67,13 +76,27 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
 		*/
 		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
 
+	public:
+		/* Invoked when the effect range or the position of the light may have changed */
+		OvTools::Eventing::Event<> BoundsChangedEvent;
+
 	protected:
 		OvRendering::Entities::Light m_data;
+
+	private:
+		OvMaths::Internal::TransformNotifier::NotificationHandlerID m_transformNotificationHandlerID;
+		bool m_transformAlive = true;
 	};
 }
\ No newline at end of file
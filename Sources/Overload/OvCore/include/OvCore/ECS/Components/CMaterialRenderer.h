@@ -14,6 +14,7 @@
 
 #include "OvCore/Resources/Material.h"
 #include "OvCore/ECS/Components/AComponent.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 #define MAX_MATERIAL_COUNT 255
 
@@ -22,12 +23,16 @@ namespace OvCore::ECS { class Actor; }
 namespace OvCore::ECS::Components
 {
 	/**
-	* A component that handle a material list, necessary for model rendering
+	* A component that handle a material list, necessary for model rendering.
+	* The materials are referenced, so they can't be evicted while they are in the list
 	*/
 	class CMaterialRenderer : public AComponent
 	{
 	public:
-		using MaterialList = std::array<OvCore::Resources::Material*, MAX_MATERIAL_COUNT>;
+		static constexpr const char* SERIALIZATION_ID = "CMaterialRenderer";
+
+		using MaterialHandle = ResourceManagement::ResourceHandle<OvCore::Resources::Material>;
+		using MaterialList = std::array<MaterialHandle, MAX_MATERIAL_COUNT>;
 		using MaterialField = std::array<std::array<OvUI::Widgets::AWidget*, 3>, MAX_MATERIAL_COUNT>;
 
 		/**
@@ -121,6 +126,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
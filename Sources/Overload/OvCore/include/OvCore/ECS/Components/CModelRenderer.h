@@ -6,21 +6,31 @@
 
 #pragma once
 
+#include <OvMaths/Internal/TransformNotifier.h>
+
 #include <OvRendering/Geometry/Vertex.h>
 #include <OvRendering/Resources/Model.h>
 
 #include "OvCore/ECS/Components/AComponent.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 namespace OvCore::ECS { class Actor; }
 
 namespace OvCore::ECS::Components
 {
+	class CTransform;
+
 	/**
 	* A ModelRenderer is necessary in combination with a MaterialRenderer to render a model in the world
 	*/
 	class CModelRenderer : public AComponent
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CModelRenderer";
+
+		/* The late update only refreshes the world bounding sphere from the owner transform */
+		using UpdateAccess = ParallelUpdate<ComponentList<CTransform>>;
+
 		/**
 		* Defines how the model renderer bounding sphere should be interpreted
 		*/
@@ -38,6 +48,11 @@ namespace OvCore::ECS::Components
 		*/
 		CModelRenderer(ECS::Actor& p_owner);
 
+		/**
+		* Destructor
+		*/
+		~CModelRenderer();
+
 		/**
 		* Returns the name of the component
 		*/
@@ -76,6 +91,18 @@ namespace OvCore::ECS::Components
 		*/
 		void SetCustomBoundingSphere(const OvRendering::Geometry::BoundingSphere& p_boundingSphere);
 
+		/**
+		* Returns the bounding sphere used for frustum culling (Custom or model one) in world space.
+		* It is recomputed when the bounds changed since the last call (See BoundsChangedEvent)
+		*/
+		const OvRendering::Geometry::BoundingSphere& GetWorldBoundingSphere() const;
+
+		/**
+		* Refresh the world bounding sphere, so the scene spatial index doesn't compute it on the main thread
+		* @param p_deltaTime
+		*/
+		virtual void OnLateUpdate(float p_deltaTime) override;
+
 		/**
 		* Serialize the component
 		* @param p_doc
@@ -90,16 +117,34 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
 		*/
 		virtual void OnInspector(OvUI::Internal::WidgetContainer& p_root) override;
 
+	public:
+		/* Invoked when the world bounding sphere may have changed (Transform, model, frustum behaviour or custom bounding sphere changed) */
+		OvTools::Eventing::Event<> BoundsChangedEvent;
+
+	private:
+		void UpdateModelReference();
+
 	private:
 		OvRendering::Resources::Model* m_model = nullptr;
+		ResourceManagement::ResourceHandle<OvRendering::Resources::Model> m_modelReference;
 		OvTools::Eventing::Event<> m_modelChangedEvent;
 		OvRendering::Geometry::BoundingSphere m_customBoundingSphere = { {}, 1.0f };
 		EFrustumBehaviour m_frustumBehaviour = EFrustumBehaviour::CULL_MODEL;
+		OvMaths::Internal::TransformNotifier::NotificationHandlerID m_transformNotificationHandlerID;
+		bool m_transformAlive = true;
+		mutable OvRendering::Geometry::BoundingSphere m_worldBoundingSphere = { {}, 0.0f };
+		mutable bool m_worldBoundingSphereDirty = true;
 	};
 }
\ No newline at end of file
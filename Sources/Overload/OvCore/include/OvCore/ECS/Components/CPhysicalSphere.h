@@ -20,6 +20,8 @@ namespace OvCore::ECS::Components
 	class CPhysicalSphere : public CPhysicalObject
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CPhysicalSphere";
+
 		/**
 		* Constructor
 		* @param p_owner
@@ -56,6 +58,12 @@ namespace OvCore::ECS::Components
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_node) override;
 
+		/**
+		* Deserialize the component from a binary scene
+		* @param p_data
+		*/
+		virtual void OnDeserializeBinary(const SceneSystem::BinaryData& p_data) override;
+
 		/**
 		* Defines how the component should be drawn in the inspector
 		* @param p_root
@@ -24,6 +24,8 @@ namespace OvCore::ECS::Components
 	class CTransform : public AComponent
 	{
 	public:
+		static constexpr const char* SERIALIZATION_ID = "CTransform";
+
 		/**
 		* Create a transform without setting a parent
 		* @param p_localPosition
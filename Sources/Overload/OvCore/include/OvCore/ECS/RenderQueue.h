@@ -0,0 +1,108 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <OvMaths/FMatrix4.h>
+
+#include <OvRendering/Resources/Mesh.h>
+
+#include "OvCore/Resources/Material.h"
+
+namespace OvCore::ECS
+{
+	/**
+	* A contiguous list of drawables sorted with a 64 bits key.
+	* The queue is meant to be kept alive between frames: clearing it keeps its memory, so
+	* refilling it every frame doesn't allocate once the queue reached its working size
+	*/
+	class RenderQueue
+	{
+	public:
+		/**
+		* Defines how the sort key of the queued drawables is generated
+		*/
+		enum class ESortMode
+		{
+			STATE_CHANGES,	// Grouped by shader, then material, then mesh, then front-to-back
+			BACK_TO_FRONT	// Farthest drawables first, then grouped by shader and material
+		};
+
+		/**
+		* Queued draw call. Matrices are referenced (Not copied), they must stay valid until the queue is drawn
+		*/
+		struct Drawable
+		{
+			uint64_t						sortKey;
+			OvRendering::Resources::Mesh*	mesh;
+			OvCore::Resources::Material*	material;
+			const OvMaths::FMatrix4*		modelMatrix;
+			const OvMaths::FMatrix4*		userMatrix;
+		};
+
+		/**
+		* Constructor of the RenderQueue
+		* @param p_sortMode
+		*/
+		RenderQueue(ESortMode p_sortMode);
+
+		/**
+		* Remove every drawable from the queue (The allocated memory is kept for the next frame)
+		*/
+		void Clear();
+
+		/**
+		* Add a drawable to the queue
+		* @param p_mesh
+		* @param p_material
+		* @param p_modelMatrix
+		* @param p_userMatrix
+		* @param p_distance (Distance to the camera, used for depth sorting)
+		*/
+		void Push(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, const OvMaths::FMatrix4& p_modelMatrix, const OvMaths::FMatrix4& p_userMatrix, float p_distance);
+
+		/**
+		* Sort the queued drawables by key (Stable radix sort)
+		*/
+		void Sort();
+
+		/**
+		* Returns the number of queued drawables
+		*/
+		size_t Size() const;
+
+		/**
+		* Returns true if the queue contains no drawable
+		*/
+		bool IsEmpty() const;
+
+		/**
+		* Returns the queued drawables
+		*/
+		const std::vector<Drawable>& GetDrawables() const;
+
+		/**
+		* Returns an iterator to the first queued drawable
+		*/
+		std::vector<Drawable>::const_iterator begin() const;
+
+		/**
+		* Returns an iterator past the last queued drawable
+		*/
+		std::vector<Drawable>::const_iterator end() const;
+
+	private:
+		uint64_t GenerateSortKey(const OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, float p_distance) const;
+
+	private:
+		const ESortMode m_sortMode;
+		std::vector<Drawable> m_drawables;
+		std::vector<Drawable> m_sortBuffer;
+	};
+}
\ No newline at end of file
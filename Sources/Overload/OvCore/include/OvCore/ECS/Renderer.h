@@ -6,9 +6,8 @@
 
 #pragma once
 
-#include <map>
-
 #include <OvRendering/Core/Renderer.h>
+#include <OvRendering/Buffers/ShaderStorageBuffer.h>
 #include <OvRendering/Resources/Mesh.h>
 #include <OvRendering/Data/Frustum.h>
 
@@ -17,6 +16,7 @@
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/ECS/Components/CCamera.h"
 #include "OvCore/SceneSystem/Scene.h"
+#include "OvCore/ECS/RenderQueue.h"
 
 namespace OvCore::ECS
 {
@@ -27,9 +27,7 @@ namespace OvCore::ECS
 	class Renderer : public OvRendering::Core::Renderer
 	{
 	public:
-		using Drawable				= std::tuple<OvMaths::FMatrix4, OvRendering::Resources::Mesh*, OvCore::Resources::Material*, OvMaths::FMatrix4>;
-		using OpaqueDrawables		= std::multimap<float, Drawable, std::less<float>>;
-		using TransparentDrawables	= std::multimap<float, Drawable, std::greater<float>>;
+		using Drawable = RenderQueue::Drawable;
 
 		/**
 		* Constructor of the Renderer
@@ -80,14 +78,18 @@ namespace OvCore::ECS
 		);
 
 		/**
-		* Returns opaque and transparents drawables from the scene with frustum culling
+		* Fill the given queues with the opaque and transparents drawables from the scene with frustum culling, and sort them
+		* @param p_opaques
+		* @param p_transparents
 		* @param p_scene
 		* @param p_cameraPosition
 		* @param p_frustum
 		* @param p_defaultMaterial
 		*/
-		std::pair<OpaqueDrawables, TransparentDrawables> FindAndSortFrustumCulledDrawables
+		void FindAndSortFrustumCulledDrawables
 		(
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
 			const OvCore::SceneSystem::Scene& p_scene,
 			const OvMaths::FVector3& p_cameraPosition,
 			const OvRendering::Data::Frustum& p_frustum,
@@ -95,13 +97,17 @@ namespace OvCore::ECS
 		);
 
 		/**
-		* Returns opaque and transparents drawables from the scene
+		* Fill the given queues with the opaque and transparents drawables from the scene, and sort them
+		* @param p_opaques
+		* @param p_transparents
 		* @param p_scene
 		* @param p_cameraPosition
 		* @param p_defaultMaterial
 		*/
-		std::pair<OpaqueDrawables, TransparentDrawables> FindAndSortDrawables
+		void FindAndSortDrawables
 		(
+			RenderQueue& p_opaques,
+			RenderQueue& p_transparents,
 			const OvCore::SceneSystem::Scene& p_scene,
 			const OvMaths::FVector3& p_cameraPosition,
 			OvCore::Resources::Material* p_defaultMaterial
@@ -113,6 +119,15 @@ namespace OvCore::ECS
 		*/
 		void DrawDrawable(const Drawable& p_toDraw);
 
+		/**
+		* Draw every drawable of the given queue in order. Consecutive drawables sharing the same material
+		* (Or shader) don't rebind it, only their model and user matrices are sent to the GPU.
+		* Consecutive drawables sharing the same mesh, material and user matrix are drawn with a single instanced draw call
+		* if their shader supports it (See Shader::SupportsInstancing). Their model matrices are uploaded once for the whole queue
+		* @param p_queue
+		*/
+		void DrawRenderQueue(const RenderQueue& p_queue);
+
 		/**
 		* Draw the model using the given material (The material will be applied to every submeshes of the the model)
 		* @param p_model
@@ -156,9 +171,24 @@ namespace OvCore::ECS
 		*/
 		void RegisterUserMatrixSender(std::function<void(OvMaths::FMatrix4)> p_userMatrixSender);
 
+	private:
+		void DrawInstances(const Drawable* p_first, size_t p_count, size_t p_offset);
+
 	private:
 		std::function<void(OvMaths::FMatrix4)> m_modelMatrixSender;
 		std::function<void(OvMaths::FMatrix4)> m_userMatrixSender;
 		OvRendering::Resources::Texture* m_emptyTexture = nullptr;
+
+		/* Kept between frames to prevent per-frame allocations */
+		RenderQueue m_opaqueQueue		= RenderQueue(RenderQueue::ESortMode::STATE_CHANGES);
+		RenderQueue m_transparentQueue	= RenderQueue(RenderQueue::ESortMode::BACK_TO_FRONT);
+
+		/* Results of the scene spatial queries, kept between frames to prevent per-frame allocations */
+		std::vector<OvCore::ECS::Components::CModelRenderer*> m_visibleModelRenderers;
+		std::vector<OvCore::ECS::Components::CLight*> m_visibleLights;
+
+		/* Per-instance (Transposed) model matrices of the instanced draw calls, each run reads its own range of the SSBO */
+		std::unique_ptr<OvRendering::Buffers::ShaderStorageBuffer> m_instancesSSBO;
+		std::vector<OvMaths::FMatrix4> m_instancesData;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <functional>
+#include <cstdint>
+
+namespace OvCore::Jobs
+{
+	/**
+	* Work-stealing pool of threads running data parallel jobs split in batches.
+	* Each thread owns a queue of batches: it runs its own batches first, then steals batches from the other queues
+	*/
+	class JobSystem
+	{
+	public:
+		using BatchFunction = std::function<void(uint32_t p_begin, uint32_t p_end)>;
+
+		/**
+		* Disabled constructor
+		*/
+		JobSystem() = delete;
+
+		/**
+		* Call the given function on every batch of p_batchSize indices in [0, p_count), and wait for every batch to be done.
+		* Batches run concurrently in no particular order, the calling thread runs batches too.
+		* The function must not throw, and can itself call ParallelFor
+		* @param p_count
+		* @param p_batchSize
+		* @param p_function (Called with the first and past-the-end indices of a batch)
+		*/
+		static void ParallelFor(uint32_t p_count, uint32_t p_batchSize, const BatchFunction& p_function);
+
+		/**
+		* Returns the number of threads running the batches of a job (Workers and calling thread)
+		*/
+		static uint32_t GetThreadCount();
+	};
+}
\ No newline at end of file
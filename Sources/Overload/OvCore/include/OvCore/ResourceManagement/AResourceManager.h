@@ -7,14 +7,33 @@
 #pragma once
 
 #include <unordered_map>
+#include <string>
+#include <cstdint>
+#include <future>
+#include <list>
 #include <any>
 
-
-
 namespace OvCore::ResourceManagement
 {
 	/**
-	* Handle the management of various resources of variable type
+	* Memory usage and cache efficiency of a resource manager
+	*/
+	struct ResourceStatistics
+	{
+		size_t		resourceCount	= 0;
+		size_t		memoryUsage		= 0;
+		size_t		memoryBudget	= 0;
+		uint64_t	hits			= 0;
+		uint64_t	misses			= 0;
+		uint64_t	evictions		= 0;
+	};
+
+	/**
+	* Handle the management of various resources of variable type.
+	* Users of a resource should hold a reference to it (See ResourceHandle): project resources whose last reference
+	* is released stay loaded, and are evicted least recently used first when the memory budget of the manager is exceeded.
+	* Eviction deletes the resource: code that only keeps a raw pointer (Scripts, editor panels) must not store it beyond
+	* the current frame, or must hold a ResourceHandle while it does
 	*/
 	template<typename T>
 	class AResourceManager
@@ -26,6 +45,20 @@ namespace OvCore::ResourceManagement
 		*/
 		T* LoadResource(const std::string& p_path);
 
+		/**
+		* Start loading a resource in background and return a future to it (nullptr if the loading failed).
+		* The file is decoded by the ResourceLoader workers, then the resource is created and registered on the main thread
+		* by ResourceLoader::ProcessUploads. Requests for a resource that is already registered or pending share the same result
+		* @param p_path
+		*/
+		std::shared_future<T*> LoadResourceAsync(const std::string& p_path);
+
+		/**
+		* Return true if the resource is being loaded in background
+		* @param p_path
+		*/
+		bool IsResourcePending(const std::string& p_path) const;
+
 		/**
 		* Handle the destruction of a resource and unregister it
 		* @param p_path
@@ -100,17 +133,90 @@ namespace OvCore::ResourceManagement
 		*/
 		std::unordered_map<std::string, T*>& GetResources();
 
+		/**
+		* Add a reference to the given resource, preventing its eviction.
+		* Returns false if the resource isn't registered (The reference isn't tracked then)
+		* @param p_resource
+		*/
+		bool AddReference(T* p_resource);
+
+		/**
+		* Remove a reference to the given resource. A project resource becomes evictable when its last reference is released
+		* (Resources that have never been referenced, and engine resources, are never evicted)
+		* @param p_resource
+		*/
+		void RemoveReference(T* p_resource);
+
+		/**
+		* Returns the number of references to the given resource
+		* @param p_resource
+		*/
+		uint32_t GetReferenceCount(T* p_resource) const;
+
+		/**
+		* Defines the memory that the resources of this manager can use before unreferenced resources get evicted
+		* @param p_budget (In bytes, 0 disables the eviction)
+		*/
+		void SetMemoryBudget(size_t p_budget);
+
+		/**
+		* Returns the memory usage and the cache statistics of the manager
+		*/
+		const ResourceStatistics& GetStatistics() const;
+
 	protected:
 		virtual T* CreateResource(const std::string& p_path) = 0;
 		virtual void DestroyResource(T* p_resource) = 0;
 		virtual void ReloadResource(T* p_resource, const std::string& p_path) = 0;
+
+		/**
+		* Read and decode the resource identified by the given path. Runs on a worker thread, so it must neither
+		* use the graphics context nor access the registered resources (Does nothing by default)
+		* @param p_path
+		*/
+		virtual std::any DecodeResource(const std::string& p_path);
+
+		/**
+		* Create the resource from the data returned by DecodeResource, on the main thread (Calls CreateResource by default)
+		* @param p_path
+		* @param p_decodedData
+		*/
+		virtual T* UploadResource(const std::string& p_path, std::any& p_decodedData);
+
+		/**
+		* Returns the memory used by the given resource, accounted in the memory budget (0 by default)
+		* @param p_resource
+		*/
+		virtual size_t GetResourceSize(T* p_resource) const;
+
 		std::string GetRealPath(const std::string& p_path) const;
 
+	private:
+		struct ResourceUsage
+		{
+			std::string path;
+			size_t size = 0;
+			uint32_t references = 0;
+			bool evictable = false;
+			typename std::list<T*>::iterator evictionPosition;
+		};
+
+		T* FindResource(const std::string& p_path) const;
+		void TrackResource(const std::string& p_path, T* p_resource);
+		void UntrackResource(T* p_resource);
+		void MarkAsUsed(T* p_resource);
+		void EvictResources();
+
 	private:
 		inline static std::string __PROJECT_ASSETS_PATH = "";
 		inline static std::string __ENGINE_ASSETS_PATH = "";
 
 		std::unordered_map<std::string, T*> m_resources;
+		std::unordered_map<std::string, std::shared_future<T*>> m_pendingResources;
+
+		std::unordered_map<T*, ResourceUsage> m_usages;
+		std::list<T*> m_evictableResources; // Least recently used first
+		ResourceStatistics m_statistics;
 	};
 }
 
@@ -7,18 +7,26 @@
 #pragma once
 
 #include <algorithm>
+#include <memory>
 
 #include "OvCore/ResourceManagement/AResourceManager.h"
+#include "OvCore/ResourceManagement/ResourceLoader.h"
 
 namespace OvCore::ResourceManagement
 {
 	template<typename T>
 	inline T* AResourceManager<T>::LoadResource(const std::string & p_path)
 	{
-		if (auto resource = GetResource(p_path, false); resource)
+		if (auto resource = FindResource(p_path); resource)
+		{
+			++m_statistics.hits;
+			MarkAsUsed(resource);
 			return resource;
+		}
 		else
 		{
+			++m_statistics.misses;
+
 			auto newResource = CreateResource(p_path);
 			if (newResource)
 				return RegisterResource(p_path, newResource);
@@ -27,10 +35,67 @@ namespace OvCore::ResourceManagement
 		}
 	}
 
+	template<typename T>
+	inline std::shared_future<T*> AResourceManager<T>::LoadResourceAsync(const std::string& p_path)
+	{
+		if (auto resource = FindResource(p_path); resource)
+		{
+			++m_statistics.hits;
+			MarkAsUsed(resource);
+
+			std::promise<T*> loaded;
+			loaded.set_value(resource);
+			return loaded.get_future().share();
+		}
+
+		if (auto pending = m_pendingResources.find(p_path); pending != m_pendingResources.end())
+		{
+			++m_statistics.hits;
+			return pending->second;
+		}
+
+		++m_statistics.misses;
+
+		auto promise = std::make_shared<std::promise<T*>>();
+		auto result = promise->get_future().share();
+		m_pendingResources.emplace(p_path, result);
+
+		ResourceLoader::Submit([this, p_path, promise]() -> ResourceLoader::UploadTask
+		{
+			auto decodedData = std::make_shared<std::any>(DecodeResource(p_path));
+
+			return [this, p_path, promise, decodedData]
+			{
+				m_pendingResources.erase(p_path);
+
+				/* The resource may have been loaded synchronously in the meantime, the decoded data is then dropped */
+				T* resource = FindResource(p_path);
+
+				if (!resource)
+				{
+					resource = UploadResource(p_path, *decodedData);
+
+					if (resource)
+						RegisterResource(p_path, resource);
+				}
+
+				promise->set_value(resource);
+			};
+		});
+
+		return result;
+	}
+
+	template<typename T>
+	inline bool AResourceManager<T>::IsResourcePending(const std::string& p_path) const
+	{
+		return m_pendingResources.find(p_path) != m_pendingResources.end();
+	}
+
 	template<typename T>
 	inline void AResourceManager<T>::UnloadResource(const std::string & p_path)
 	{
-		if (auto resource = GetResource(p_path, false); resource)
+		if (auto resource = FindResource(p_path); resource)
 		{
 			DestroyResource(resource);
 			UnregisterResource(p_path);
@@ -42,9 +107,13 @@ namespace OvCore::ResourceManagement
 	{
 		if (IsResourceRegistered(p_previousPath) && !IsResourceRegistered(p_newPath))
 		{
+			/* The resource keeps its references and its place in the eviction order */
 			T* toMove = m_resources.at(p_previousPath);
-			UnregisterResource(p_previousPath);
-			RegisterResource(p_newPath, toMove);
+			m_resources.erase(p_previousPath);
+			m_resources[p_newPath] = toMove;
+
+			if (auto usage = m_usages.find(toMove); usage != m_usages.end())
+				usage->second.path = p_newPath;
 			return true;
 		}
 
@@ -54,9 +123,19 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline void AResourceManager<T>::ReloadResource(const std::string& p_path)
 	{
-		if (auto resource = GetResource(p_path, false); resource)
+		if (auto resource = FindResource(p_path); resource)
 		{
 			ReloadResource(resource, p_path);
+
+			/* The reloaded resource may not use the same amount of memory */
+			if (auto usage = m_usages.find(resource); usage != m_usages.end())
+			{
+				const size_t size = GetResourceSize(resource);
+				m_statistics.memoryUsage = m_statistics.memoryUsage - usage->second.size + size;
+				usage->second.size = size;
+			}
+
+			EvictResources();
 		}
 	}
 
@@ -69,19 +148,33 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline void AResourceManager<T>::UnloadResources()
 	{
+		/* Pending uploads would register resources after the clean up otherwise */
+		ResourceLoader::Flush();
+
 		for (auto&[key, value] : m_resources)
 			DestroyResource(value);
 
 		m_resources.clear();
+		m_usages.clear();
+		m_evictableResources.clear();
+		m_statistics.resourceCount = 0;
+		m_statistics.memoryUsage = 0;
 	}
 
 	template<typename T>
 	inline T* AResourceManager<T>::RegisterResource(const std::string& p_path, T* p_instance)
 	{
-		if (auto resource = GetResource(p_path, false); resource)
+		if (auto resource = FindResource(p_path); resource)
+		{
+			UntrackResource(resource);
 			DestroyResource(resource);
+		}
 
 		m_resources[p_path] = p_instance;
+		TrackResource(p_path, p_instance);
+
+		/* The new resource isn't referenced yet, so it can't be evicted by itself */
+		EvictResources();
 
 		return p_instance;
 	}
@@ -89,15 +182,21 @@ namespace OvCore::ResourceManagement
 	template<typename T>
 	inline void AResourceManager<T>::UnregisterResource(const std::string & p_path)
 	{
-		m_resources.erase(p_path);
+		if (auto resource = m_resources.find(p_path); resource != m_resources.end())
+		{
+			UntrackResource(resource->second);
+			m_resources.erase(resource);
+		}
 	}
 
 	template<typename T>
 	inline T* AResourceManager<T>::GetResource(const std::string& p_path, bool p_tryToLoadIfNotFound)
 	{
-		if (auto resource = m_resources.find(p_path); resource != m_resources.end())
+		if (auto resource = FindResource(p_path); resource)
 		{
-			return resource->second;
+			++m_statistics.hits;
+			MarkAsUsed(resource);
+			return resource;
 		}
 		else if (p_tryToLoadIfNotFound)
 		{
@@ -126,6 +225,82 @@ namespace OvCore::ResourceManagement
 		return m_resources;
 	}
 
+	template<typename T>
+	inline bool AResourceManager<T>::AddReference(T* p_resource)
+	{
+		auto usage = m_usages.find(p_resource);
+
+		if (usage == m_usages.end())
+			return false;
+
+		if (usage->second.evictable)
+		{
+			m_evictableResources.erase(usage->second.evictionPosition);
+			usage->second.evictable = false;
+		}
+
+		++usage->second.references;
+
+		return true;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::RemoveReference(T* p_resource)
+	{
+		auto usage = m_usages.find(p_resource);
+
+		if (usage == m_usages.end() || usage->second.references == 0)
+			return;
+
+		if (--usage->second.references == 0 && usage->second.path[0] != ':')
+		{
+			usage->second.evictionPosition = m_evictableResources.insert(m_evictableResources.end(), p_resource);
+			usage->second.evictable = true;
+
+			EvictResources();
+		}
+	}
+
+	template<typename T>
+	inline uint32_t AResourceManager<T>::GetReferenceCount(T* p_resource) const
+	{
+		if (auto usage = m_usages.find(p_resource); usage != m_usages.end())
+			return usage->second.references;
+
+		return 0;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::SetMemoryBudget(size_t p_budget)
+	{
+		m_statistics.memoryBudget = p_budget;
+		EvictResources();
+	}
+
+	template<typename T>
+	inline const ResourceStatistics& AResourceManager<T>::GetStatistics() const
+	{
+		return m_statistics;
+	}
+
+	template<typename T>
+	inline std::any AResourceManager<T>::DecodeResource(const std::string& p_path)
+	{
+		return {};
+	}
+
+	template<typename T>
+	inline T* AResourceManager<T>::UploadResource(const std::string& p_path, std::any& p_decodedData)
+	{
+		return CreateResource(p_path);
+	}
+
+	template<typename T>
+	inline size_t AResourceManager<T>::GetResourceSize(T* p_resource) const
+	{
+		return 0;
+	}
+
 	template<typename T>
 	inline std::string AResourceManager<T>::GetRealPath(const std::string& p_path) const
 	{
@@ -142,4 +317,60 @@ namespace OvCore::ResourceManagement
 
 		return result;
 	}
+
+	template<typename T>
+	inline T* AResourceManager<T>::FindResource(const std::string& p_path) const
+	{
+		if (auto resource = m_resources.find(p_path); resource != m_resources.end())
+			return resource->second;
+
+		return nullptr;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::TrackResource(const std::string& p_path, T* p_resource)
+	{
+		auto& usage = m_usages[p_resource];
+		usage.path = p_path;
+		usage.size = GetResourceSize(p_resource);
+
+		++m_statistics.resourceCount;
+		m_statistics.memoryUsage += usage.size;
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::UntrackResource(T* p_resource)
+	{
+		if (auto usage = m_usages.find(p_resource); usage != m_usages.end())
+		{
+			if (usage->second.evictable)
+				m_evictableResources.erase(usage->second.evictionPosition);
+
+			--m_statistics.resourceCount;
+			m_statistics.memoryUsage -= usage->second.size;
+			m_usages.erase(usage);
+		}
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::MarkAsUsed(T* p_resource)
+	{
+		/* Looking an evictable resource up makes it the most recently used one */
+		if (auto usage = m_usages.find(p_resource); usage != m_usages.end() && usage->second.evictable)
+			m_evictableResources.splice(m_evictableResources.end(), m_evictableResources, usage->second.evictionPosition);
+	}
+
+	template<typename T>
+	inline void AResourceManager<T>::EvictResources()
+	{
+		if (m_statistics.memoryBudget == 0)
+			return;
+
+		while (m_statistics.memoryUsage > m_statistics.memoryBudget && !m_evictableResources.empty())
+		{
+			const std::string path = m_usages.at(m_evictableResources.front()).path;
+			UnloadResource(path);
+			++m_statistics.evictions;
+		}
+	}
 }
\ No newline at end of file
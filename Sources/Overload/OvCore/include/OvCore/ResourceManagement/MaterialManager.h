@@ -35,5 +35,12 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvCore::Resources::Material* p_resource, const std::string& p_path) override;
+
+		/**
+		* Returns the GPU memory of the textures referenced by the material. An unused material keeps its textures
+		* loaded, so evicting it lets the texture manager evict them as well
+		* @param p_resource
+		*/
+		virtual size_t GetResourceSize(OvCore::Resources::Material* p_resource) const override;
 	};
 }
\ No newline at end of file
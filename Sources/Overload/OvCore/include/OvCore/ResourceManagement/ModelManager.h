@@ -36,5 +36,31 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Model* p_resource, const std::string& p_path) override;
+
+		/**
+		* Read the metadata and decode the file of the resource (Called from a worker thread)
+		* @param p_path
+		*/
+		virtual std::any DecodeResource(const std::string& p_path) override;
+
+		/**
+		* Create the resource from decoded data
+		* @param p_path
+		* @param p_decodedData
+		*/
+		virtual OvRendering::Resources::Model* UploadResource(const std::string& p_path, std::any& p_decodedData) override;
+
+		/**
+		* Returns the GPU memory used by the vertex and index buffers of the model
+		* @param p_resource
+		*/
+		virtual size_t GetResourceSize(OvRendering::Resources::Model* p_resource) const override;
+
+		/**
+		* Cook the given model file into a .ovmesh file next to it, using the settings of its .meta file.
+		* Models are loaded from their cooked file as long as it has been cooked from the current source and settings
+		* @param p_filePath (Real path of the model)
+		*/
+		static bool CookModel(const std::string& p_filePath);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,88 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/ResourceManagement/AResourceManager.h"
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Reference to a resource of a resource manager. The resource can't be evicted while a handle references it.
+	* Resources that aren't registered in the manager (Built-in resources for instance) are exposed without being referenced
+	*/
+	template<typename T>
+	class ResourceHandle
+	{
+	public:
+		/**
+		* Create an empty handle
+		*/
+		ResourceHandle() = default;
+
+		/**
+		* Create a handle referencing the given resource
+		* @param p_manager
+		* @param p_resource
+		*/
+		ResourceHandle(AResourceManager<T>& p_manager, T* p_resource);
+
+		/**
+		* Copy constructor (Adds a reference)
+		* @param p_other
+		*/
+		ResourceHandle(const ResourceHandle& p_other);
+
+		/**
+		* Move constructor (Takes the reference of the other handle)
+		* @param p_other
+		*/
+		ResourceHandle(ResourceHandle&& p_other) noexcept;
+
+		/**
+		* Destructor (Releases the reference)
+		*/
+		~ResourceHandle();
+
+		/**
+		* Copy assignment
+		* @param p_other
+		*/
+		ResourceHandle& operator=(const ResourceHandle& p_other);
+
+		/**
+		* Move assignment
+		* @param p_other
+		*/
+		ResourceHandle& operator=(ResourceHandle&& p_other) noexcept;
+
+		/**
+		* Release the reference and empty the handle
+		*/
+		void Reset();
+
+		/**
+		* Returns the referenced resource
+		*/
+		T* Get() const;
+
+		/**
+		* Access the referenced resource
+		*/
+		T* operator->() const;
+
+		/**
+		* Returns true if the handle points to a resource
+		*/
+		explicit operator bool() const;
+
+	private:
+		T* m_resource = nullptr;
+		AResourceManager<T>* m_manager = nullptr; // Null when the resource isn't tracked
+	};
+}
+
+#include "OvCore/ResourceManagement/ResourceHandle.inl"
\ No newline at end of file
@@ -0,0 +1,97 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <utility>
+
+#include "OvCore/ResourceManagement/ResourceHandle.h"
+
+namespace OvCore::ResourceManagement
+{
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(AResourceManager<T>& p_manager, T* p_resource) :
+		m_resource(p_resource)
+	{
+		if (m_resource && p_manager.AddReference(m_resource))
+			m_manager = &p_manager;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(const ResourceHandle& p_other) :
+		m_resource(p_other.m_resource)
+	{
+		if (p_other.m_manager && p_other.m_manager->AddReference(m_resource))
+			m_manager = p_other.m_manager;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::ResourceHandle(ResourceHandle&& p_other) noexcept :
+		m_resource(std::exchange(p_other.m_resource, nullptr)),
+		m_manager(std::exchange(p_other.m_manager, nullptr))
+	{
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::~ResourceHandle()
+	{
+		Reset();
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>& ResourceHandle<T>::operator=(const ResourceHandle& p_other)
+	{
+		if (this != &p_other)
+		{
+			/* The new reference is added first, so a resource referenced by both handles never becomes evictable */
+			ResourceHandle copy(p_other);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>& ResourceHandle<T>::operator=(ResourceHandle&& p_other) noexcept
+	{
+		if (this != &p_other)
+		{
+			Reset();
+			m_resource = std::exchange(p_other.m_resource, nullptr);
+			m_manager = std::exchange(p_other.m_manager, nullptr);
+		}
+
+		return *this;
+	}
+
+	template<typename T>
+	inline void ResourceHandle<T>::Reset()
+	{
+		if (m_manager)
+			m_manager->RemoveReference(m_resource);
+
+		m_resource = nullptr;
+		m_manager = nullptr;
+	}
+
+	template<typename T>
+	inline T* ResourceHandle<T>::Get() const
+	{
+		return m_resource;
+	}
+
+	template<typename T>
+	inline T* ResourceHandle<T>::operator->() const
+	{
+		return m_resource;
+	}
+
+	template<typename T>
+	inline ResourceHandle<T>::operator bool() const
+	{
+		return m_resource != nullptr;
+	}
+}
\ No newline at end of file
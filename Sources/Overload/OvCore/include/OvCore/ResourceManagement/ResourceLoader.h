@@ -0,0 +1,58 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <functional>
+#include <cstdint>
+
+namespace OvCore::ResourceManagement
+{
+	/**
+	* Worker pool shared by the resource managers to load resources in background.
+	* A task runs on a worker thread (File reading, decoding) and returns the part that must run on the thread
+	* owning the graphics context (GPU upload, registration). These uploads are queued until ProcessUploads is called
+	*/
+	class ResourceLoader
+	{
+	public:
+		using UploadTask = std::function<void()>;
+		using DecodeTask = std::function<UploadTask()>;
+
+		/**
+		* Disabled constructor
+		*/
+		ResourceLoader() = delete;
+
+		/**
+		* Queue a task to run on a worker thread. The upload task it returns (If any) is queued for the main thread
+		* @param p_task
+		*/
+		static void Submit(DecodeTask p_task);
+
+		/**
+		* Run the queued uploads until the upload time budget is spent (At least one upload is run per call).
+		* Must be called from the thread owning the graphics context
+		*/
+		static void ProcessUploads();
+
+		/**
+		* Wait for every submitted task and run every upload
+		*/
+		static void Flush();
+
+		/**
+		* Defines the time ProcessUploads can spend per call (In seconds)
+		* @param p_budget
+		*/
+		static void SetUploadTimeBudget(float p_budget);
+
+		/**
+		* Returns the number of submitted tasks that are not uploaded yet
+		*/
+		static uint32_t GetPendingCount();
+	};
+}
\ No newline at end of file
@@ -36,5 +36,37 @@ namespace OvCore::ResourceManagement
 		* @param p_path
 		*/
 		virtual void ReloadResource(OvRendering::Resources::Texture* p_resource, const std::string& p_path) override;
+
+		/**
+		* Read the metadata and decode the file of the resource (Called from a worker thread)
+		* @param p_path
+		*/
+		virtual std::any DecodeResource(const std::string& p_path) override;
+
+		/**
+		* Create the resource from decoded data
+		* @param p_path
+		* @param p_decodedData
+		*/
+		virtual OvRendering::Resources::Texture* UploadResource(const std::string& p_path, std::any& p_decodedData) override;
+
+		/**
+		* Returns the GPU memory used by the texture, mip levels included
+		* @param p_resource
+		*/
+		virtual size_t GetResourceSize(OvRendering::Resources::Texture* p_resource) const override;
+
+		/**
+		* Cook the given image file into a .ovtex file next to it (Mip chain and compression), using the settings of its .meta file.
+		* Textures are loaded from their cooked file as long as it has been cooked from the current source and settings
+		* @param p_filePath (Real path of the texture)
+		*/
+		static bool CookTexture(const std::string& p_filePath);
+
+		/**
+		* Returns the GPU memory used by the given texture, mip levels included
+		* @param p_texture
+		*/
+		static size_t GetTextureSize(const OvRendering::Resources::Texture& p_texture);
 	};
 }
\ No newline at end of file
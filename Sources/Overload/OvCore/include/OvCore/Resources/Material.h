@@ -10,8 +10,10 @@
 #include <map>
 
 #include <OvRendering/Resources/Shader.h>
+#include <OvRendering/Resources/Texture.h>
 
 #include "OvCore/API/ISerializable.h"
+#include "OvCore/ResourceManagement/ResourceHandle.h"
 
 
 namespace OvCore::Resources
@@ -36,8 +38,9 @@ namespace OvCore::Resources
 		/**
 		* Bind the material and send its uniform data to the GPU
 		* @parma p_emptyTexture (The texture to use if a texture uniform is nullptr)
+		* @param p_bindShader (Can be set to false if the material shader is already bound)
 		*/
-		void Bind(OvRendering::Resources::Texture* p_emptyTexture);
+		void Bind(OvRendering::Resources::Texture* p_emptyTexture, bool p_bindShader = true);
 
 		/**
 		* Unbind the material
@@ -154,6 +157,12 @@ namespace OvCore::Resources
 		*/
 		std::map<std::string, std::any>& GetUniformsData();
 
+		/**
+		* Reference the textures used by the uniforms data, and release the ones that aren't used anymore.
+		* Must be called after modifying texture uniforms through GetUniformsData()
+		*/
+		void UpdateTextureReferences();
+
 		/**
 		* Serialize the material
 		* @param p_doc
@@ -173,6 +182,7 @@ namespace OvCore::Resources
 	private:
 		OvRendering::Resources::Shader* m_shader = nullptr;
 		std::map<std::string, std::any> m_uniformsData;
+		std::map<std::string, ResourceManagement::ResourceHandle<OvRendering::Resources::Texture>> m_textureReferences;
 
 		bool m_blendable		= false;
 		bool m_backfaceCulling	= true;
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include <OvDebug/Logger.h>
 
 #include "OvCore/Resources/Material.h"
@@ -18,7 +20,12 @@ namespace OvCore::Resources
 		if (HasShader())
 		{
 			if (m_uniformsData.find(p_key) != m_uniformsData.end())
+			{
 				m_uniformsData[p_key] = std::any(p_value);
+
+				if constexpr (std::is_same_v<T, OvRendering::Resources::Texture*>)
+					UpdateTextureReferences();
+			}
 		}
 		else
 		{
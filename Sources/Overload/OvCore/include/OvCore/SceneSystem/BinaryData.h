@@ -0,0 +1,131 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <OvMaths/FVector3.h>
+
+#include "OvCore/SceneSystem/BinaryScene.h"
+
+namespace OvCore::SceneSystem
+{
+	/**
+	* Serialized data of a component or a behaviour in a binary scene, read in place from the data nodes of the scene.
+	* Mirrors the Serializer helpers: a value is read from the node carrying the given name, at the root of the data
+	*/
+	class BinaryData
+	{
+	public:
+		/**
+		* Create a view over the given range of data nodes
+		* @param p_scene
+		* @param p_firstNode
+		* @param p_nodeCount
+		*/
+		BinaryData(const BinaryScene& p_scene, uint32_t p_firstNode, uint32_t p_nodeCount);
+
+		/**
+		* Returns true if a node with the given name exists
+		* @param p_name
+		*/
+		bool Has(const std::string& p_name) const;
+
+		/**
+		* Read the given boolean, the output is left unchanged if the node doesn't exist
+		* @param p_name
+		* @param p_out
+		*/
+		void ReadBoolean(const std::string& p_name, bool& p_out) const;
+
+		/**
+		* Read the given integer, the output is left unchanged if the node doesn't exist
+		* @param p_name
+		* @param p_out
+		*/
+		void ReadInt(const std::string& p_name, int& p_out) const;
+
+		/**
+		* Read the given float, the output is left unchanged if the node doesn't exist
+		* @param p_name
+		* @param p_out
+		*/
+		void ReadFloat(const std::string& p_name, float& p_out) const;
+
+		/**
+		* Read the given vector, the components of the output are left unchanged if their node doesn't exist
+		* @param p_name
+		* @param p_out
+		*/
+		void ReadVec3(const std::string& p_name, OvMaths::FVector3& p_out) const;
+
+		/**
+		* Read the given string, the output is left unchanged if the node doesn't exist
+		* @param p_name
+		* @param p_out
+		*/
+		void ReadString(const std::string& p_name, std::string& p_out) const;
+
+		/**
+		* Returns the given boolean (false if the node doesn't exist)
+		* @param p_name
+		*/
+		bool ReadBoolean(const std::string& p_name) const;
+
+		/**
+		* Returns the given integer (0 if the node doesn't exist)
+		* @param p_name
+		*/
+		int ReadInt(const std::string& p_name) const;
+
+		/**
+		* Returns the given float (0 if the node doesn't exist)
+		* @param p_name
+		*/
+		float ReadFloat(const std::string& p_name) const;
+
+		/**
+		* Returns the given vector (Zero for the components that don't exist)
+		* @param p_name
+		*/
+		OvMaths::FVector3 ReadVec3(const std::string& p_name) const;
+
+		/**
+		* Returns the given string (Empty if the node doesn't exist)
+		* @param p_name
+		*/
+		std::string ReadString(const std::string& p_name) const;
+
+		/**
+		* Returns the texts of the children of the given node, in order (Empty if the node doesn't exist)
+		* @param p_name
+		*/
+		std::vector<std::string> ReadStringList(const std::string& p_name) const;
+
+		/**
+		* Returns the data of the children of the given node (Empty if the node doesn't exist)
+		* @param p_name
+		*/
+		BinaryData GetChild(const std::string& p_name) const;
+
+		/**
+		* Recreate the data as XML elements under the given node (For components that only implement OnDeserialize)
+		* @param p_doc
+		* @param p_parent
+		*/
+		void BuildNodes(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent) const;
+
+	private:
+		const BinaryScene::NodeRecord* Find(const std::string& p_name, uint32_t* p_index = nullptr) const;
+
+	private:
+		const BinaryScene& m_scene;
+		uint32_t m_firstNode;
+		uint32_t m_nodeCount;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include <OvTools/Filesystem/tinyxml2.h>
+#include <OvTools/Utils/PathParser.h>
+
+namespace OvCore::SceneSystem
+{
+	/**
+	* Read-only view of a compiled (Binary) scene. The view doesn't copy the data, which is usually a memory-mapped file:
+	* records are read in place and strings point into the string table.
+	* Binary scenes are compiled from the XML produced by the ISerializable interface, so any component serializes the same
+	* way in both formats. Components are identified by their name (AComponent::GetName). Layout (Little endian, every chunk 8 bytes aligned):
+	* - Header and chunk table
+	* - STRS: Deduplicated, null terminated strings (Names, tags, types, node names and texts)
+	* - ACTR: An ActorRecord per actor, in scene order
+	* - TRSF: A TransformRecord per actor, stored as raw floats
+	* - CMPS: A block of ComponentRecord per component type
+	* - BHVR: A BehaviourRecord per behaviour, grouped by actor
+	* - NODE: Serialized data of the components and behaviours, as a pre-order list of NodeRecord (Numbers and booleans are
+	*   also stored parsed, so BinaryData can read them without going through XML)
+	* - RSRC: Resources referenced by the scene (Can be used to prefetch them)
+	*/
+	class BinaryScene
+	{
+	public:
+		static constexpr uint32_t VERSION = 3;
+
+		struct ActorRecord
+		{
+			int64_t		id;
+			int64_t		parent;
+			uint32_t	name;
+			uint32_t	tag;
+			uint32_t	active;
+			uint32_t	padding;
+		};
+
+		struct TransformRecord
+		{
+			uint32_t	actor;
+			uint32_t	order;
+			float		position[3];
+			float		rotation[4];
+			float		scale[3];
+		};
+
+		struct ComponentRecord
+		{
+			uint32_t	actor;
+			uint32_t	order;
+			uint32_t	firstNode;
+			uint32_t	nodeCount;
+		};
+
+		struct BehaviourRecord
+		{
+			uint32_t	actor;
+			uint32_t	type;
+			uint32_t	firstNode;
+			uint32_t	nodeCount;
+		};
+
+		struct NodeRecord
+		{
+			uint32_t	name;
+			uint32_t	text;
+			uint32_t	childCount;
+			float		value;
+		};
+
+		struct ResourceRecord
+		{
+			uint32_t								path;
+			OvTools::Utils::PathParser::EFileType	type;
+		};
+
+		/**
+		* Contiguous records read in place
+		*/
+		template<typename T>
+		struct Records
+		{
+			const T*	data	= nullptr;
+			uint32_t	count	= 0;
+
+			const T* begin() const	{ return data; }
+			const T* end() const	{ return data + count; }
+			const T& operator[](size_t p_index) const { return data[p_index]; }
+		};
+
+		/**
+		* Components of a given type
+		*/
+		struct ComponentBlock
+		{
+			const char*					type;
+			Records<ComponentRecord>	components;
+		};
+
+		/**
+		* A component of an actor, in the order the actor serialized it
+		*/
+		struct ComponentEntry
+		{
+			const char*				type;
+			const TransformRecord*	transform;	// Not null for the transform of the actor
+			const ComponentRecord*	component;	// Not null for any other component
+		};
+
+		/**
+		* Create a view over the given data (Check IsValid() before using the view)
+		* @param p_data
+		* @param p_size
+		*/
+		BinaryScene(const char* p_data, size_t p_size);
+
+		/**
+		* Returns true if the given data starts with the binary scene signature
+		* @param p_data
+		* @param p_size
+		*/
+		static bool IsBinaryScene(const char* p_data, size_t p_size);
+
+		/**
+		* Returns true if the data is a well-formed binary scene of the supported version
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the string at the given index of the string table
+		* @param p_index
+		*/
+		const char* GetString(uint32_t p_index) const;
+
+		/**
+		* Returns the actors of the scene
+		*/
+		const Records<ActorRecord>& GetActors() const;
+
+		/**
+		* Returns the transforms of the actors
+		*/
+		const Records<TransformRecord>& GetTransforms() const;
+
+		/**
+		* Returns the components of the scene (Transforms excepted), grouped by type
+		*/
+		const std::vector<ComponentBlock>& GetComponentBlocks() const;
+
+		/**
+		* Returns the behaviours of the scene, grouped by actor
+		*/
+		const Records<BehaviourRecord>& GetBehaviours() const;
+
+		/**
+		* Returns the resources referenced by the scene
+		*/
+		const Records<ResourceRecord>& GetResources() const;
+
+		/**
+		* Returns the data nodes of the components and behaviours, in pre-order
+		*/
+		const Records<NodeRecord>& GetNodes() const;
+
+		/**
+		* Returns the components of every actor (Transforms included), grouped by actor and in serialization order
+		* @param p_actorOffsets (Receives the index of the first entry of each actor, followed by the number of entries)
+		*/
+		std::vector<ComponentEntry> GetOrderedComponents(std::vector<uint32_t>& p_actorOffsets) const;
+
+		/**
+		* Recreate the given range of data nodes as XML elements under the given node, as the component or behaviour serialized them
+		* @param p_doc
+		* @param p_parent
+		* @param p_firstNode
+		* @param p_nodeCount
+		*/
+		void BuildNodes(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent, uint32_t p_firstNode, uint32_t p_nodeCount) const;
+
+		/**
+		* Write the XML equivalent of the binary scene into the given document
+		* @param p_doc
+		*/
+		void Decompile(tinyxml2::XMLDocument& p_doc) const;
+
+		/**
+		* Compile an XML scene document into a binary scene. Returns an empty buffer if the document isn't a scene
+		* @param p_doc
+		*/
+		static std::vector<char> Compile(tinyxml2::XMLDocument& p_doc);
+
+		/**
+		* Compile the given XML scene file into a binary scene file (Both paths can be the same)
+		* @param p_sourcePath
+		* @param p_destinationPath
+		*/
+		static bool CompileFile(const std::string& p_sourcePath, const std::string& p_destinationPath);
+
+		/**
+		* Decompile the given binary scene file into an XML scene file (Both paths can be the same)
+		* @param p_sourcePath
+		* @param p_destinationPath
+		*/
+		static bool DecompileFile(const std::string& p_sourcePath, const std::string& p_destinationPath);
+
+	private:
+		bool Parse();
+		void BuildNode(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent, uint32_t& p_index, uint32_t p_end, uint32_t p_depth) const;
+
+	private:
+		const char*						m_data;
+		size_t							m_size;
+		bool							m_valid = false;
+
+		const uint32_t*					m_stringOffsets = nullptr;
+		uint32_t						m_stringCount = 0;
+		const char*						m_stringData = nullptr;
+
+		Records<ActorRecord>			m_actors;
+		Records<TransformRecord>		m_transforms;
+		std::vector<ComponentBlock>		m_componentBlocks;
+		Records<BehaviourRecord>		m_behaviours;
+		Records<NodeRecord>				m_nodes;
+		Records<ResourceRecord>			m_resources;
+	};
+}
\ No newline at end of file
@@ -6,9 +6,16 @@
 
 #pragma once
 
+#include <unordered_map>
+#include <map>
+
+#include <OvRendering/Data/Frustum.h>
+#include <OvRendering/Geometry/BoundingSphereArray.h>
+#include <OvRendering/Geometry/DynamicAABBTree.h>
 
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/API/ISerializable.h"
+#include "OvCore/SceneSystem/BinaryScene.h"
 
 #include "OvCore/ECS/Components/CModelRenderer.h"
 #include "OvCore/ECS/Components/CCamera.h"
@@ -54,23 +61,33 @@ namespace OvCore::SceneSystem
 		bool IsPlaying() const;
 
 		/**
-		* Update every actors
+		* Update every actors. Components are updated type by type, components declaring a ParallelUpdate
+		* run on the job system workers (Transforms are resolved before, so they can be read there).
+		* Behaviours are updated afterward on the main thread, actor by actor: every native component of the scene
+		* is updated before the first behaviour
 		* @param p_deltaTime
 		*/
 		void Update(float p_deltaTime);
 
 		/**
-		* Update every actors 60 frames per seconds
+		* Update every actors 60 frames per seconds (Scheduled like Update)
 		* @param p_deltaTime
 		*/
 		void FixedUpdate(float p_deltaTime);
 
 		/**
-		* Update every actors lately
+		* Update every actors lately (Scheduled like Update)
 		* @param p_deltaTime
 		*/
 		void LateUpdate(float p_deltaTime);
 
+		/**
+		* Recompute the world matrices of every transform modified since the last call.
+		* Should be called once per frame, after the scene updates, so the transforms are resolved in a single pass
+		* instead of lazily by whichever system reads a transform first
+		*/
+		void ResolveTransforms();
+
 		/**
 		* Create an actor with a default name and return a reference to it.
 		*/
@@ -78,13 +95,15 @@ namespace OvCore::SceneSystem
 
 		/**
 		* Create an actor with the given name and return a reference to it.
+		* An actor created while the actors are updated joins GetActors() once the update is over
 		* @param p_name
 		* @param p_tag
 		*/
 		ECS::Actor& CreateActor(const std::string& p_name, const std::string& p_tag = "");
 
 		/**
-		* Destroy and actor and return true on success
+		* Destroy and actor and return true on success.
+		* An actor destroyed while the actors are updated is destroyed once the update is over
 		* @param p_target (The actor to remove from the scene)
 		*/
 		bool DestroyActor(ECS::Actor& p_target);
@@ -146,6 +165,45 @@ namespace OvCore::SceneSystem
 		*/
 		const FastAccessComponents& GetFastAccessComponents() const;
 
+		/**
+		* Call the given function with every component of type T owned by the scene actors.
+		* Components deriving from T are included when T is listed in their ComponentBases.
+		* The order isn't stable, and components must not be added or removed during the iteration
+		* @param p_function (Called with a T&)
+		*/
+		template<typename T, typename Func>
+		void ForEachComponent(Func p_function) const;
+
+		/**
+		* Call the given function with every pair of components of types T and U owned by a same actor.
+		* The smallest of the two pools is iterated, the other component is fetched from the owner
+		* @param p_function (Called with a T& and a U&)
+		*/
+		template<typename T, typename U, typename Func>
+		void ForEachComponentPair(Func p_function) const;
+
+		/**
+		* Returns the number of components of type T owned by the scene actors
+		*/
+		template<typename T>
+		size_t GetComponentCount() const;
+
+		/**
+		* Fill the given vector with the model renderers whose bounding sphere is in the given frustum.
+		* Model renderers with a disabled frustum culling are always included, the activity of the owners isn't checked
+		* @param p_frustum
+		* @param p_result
+		*/
+		void FindModelRenderersInFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<ECS::Components::CModelRenderer*>& p_result) const;
+
+		/**
+		* Fill the given vector with the lights whose effect range is in the given frustum.
+		* Lights with an infinite effect range are always included, the activity of the owners isn't checked
+		* @param p_frustum
+		* @param p_result
+		*/
+		void FindLightsInFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<ECS::Components::CLight*>& p_result) const;
+
 		/**
 		* Serialize the scene
 		* @param p_doc
@@ -160,11 +218,137 @@ namespace OvCore::SceneSystem
 		*/
 		virtual void OnDeserialize(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_root) override;
 
+		/**
+		* Deserialize the scene from a compiled scene. Actors and transforms are read in place,
+		* other components receive their serialized data the same way as with OnDeserialize
+		* @param p_binaryScene
+		*/
+		void DeserializeBinary(const BinaryScene& p_binaryScene);
+
+	private:
+		/**
+		* Spatial index entry of a model renderer. Slots are stable: they are reused, never shifted
+		*/
+		struct ModelSlot
+		{
+			ECS::Components::CModelRenderer* modelRenderer = nullptr;
+			OvTools::Eventing::ListenerID boundsListener = 0;
+			int32_t proxy = OvRendering::Geometry::DynamicAABBTree::NULL_NODE;
+			bool unbounded = false;
+			bool dirty = false;
+		};
+
+		/**
+		* Spatial index entry of a light, reused the same way as model slots
+		*/
+		struct LightSlot
+		{
+			ECS::Components::CLight* light = nullptr;
+			OvTools::Eventing::ListenerID boundsListener = 0;
+			int32_t proxy = OvRendering::Geometry::DynamicAABBTree::NULL_NODE;
+			bool unbounded = false;
+			bool dirty = false;
+		};
+
+		/**
+		* Dense storage of the components of a type. Removal moves the last component in place of the removed one
+		*/
+		struct ComponentPool
+		{
+			std::vector<ECS::Components::AComponent*> components;
+			std::unordered_map<ECS::Components::AComponent*, size_t> indices;
+		};
+
+		const ComponentPool* GetComponentPool(ECS::ComponentTypeID p_typeID) const;
+
+		/**
+		* Component types updated together. The types of a parallel stage don't write anything another one accesses
+		*/
+		struct UpdateStage
+		{
+			bool parallel = false;
+			std::vector<ECS::ComponentTypeID> types;
+		};
+
+		using UpdateCallback = void(ECS::Components::AComponent::*)(float);
+
+		void UpdateActors(UpdateCallback p_callback, ECS::Components::Behaviour::EHook p_hook, float p_deltaTime);
+		void BuildUpdateStages();
+		void BeginActorsIteration();
+		void EndActorsIteration();
+
+		/**
+		* Actors sharing a key, ordered by creation (Same order as m_actors)
+		*/
+		using ActorsByCreation = std::map<uint64_t, ECS::Actor*>;
+
+		void IndexActor(ECS::Actor& p_actor);
+		void UnindexActor(ECS::Actor& p_actor);
+		void OnActorNameChanged(ECS::Actor& p_actor, const std::string& p_previousName);
+		void OnActorTagChanged(ECS::Actor& p_actor, const std::string& p_previousTag);
+		void OnActorIDChanged(ECS::Actor& p_actor, int64_t p_previousID);
+
+		void AddModelSlot(ECS::Components::CModelRenderer& p_modelRenderer);
+		void RemoveModelSlot(ECS::Components::CModelRenderer& p_modelRenderer);
+		void UpdateModelSlots() const;
+		void AddLightSlot(ECS::Components::CLight& p_light);
+		void RemoveLightSlot(ECS::Components::CLight& p_light);
+		void UpdateLightSlots() const;
+
 	private:
 		int64_t m_availableID = 1;
 		bool m_isPlaying = false;
 		std::vector<ECS::Actor*> m_actors;
 
+		/* Actors created or destroyed while m_actors is iterated, applied at the end of the iteration */
+		bool m_iteratingActors = false;
+		std::vector<ECS::Actor*> m_createdDuringIteration;
+		std::vector<ECS::Actor*> m_destroyedDuringIteration;
+
+		/* Lookup indices, kept up to date by the change events of the actors */
+		uint64_t m_createdActors = 0;
+		std::unordered_map<const ECS::Actor*, uint64_t> m_actorsCreationOrder;
+		std::unordered_map<int64_t, ActorsByCreation> m_actorsByID;
+		std::unordered_map<std::string, ActorsByCreation> m_actorsByName;
+		std::unordered_map<std::string, ActorsByCreation> m_actorsByTag;
+
 		FastAccessComponents m_fastAccessComponents;
+		std::vector<ComponentPool> m_componentPools;
+
+		/* Update schedule, rebuilt when a component type appears. The batch is reused by every stage */
+		std::vector<UpdateStage> m_updateStages;
+		std::vector<const ECS::ComponentUpdateAccess*> m_updateAccesses;
+		std::vector<ECS::Components::AComponent*> m_updateBatch;
+		bool m_updateStagesChanged = false;
+
+		/*
+		* Spatial index of the model renderers, updated lazily by the queries. Only the slots of the model renderers
+		* that notified a change are refreshed. The bounding spheres array is indexed by slot
+		*/
+		mutable std::vector<ModelSlot> m_modelSlots;
+		std::vector<uint32_t> m_freeModelSlots;
+		mutable std::vector<uint32_t> m_dirtyModelSlots;
+		mutable std::vector<uint32_t> m_unboundedModelSlots;
+		mutable std::vector<uint32_t> m_queryResults;
+		mutable OvRendering::Geometry::BoundingSphereArray m_modelBoundingSpheres;
+		mutable OvRendering::Geometry::DynamicAABBTree m_modelTree;
+
+		/* Bounding spheres of the tree query candidates (Indexed like m_queryResults) and the visible ones among them */
+		mutable OvRendering::Geometry::BoundingSphereArray m_candidateBoundingSpheres;
+		mutable std::vector<uint32_t> m_visibleCandidates;
+		std::unordered_map<ECS::Components::CModelRenderer*, uint32_t> m_modelSlotIndices;
+
+		/*
+		* Spatial index of the lights, updated lazily like the model renderers one. Lights with an infinite effect
+		* range (Directional lights) aren't in the tree, they are listed apart
+		*/
+		mutable std::vector<LightSlot> m_lightSlots;
+		std::vector<uint32_t> m_freeLightSlots;
+		mutable std::vector<uint32_t> m_dirtyLightSlots;
+		mutable std::vector<uint32_t> m_unboundedLightSlots;
+		mutable OvRendering::Geometry::DynamicAABBTree m_lightTree;
+		std::unordered_map<ECS::Components::CLight*, uint32_t> m_lightSlotIndices;
 	};
-}
\ No newline at end of file
+}
+
+#include "OvCore/SceneSystem/Scene.inl"
\ No newline at end of file
@@ -0,0 +1,50 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include "OvCore/SceneSystem/Scene.h"
+
+namespace OvCore::SceneSystem
+{
+	template<typename T, typename Func>
+	inline void Scene::ForEachComponent(Func p_function) const
+	{
+		if (auto pool = GetComponentPool(ECS::GetComponentTypeID<T>()))
+		{
+			for (auto component : pool->components)
+				p_function(*static_cast<T*>(component));
+		}
+	}
+
+	template<typename T, typename U, typename Func>
+	inline void Scene::ForEachComponentPair(Func p_function) const
+	{
+		if (GetComponentCount<T>() <= GetComponentCount<U>())
+		{
+			ForEachComponent<T>([&p_function](T& p_first)
+			{
+				if (auto second = p_first.owner.template GetComponent<U>())
+					p_function(p_first, *second);
+			});
+		}
+		else
+		{
+			ForEachComponent<U>([&p_function](U& p_second)
+			{
+				if (auto first = p_second.owner.template GetComponent<T>())
+					p_function(*first, p_second);
+			});
+		}
+	}
+
+	template<typename T>
+	inline size_t Scene::GetComponentCount() const
+	{
+		auto pool = GetComponentPool(ECS::GetComponentTypeID<T>());
+		return pool ? pool->components.size() : 0;
+	}
+}
\ No newline at end of file
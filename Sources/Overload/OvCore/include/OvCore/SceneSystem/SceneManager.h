@@ -6,7 +6,8 @@
 
 #pragma once
 
-
+#include <future>
+#include <memory>
 
 #include "OvCore/SceneSystem/Scene.h"
 
@@ -31,12 +32,12 @@ namespace OvCore::SceneSystem
 		~SceneManager();
 
 		/**
-		* Update
+		* Update (Advances the asynchronous scene loading, if any)
 		*/
 		void Update();
 
 		/**
-		* Load an play a scene with a delay
+		* Load and play a scene asynchronously (The current scene keeps running until the new one is ready)
 		* @param p_path
 		* @param p_absolute
 		*/
@@ -59,12 +60,44 @@ namespace OvCore::SceneSystem
 		*/
 		bool LoadScene(const std::string& p_path, bool p_absolute = false);
 
+		/**
+		* Start loading a scene in background. The file is read and compiled on a worker thread, then the resources
+		* referenced by the scene are loaded through the ResourceLoader. Once every resource is ready, Update() swaps
+		* the scene with the current one and calls the given callback. A previous asynchronous load is cancelled
+		* @param p_path
+		* @param p_absolute (If this setting is set to true, the scene loader will ignore the "SceneRootFolder" given on SceneManager construction)
+		* @param p_onLoaded (Optional)
+		*/
+		void LoadSceneAsync(const std::string& p_path, bool p_absolute = false, std::function<void()> p_onLoaded = nullptr);
+
+		/**
+		* Cancel the asynchronous scene load, if any: the scene won't be swapped in and its callback won't be called.
+		* Loading a scene by any other mean cancels it too
+		*/
+		void CancelAsyncLoad();
+
+		/**
+		* Return true if an asynchronous scene load is in progress
+		*/
+		bool IsLoadingScene() const;
+
+		/**
+		* Return the progress of the asynchronous scene load, between 0 and 1
+		*/
+		float GetSceneLoadingProgress() const;
+
 		/**
 		* Load specific scene in memory
 		* @param p_scenePath
 		*/
 		bool LoadSceneFromMemory(tinyxml2::XMLDocument& p_doc);
 
+		/**
+		* Load specific compiled scene in memory
+		* @param p_binaryScene
+		*/
+		bool LoadSceneFromMemory(const BinaryScene& p_binaryScene);
+
 		/**
 		* Destroy current scene from memory
 		*/
@@ -105,6 +138,26 @@ namespace OvCore::SceneSystem
 		OvTools::Eventing::Event<> SceneLoadEvent;
 		OvTools::Eventing::Event<> SceneUnloadEvent;
 		OvTools::Eventing::Event<const std::string&> CurrentSceneSourcePathChangedEvent;
+		OvTools::Eventing::Event<float> SceneLoadProgressEvent;
+
+	private:
+		/**
+		* State of an asynchronous scene load
+		*/
+		struct AsyncSceneLoad
+		{
+			std::string path;
+			std::function<void()> onLoaded;
+			std::future<std::vector<char>> compilation;
+			std::vector<char> data;
+			std::unique_ptr<BinaryScene> scene;
+			std::vector<std::function<bool()>> pendingResources;
+			uint32_t resourceCount = 0;
+			float progress = 0.0f;
+		};
+
+		void UpdateAsyncLoad();
+		void SetSceneLoadingProgress(float p_progress);
 
 	private:
 		const std::string m_sceneRootFolder;
@@ -113,6 +166,6 @@ namespace OvCore::SceneSystem
 		bool m_currentSceneLoadedFromPath = false;
 		std::string m_currentSceneSourcePath = "";
 
-		std::function<void()> m_delayedLoadCall;
+		std::unique_ptr<AsyncSceneLoad> m_asyncLoad;
 	};
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <filesystem>
 
 #include <sol.hpp>
 
@@ -15,7 +18,9 @@
 namespace OvCore::Scripting
 {
 	/**
-	* Handles script interpretation
+	* Handles script interpretation. Every script file is compiled once into a chunk, which is run again
+	* to instantiate the table of each behaviour using the script.
+	* Scripts listed in the manifest of the script folder (See CompileScripts) are loaded from their bytecode
 	*/
 	class ScriptInterpreter
 	{
@@ -41,6 +46,12 @@ namespace OvCore::Scripting
 		*/
 		void DestroyLuaContext();
 
+		/**
+		* Replace the lua context with a new one, so every global is reset, and register the behaviours again.
+		* Scripts unchanged since they have been compiled are loaded again from their bytecode instead of being parsed
+		*/
+		void ResetLuaContext();
+
 		/**
 		* Consider a behaviour
 		* @param p_toConsider
@@ -48,13 +59,14 @@ namespace OvCore::Scripting
 		void Consider(OvCore::ECS::Components::Behaviour* p_toConsider);
 
 		/**
-		* Unconsider a behaviour
+		* Unconsider a behaviour. Other behaviours keep their table
 		* @param p_toUnconsider
 		*/
 		void Unconsider(OvCore::ECS::Components::Behaviour* p_toUnconsider);
 
 		/**
-		* Refresh every scripts
+		* Recompile the scripts modified since they have been compiled, and register again the behaviours
+		* using them or that failed to register
 		*/
 		void RefreshAll();
 
@@ -63,8 +75,29 @@ namespace OvCore::Scripting
 		*/
 		bool IsOk() const;
 
+		/**
+		* Compile every script of the given folder to Lua bytecode, remove their sources and write the manifest listing them.
+		* Scripts failing to compile keep their sources. Returns false if a script failed to compile
+		* @param p_scriptFolder
+		*/
+		static bool CompileScripts(const std::string& p_scriptFolder);
+
+	private:
+		struct CompiledScript
+		{
+			std::filesystem::file_time_type lastWriteTime;
+			sol::protected_function chunk;
+		};
+
+		std::string GetScriptPath(const std::string& p_name) const;
+		const sol::protected_function* GetCompiledScript(const std::string& p_name);
+		void RegisterBehaviours();
+		bool RegisterBehaviour(OvCore::ECS::Components::Behaviour& p_behaviour);
+
 	private:
 		std::unique_ptr<sol::state> m_luaState;
+		std::unordered_map<std::string, CompiledScript> m_compiledScripts;
+		std::unordered_set<std::string> m_bytecodeScripts;
 		std::string m_scriptRootFolder;
 		std::vector<OvCore::ECS::Components::Behaviour*> m_behaviours;
 		bool m_isOk;
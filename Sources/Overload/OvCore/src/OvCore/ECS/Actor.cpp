@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <unordered_map>
 
 #include "OvCore/ECS/Actor.h"
 
@@ -22,6 +23,67 @@
 #include "OvCore/ECS/Components/CAmbientBoxLight.h"
 #include "OvCore/ECS/Components/CAmbientSphereLight.h"
 
+namespace
+{
+	using namespace OvCore::ECS;
+	using namespace OvCore::ECS::Components;
+
+	using ComponentFactory = AComponent*(*)(Actor&);
+
+	struct ComponentRegistration
+	{
+		std::string serializationID;
+		ComponentFactory factory;
+	};
+
+	template<typename T>
+	AComponent* CreateComponent(Actor& p_actor)
+	{
+		return &p_actor.AddComponent<T>();
+	}
+
+	AComponent* GetTransform(Actor& p_actor)
+	{
+		return &p_actor.transform;
+	}
+
+	template<typename T>
+	void RegisterComponent(std::unordered_map<std::string, ComponentRegistration>& p_registry, ComponentFactory p_factory)
+	{
+		/* Scenes saved before the serialization identifiers were written with the typeid name of the component */
+		p_registry[T::SERIALIZATION_ID] = { T::SERIALIZATION_ID, p_factory };
+		p_registry[typeid(T).name()] = { T::SERIALIZATION_ID, p_factory };
+	}
+
+	/* Components are serialized with their serialization identifier (AComponent::GetSerializationID) */
+	const std::unordered_map<std::string, ComponentRegistration>& GetComponentRegistry()
+	{
+		static const auto registry = []
+		{
+			std::unordered_map<std::string, ComponentRegistration> result;
+
+			RegisterComponent<CTransform>(result,			&GetTransform);
+			RegisterComponent<CPhysicalBox>(result,			&CreateComponent<CPhysicalBox>);
+			RegisterComponent<CPhysicalSphere>(result,		&CreateComponent<CPhysicalSphere>);
+			RegisterComponent<CPhysicalCapsule>(result,		&CreateComponent<CPhysicalCapsule>);
+			RegisterComponent<CModelRenderer>(result,		&CreateComponent<CModelRenderer>);
+			RegisterComponent<CCamera>(result,				&CreateComponent<CCamera>);
+			RegisterComponent<CMaterialRenderer>(result,	&CreateComponent<CMaterialRenderer>);
+			RegisterComponent<CAudioSource>(result,			&CreateComponent<CAudioSource>);
+			RegisterComponent<CAudioListener>(result,		&CreateComponent<CAudioListener>);
+			RegisterComponent<CPointLight>(result,			&CreateComponent<CPointLight>);
+			RegisterComponent<CDirectionalLight>(result,	&CreateComponent<CDirectionalLight>);
+			RegisterComponent<CSpotLight>(result,			&CreateComponent<CSpotLight>);
+			RegisterComponent<CAmbientBoxLight>(result,		&CreateComponent<CAmbientBoxLight>);
+			RegisterComponent<CAmbientSphereLight>(result,	&CreateComponent<CAmbientSphereLight>);
+
+			return result;
+		}();
+
+		return registry;
+	}
+}
+
 OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::DestroyedEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&> OvCore::ECS::Actor::CreatedEvent;
 OvTools::Eventing::Event<OvCore::ECS::Actor&, OvCore::ECS::Actor&> OvCore::ECS::Actor::AttachEvent;
@@ -76,12 +138,22 @@ const std::string & OvCore::ECS::Actor::GetTag() const
 
 void OvCore::ECS::Actor::SetName(const std::string & p_name)
 {
-	m_name = p_name;
+	if (p_name != m_name)
+	{
+		const std::string previousName = std::move(m_name);
+		m_name = p_name;
+		NameChangedEvent.Invoke(*this, previousName);
+	}
 }
 
 void OvCore::ECS::Actor::SetTag(const std::string & p_tag)
 {
-	m_tag = p_tag;
+	if (p_tag != m_tag)
+	{
+		const std::string previousTag = std::move(m_tag);
+		m_tag = p_tag;
+		TagChangedEvent.Invoke(*this, previousTag);
+	}
 }
 
 void OvCore::ECS::Actor::SetActive(bool p_active)
@@ -106,7 +178,12 @@ bool OvCore::ECS::Actor::IsActive() const
 
 void OvCore::ECS::Actor::SetID(int64_t p_id)
 {
-	m_actorID = p_id;
+	if (p_id != m_actorID)
+	{
+		const int64_t previousID = m_actorID;
+		m_actorID = p_id;
+		IDChangedEvent.Invoke(*this, previousID);
+	}
 }
 
 int64_t OvCore::ECS::Actor::GetID() const
@@ -189,95 +266,68 @@ void OvCore::ECS::Actor::SetSleeping(bool p_sleeping)
 void OvCore::ECS::Actor::OnAwake()
 {
 	m_awaked = true;
-	std::for_each(m_components.begin(), m_components.end(), [](auto element) { element->OnAwake(); });
+	std::for_each(m_components.begin(), m_components.end(), [](auto& element) { element->OnAwake(); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [](auto & element) { element.second.OnAwake(); });
 }
 
 void OvCore::ECS::Actor::OnStart()
 {
 	m_started = true;
-	std::for_each(m_components.begin(), m_components.end(), [](auto element) { element->OnStart(); });
+	std::for_each(m_components.begin(), m_components.end(), [](auto& element) { element->OnStart(); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [](auto & element) { element.second.OnStart(); });
 }
 
 void OvCore::ECS::Actor::OnEnable()
 {
-	std::for_each(m_components.begin(), m_components.end(), [](auto element) { element->OnEnable(); });
+	std::for_each(m_components.begin(), m_components.end(), [](auto& element) { element->OnEnable(); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [](auto & element) { element.second.OnEnable(); });
 }
 
 void OvCore::ECS::Actor::OnDisable()
 {
-	std::for_each(m_components.begin(), m_components.end(), [](auto element) { element->OnDisable(); });
+	std::for_each(m_components.begin(), m_components.end(), [](auto& element) { element->OnDisable(); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [](auto & element) { element.second.OnDisable(); });
 }
 
 void OvCore::ECS::Actor::OnDestroy()
 {
-	std::for_each(m_components.begin(), m_components.end(), [](auto element) { element->OnDestroy(); });
+	std::for_each(m_components.begin(), m_components.end(), [](auto& element) { element->OnDestroy(); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [](auto & element) { element.second.OnDestroy(); });
 }
 
-void OvCore::ECS::Actor::OnUpdate(float p_deltaTime)
-{
-	if (IsActive())
-	{
-		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnUpdate(p_deltaTime); });
-	}
-}
-
-void OvCore::ECS::Actor::OnFixedUpdate(float p_deltaTime)
-{
-	if (IsActive())
-	{
-		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnFixedUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnFixedUpdate(p_deltaTime); });
-	}
-}
-
-void OvCore::ECS::Actor::OnLateUpdate(float p_deltaTime)
-{
-	if (IsActive())
-	{
-		std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnLateUpdate(p_deltaTime); });
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnLateUpdate(p_deltaTime); });
-	}
-}
-
 void OvCore::ECS::Actor::OnCollisionEnter(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnCollisionEnter(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnCollisionEnter(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnCollisionEnter(p_otherObject); });
 }
 
 void OvCore::ECS::Actor::OnCollisionStay(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnCollisionStay(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnCollisionStay(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnCollisionStay(p_otherObject); });
 }
 
 void OvCore::ECS::Actor::OnCollisionExit(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnCollisionExit(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnCollisionExit(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnCollisionExit(p_otherObject); });
 }
 
 void OvCore::ECS::Actor::OnTriggerEnter(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnTriggerEnter(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnTriggerEnter(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnTriggerEnter(p_otherObject); });
 }
 
 void OvCore::ECS::Actor::OnTriggerStay(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnTriggerStay(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnTriggerStay(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnTriggerStay(p_otherObject); });
 }
 
 void OvCore::ECS::Actor::OnTriggerExit(Components::CPhysicalObject& p_otherObject)
 {
-	std::for_each(m_components.begin(), m_components.end(), [&](auto element) { element->OnTriggerExit(p_otherObject); });
+	std::for_each(m_components.begin(), m_components.end(), [&](auto& element) { element->OnTriggerExit(p_otherObject); });
 	std::for_each(m_behaviours.begin(), m_behaviours.end(), [&](auto & element) { element.second.OnTriggerExit(p_otherObject); });
 }
 
@@ -288,7 +338,11 @@ bool OvCore::ECS::Actor::RemoveComponent(OvCore::ECS::Components::AComponent& p_
 		if (it->get() == &p_component)
 		{
 			ComponentRemovedEvent.Invoke(p_component);
+
+			/* Keep the component alive until its types are unregistered */
+			auto removed = std::move(*it);
 			m_components.erase(it);
+			UnregisterComponentTypes(p_component);
 			return true;
 		}
 	}
@@ -382,7 +436,7 @@ void OvCore::ECS::Actor::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XM
 		componentsNode->InsertEndChild(componentNode);
 
 		/* Component type */
-		OvCore::Helpers::Serializer::SerializeString(p_doc, componentNode, "type", typeid(*component).name());
+		OvCore::Helpers::Serializer::SerializeString(p_doc, componentNode, "type", component->GetSerializationID());
 
 		/* Data node (Will be passed to the component) */
 		tinyxml2::XMLElement* data = p_doc.NewElement("data");
@@ -415,12 +469,21 @@ void OvCore::ECS::Actor::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XM
 
 void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_actorsRoot)
 {
-	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "name", m_name);
-	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "tag", m_tag);
+	/* Name, tag and ID go through their setters, so the owners of the actor are notified */
+	std::string name = m_name;
+	std::string tag = m_tag;
+	int64_t id = m_actorID;
+
+	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "name", name);
+	OvCore::Helpers::Serializer::DeserializeString(p_doc, p_actorsRoot, "tag", tag);
 	OvCore::Helpers::Serializer::DeserializeBoolean(p_doc, p_actorsRoot, "active", m_active);
-	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "id", m_actorID);
+	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "id", id);
 	OvCore::Helpers::Serializer::DeserializeInt64(p_doc, p_actorsRoot, "parent", m_parentID);
 
+	SetName(name);
+	SetTag(tag);
+	SetID(id);
+
 	{
 		tinyxml2::XMLNode* componentsRoot = p_actorsRoot->FirstChildElement("components");
 		if (componentsRoot)
@@ -430,23 +493,7 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 			while (currentComponent)
 			{
 				std::string componentType = currentComponent->FirstChildElement("type")->GetText();
-				OvCore::ECS::Components::AComponent* component = nullptr;
-
-				// TODO: Use component name instead of typeid (unsafe)
-				if (componentType == typeid(Components::CTransform).name())			component = &transform;
-				else if (componentType == typeid(Components::CPhysicalBox).name())			component = &AddComponent<OvCore::ECS::Components::CPhysicalBox>();
-				else if (componentType == typeid(Components::CPhysicalSphere).name())		component = &AddComponent<OvCore::ECS::Components::CPhysicalSphere>();
-				else if (componentType == typeid(Components::CPhysicalCapsule).name())		component = &AddComponent<OvCore::ECS::Components::CPhysicalCapsule>();
-				else if (componentType == typeid(Components::CModelRenderer).name())			component = &AddComponent<OvCore::ECS::Components::CModelRenderer>();
-				else if (componentType == typeid(Components::CCamera).name())				component = &AddComponent<OvCore::ECS::Components::CCamera>();
-				else if (componentType == typeid(Components::CMaterialRenderer).name())		component = &AddComponent<OvCore::ECS::Components::CMaterialRenderer>();
-				else if (componentType == typeid(Components::CAudioSource).name())			component = &AddComponent<OvCore::ECS::Components::CAudioSource>();
-				else if (componentType == typeid(Components::CAudioListener).name())		component = &AddComponent<OvCore::ECS::Components::CAudioListener>();
-				else if (componentType == typeid(Components::CPointLight).name())			component = &AddComponent<OvCore::ECS::Components::CPointLight>();
-				else if (componentType == typeid(Components::CDirectionalLight).name())		component = &AddComponent<OvCore::ECS::Components::CDirectionalLight>();
-				else if (componentType == typeid(Components::CSpotLight).name())			component = &AddComponent<OvCore::ECS::Components::CSpotLight>();
-				else if (componentType == typeid(Components::CAmbientBoxLight).name())		component = &AddComponent<OvCore::ECS::Components::CAmbientBoxLight>();
-				else if (componentType == typeid(Components::CAmbientSphereLight).name())	component = &AddComponent<OvCore::ECS::Components::CAmbientSphereLight>();
+				OvCore::ECS::Components::AComponent* component = AddComponentFromSerializationID(componentType);
 
 				if (component)
 					component->OnDeserialize(p_doc, currentComponent->FirstChildElement("data"));
@@ -476,6 +523,18 @@ void OvCore::ECS::Actor::OnDeserialize(tinyxml2::XMLDocument & p_doc, tinyxml2::
 	}
 }
 
+OvCore::ECS::Components::AComponent* OvCore::ECS::Actor::AddComponentFromSerializationID(const std::string& p_serializationID)
+{
+	auto found = GetComponentRegistry().find(p_serializationID);
+	return found != GetComponentRegistry().end() ? found->second.factory(*this) : nullptr;
+}
+
+std::string OvCore::ECS::Actor::ResolveSerializationID(const std::string& p_type)
+{
+	auto found = GetComponentRegistry().find(p_type);
+	return found != GetComponentRegistry().end() ? found->second.serializationID : p_type;
+}
+
 void OvCore::ECS::Actor::RecursiveActiveUpdate()
 {
 	bool isActive = IsActive();
@@ -507,3 +566,29 @@ void OvCore::ECS::Actor::RecursiveWasActiveUpdate()
 	for (auto child : m_children)
 		child->RecursiveWasActiveUpdate();
 }
+
+
+void OvCore::ECS::Actor::RegisterComponentTypes(Components::AComponent& p_component)
+{
+	/* The latest added component wins when several components share a base type */
+	for (auto typeID : p_component.GetTypeIDs())
+	{
+		if (typeID >= m_componentsByType.size())
+			m_componentsByType.resize(typeID + 1, nullptr);
+
+		m_componentsByType[typeID] = &p_component;
+	}
+}
+
+void OvCore::ECS::Actor::UnregisterComponentTypes(Components::AComponent& p_component)
+{
+	for (auto typeID : p_component.GetTypeIDs())
+	{
+		if (m_componentsByType[typeID] != &p_component)
+			continue;
+
+		/* Components are stored from the latest added to the oldest, the first match is the new owner of the slot */
+		auto replacement = std::find_if(m_components.begin(), m_components.end(), [typeID](auto& p_other) { return p_other->IsOfType(typeID); });
+		m_componentsByType[typeID] = replacement != m_components.end() ? replacement->get() : nullptr;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <atomic>
+
+#include "OvCore/ECS/ComponentType.h"
+
+OvCore::ECS::ComponentTypeID OvCore::ECS::GenerateComponentTypeID()
+{
+	static std::atomic<ComponentTypeID> availableTypeID = 0;
+	return availableTypeID++;
+}
\ No newline at end of file
@@ -4,8 +4,11 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include "OvCore/ECS/Components/AComponent.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::AComponent::AComponent(ECS::Actor& p_owner) : owner(p_owner)
 {
@@ -19,3 +22,34 @@ OvCore::ECS::Components::AComponent::~AComponent()
 		OnDestroy();
 	}
 }
+
+void OvCore::ECS::Components::AComponent::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	tinyxml2::XMLDocument doc;
+	tinyxml2::XMLElement* data = doc.NewElement("data");
+	doc.InsertEndChild(data);
+	p_data.BuildNodes(doc, data);
+	OnDeserialize(doc, data);
+}
+
+bool OvCore::ECS::Components::AComponent::IsOfType(ComponentTypeID p_typeID) const
+{
+	return std::find(m_typeIDs.begin(), m_typeIDs.end(), p_typeID) != m_typeIDs.end();
+}
+
+const std::vector<OvCore::ECS::ComponentTypeID>& OvCore::ECS::Components::AComponent::GetTypeIDs() const
+{
+	return m_typeIDs;
+}
+
+const char* OvCore::ECS::Components::AComponent::GetSerializationID() const
+{
+	return m_serializationID;
+}
+
+const OvCore::ECS::ComponentUpdateAccess& OvCore::ECS::Components::AComponent::GetUpdateAccess() const
+{
+	/* Components not created by Actor::AddComponent (Behaviours) are updated on the main thread */
+	static const ComponentUpdateAccess mainThreadAccess;
+	return m_updateAccess ? *m_updateAccess : mainThreadAccess;
+}
\ No newline at end of file
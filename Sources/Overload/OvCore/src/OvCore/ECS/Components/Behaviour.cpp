@@ -10,6 +10,38 @@
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/ECS/Components/Behaviour.h"
 #include "OvCore/Scripting/LuaBinder.h"
+#include "OvCore/SceneSystem/BinaryData.h"
+
+namespace
+{
+	using EHook = OvCore::ECS::Components::Behaviour::EHook;
+
+	/* Script function of each hook, in EHook order */
+	constexpr std::array<const char*, static_cast<size_t>(EHook::COUNT)> kHookNames =
+	{
+		"OnAwake",
+		"OnStart",
+		"OnEnable",
+		"OnDisable",
+		"OnEnd",
+		"OnDestroy",
+		"OnUpdate",
+		"OnFixedUpdate",
+		"OnLateUpdate",
+		"OnCollisionStart",
+		"OnCollisionEnter",
+		"OnCollisionStay",
+		"OnCollisionStop",
+		"OnCollisionExit",
+		"OnTriggerStart",
+		"OnTriggerEnter",
+		"OnTriggerStay",
+		"OnTriggerStop",
+		"OnTriggerExit"
+	};
+
+	static_assert(kHookNames.size() <= 32, "Hooks must fit in the hook mask");
+}
 
 OvTools::Eventing::Event<OvCore::ECS::Components::Behaviour*> OvCore::ECS::Components::Behaviour::CreatedEvent;
 OvTools::Eventing::Event<OvCore::ECS::Components::Behaviour*> OvCore::ECS::Components::Behaviour::DestroyedEvent;
@@ -30,11 +62,9 @@ std::string OvCore::ECS::Components::Behaviour::GetName()
 	return "Behaviour";
 }
 
-bool OvCore::ECS::Components::Behaviour::RegisterToLuaContext(sol::state& p_luaState, const std::string& p_scriptFolder)
+bool OvCore::ECS::Components::Behaviour::RegisterToLuaContext(const sol::protected_function& p_script)
 {
-	using namespace OvCore::Scripting;
-
-	auto result = p_luaState.safe_script_file(p_scriptFolder + name + ".lua", &sol::script_pass_on_error);
+	auto result = p_script();
 
 	if (!result.valid())
 	{
@@ -48,6 +78,7 @@ bool OvCore::ECS::Components::Behaviour::RegisterToLuaContext(sol::state& p_luaS
 		{
 			m_object = result[0];
 			m_object["owner"] = &owner;
+			ResolveHooks();
 			return true;
 		}
 		else
@@ -61,6 +92,41 @@ bool OvCore::ECS::Components::Behaviour::RegisterToLuaContext(sol::state& p_luaS
 void OvCore::ECS::Components::Behaviour::UnregisterFromLuaContext()
 {
 	m_object = sol::nil;
+	m_hooks.fill(sol::protected_function());
+	m_hookMask = 0;
+}
+
+bool OvCore::ECS::Components::Behaviour::HasHook(EHook p_hook) const
+{
+	return m_hookMask & (1u << static_cast<uint32_t>(p_hook));
+}
+
+void OvCore::ECS::Components::Behaviour::ResolveHooks()
+{
+	m_hookMask = 0;
+
+	for (size_t i = 0; i < kHookNames.size(); ++i)
+	{
+		sol::object function = m_object[kHookNames[i]];
+
+		if (function.valid())
+		{
+			m_hooks[i] = function;
+			m_hookMask |= 1u << i;
+		}
+		else
+		{
+			m_hooks[i] = sol::protected_function();
+		}
+	}
+}
+
+void OvCore::ECS::Components::Behaviour::CallLifecycleHook(EHook p_hook)
+{
+	CallHook(p_hook);
+
+	if (m_object.valid())
+		ResolveHooks();
 }
 
 sol::table& OvCore::ECS::Components::Behaviour::GetTable()
@@ -70,77 +136,77 @@ sol::table& OvCore::ECS::Components::Behaviour::GetTable()
 
 void OvCore::ECS::Components::Behaviour::OnAwake()
 {
-	LuaCall("OnAwake");
+	CallLifecycleHook(EHook::AWAKE);
 }
 
 void OvCore::ECS::Components::Behaviour::OnStart()
 {
-	LuaCall("OnStart");
+	CallLifecycleHook(EHook::START);
 }
 
 void OvCore::ECS::Components::Behaviour::OnEnable()
 {
-	LuaCall("OnEnable");
+	CallLifecycleHook(EHook::ENABLE);
 }
 
 void OvCore::ECS::Components::Behaviour::OnDisable()
 {
-	LuaCall("OnDisable");
+	CallLifecycleHook(EHook::DISABLE);
 }
 
 void OvCore::ECS::Components::Behaviour::OnDestroy()
 {
-	LuaCall("OnEnd"); // Retro-compatibility
-	LuaCall("OnDestroy");
+	CallHook(EHook::END); // Retro-compatibility
+	CallHook(EHook::DESTROY);
 }
 
 void OvCore::ECS::Components::Behaviour::OnUpdate(float p_deltaTime)
 {
-	LuaCall("OnUpdate", p_deltaTime);
+	CallHook(EHook::UPDATE, p_deltaTime);
 }
 
 void OvCore::ECS::Components::Behaviour::OnFixedUpdate(float p_deltaTime)
 {
-	LuaCall("OnFixedUpdate", p_deltaTime);
+	CallHook(EHook::FIXED_UPDATE, p_deltaTime);
 }
 
 void OvCore::ECS::Components::Behaviour::OnLateUpdate(float p_deltaTime)
 {
-	LuaCall("OnLateUpdate", p_deltaTime);
+	CallHook(EHook::LATE_UPDATE, p_deltaTime);
 }
 
 void OvCore::ECS::Components::Behaviour::OnCollisionEnter(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnCollisionStart", p_otherObject); // Retro-compatibility
-	LuaCall("OnCollisionEnter", p_otherObject);
+	CallHook(EHook::COLLISION_START, p_otherObject); // Retro-compatibility
+	CallHook(EHook::COLLISION_ENTER, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnCollisionStay(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnCollisionStay", p_otherObject);
+	CallHook(EHook::COLLISION_STAY, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnCollisionExit(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnCollisionStop", p_otherObject); // Retro-compatibility
-	LuaCall("OnCollisionExit", p_otherObject);
+	CallHook(EHook::COLLISION_STOP, p_otherObject); // Retro-compatibility
+	CallHook(EHook::COLLISION_EXIT, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnTriggerEnter(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnTriggerStart", p_otherObject); // Retro-compatibility
-	LuaCall("OnTriggerEnter", p_otherObject);
+	CallHook(EHook::TRIGGER_START, p_otherObject); // Retro-compatibility
+	CallHook(EHook::TRIGGER_ENTER, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnTriggerStay(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnTriggerStay", p_otherObject);
+	CallHook(EHook::TRIGGER_STAY, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnTriggerExit(Components::CPhysicalObject& p_otherObject)
 {
-	LuaCall("OnTriggerStop", p_otherObject); // Retro-compatibility
-	LuaCall("OnTriggerExit", p_otherObject);
+	CallHook(EHook::TRIGGER_STOP, p_otherObject); // Retro-compatibility
+	CallHook(EHook::TRIGGER_EXIT, p_otherObject);
 }
 
 void OvCore::ECS::Components::Behaviour::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -151,6 +217,11 @@ void OvCore::ECS::Components::Behaviour::OnDeserialize(tinyxml2::XMLDocument & p
 {
 }
 
+void OvCore::ECS::Components::Behaviour::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	/* Nothing is serialized, see OnSerialize */
+}
+
 void OvCore::ECS::Components::Behaviour::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	using namespace OvMaths;
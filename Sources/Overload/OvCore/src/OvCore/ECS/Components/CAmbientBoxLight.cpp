@@ -12,6 +12,7 @@
 #include "OvCore/ECS/Actor.h"
 
 #include "OvCore/ECS/Components/CAmbientBoxLight.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CAmbientBoxLight::CAmbientBoxLight(ECS::Actor & p_owner) :
 	CLight(p_owner)
@@ -39,6 +40,7 @@ void OvCore::ECS::Components::CAmbientBoxLight::SetSize(const OvMaths::FVector3&
 	m_data.constant = p_size.x;
 	m_data.linear = p_size.y;
 	m_data.quadratic = p_size.z;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CAmbientBoxLight::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -60,6 +62,18 @@ void OvCore::ECS::Components::CAmbientBoxLight::OnDeserialize(tinyxml2::XMLDocum
 	m_data.constant = size.x;
 	m_data.linear = size.y;
 	m_data.quadratic = size.z;
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CAmbientBoxLight::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CLight::OnDeserializeBinary(p_data);
+
+	OvMaths::FVector3 size = p_data.ReadVec3("size");
+	m_data.constant = size.x;
+	m_data.linear = size.y;
+	m_data.quadratic = size.z;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CAmbientBoxLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -69,7 +83,7 @@ void OvCore::ECS::Components::CAmbientBoxLight::OnInspector(OvUI::Internal::Widg
 	CLight::OnInspector(p_root);
 
 	auto sizeGatherer = [this]() -> OvMaths::FVector3 { return { m_data.constant, m_data.linear, m_data.quadratic }; };
-	auto sizeProvider = [this](const OvMaths::FVector3& p_data) { m_data.constant = p_data.x; m_data.linear = p_data.y, m_data.quadratic = p_data.z; };
+	auto sizeProvider = [this](const OvMaths::FVector3& p_data) { SetSize(p_data); };
 
 	GUIDrawer::DrawVec3(p_root, "Size", sizeGatherer, sizeProvider, 0.1f, 0.f);
 }
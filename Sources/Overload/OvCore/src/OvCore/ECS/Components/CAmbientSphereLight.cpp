@@ -12,6 +12,7 @@
 #include "OvCore/ECS/Actor.h"
 
 #include "OvCore/ECS/Components/CAmbientSphereLight.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CAmbientSphereLight::CAmbientSphereLight(ECS::Actor & p_owner) :
 	CLight(p_owner)
@@ -35,6 +36,7 @@ float OvCore::ECS::Components::CAmbientSphereLight::GetRadius() const
 void OvCore::ECS::Components::CAmbientSphereLight::SetRadius(float p_radius)
 {
 	m_data.constant = p_radius;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CAmbientSphereLight::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -53,6 +55,15 @@ void OvCore::ECS::Components::CAmbientSphereLight::OnDeserialize(tinyxml2::XMLDo
 	CLight::OnDeserialize(p_doc, p_node);
 
 	Serializer::DeserializeFloat(p_doc, p_node, "radius", m_data.constant);
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CAmbientSphereLight::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CLight::OnDeserializeBinary(p_data);
+
+	p_data.ReadFloat("radius", m_data.constant);
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CAmbientSphereLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -61,5 +72,7 @@ void OvCore::ECS::Components::CAmbientSphereLight::OnInspector(OvUI::Internal::W
 
 	CLight::OnInspector(p_root);
 
-	GUIDrawer::DrawScalar<float>(p_root, "Radius", m_data.constant, 0.1f, 0.f);
+	auto radiusGatherer = [this] { return m_data.constant; };
+	auto radiusProvider = [this](float p_radius) { SetRadius(p_radius); };
+	GUIDrawer::DrawScalar<float>(p_root, "Radius", radiusGatherer, radiusProvider, 0.1f, 0.f);
 }
@@ -6,6 +6,7 @@
 
 #include "OvCore/ECS/Components/CAudioListener.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CAudioListener::CAudioListener(ECS::Actor& p_owner) :
 	AComponent(p_owner),
@@ -27,6 +28,11 @@ void OvCore::ECS::Components::CAudioListener::OnDeserialize(tinyxml2::XMLDocumen
 {
 }
 
+void OvCore::ECS::Components::CAudioListener::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	/* Nothing is serialized, see OnSerialize */
+}
+
 void OvCore::ECS::Components::CAudioListener::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 
@@ -12,6 +12,8 @@
 #include "OvCore/ECS/Actor.h"
 #include "OvCore/Global/ServiceLocator.h"
 #include "OvCore/SceneSystem/SceneManager.h"
+#include "OvCore/ResourceManagement/SoundManager.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CAudioSource::CAudioSource(ECS::Actor& p_owner) :
 	AComponent(p_owner),
@@ -161,6 +163,22 @@ void OvCore::ECS::Components::CAudioSource::OnDeserialize(tinyxml2::XMLDocument&
 	Serializer::DeserializeSound(p_doc, p_node, "audio_clip", m_sound);
 }
 
+void OvCore::ECS::Components::CAudioSource::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	p_data.ReadBoolean("autoplay", m_autoPlay);
+	SetSpatial(p_data.ReadBoolean("spatial"));
+	SetVolume(p_data.ReadFloat("volume"));
+	SetPan(p_data.ReadFloat("pan"));
+	SetLooped(p_data.ReadBoolean("looped"));
+	SetPitch(p_data.ReadFloat("pitch"));
+	SetAttenuationThreshold(p_data.ReadFloat("attenuation_threshold"));
+
+	if (std::string path = p_data.ReadString("audio_clip"); path != "?" && path != "")
+		m_sound = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::SoundManager>().GetResource(path);
+	else
+		m_sound = nullptr;
+}
+
 void OvCore::ECS::Components::CAudioSource::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	using namespace OvAudio::Entities;
@@ -10,6 +10,7 @@
 
 #include "OvCore/ECS/Components/CCamera.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CCamera::CCamera(ECS::Actor& p_owner) : AComponent(p_owner)
 {
@@ -138,6 +139,21 @@ void OvCore::ECS::Components::CCamera::OnDeserialize(tinyxml2::XMLDocument & p_d
     }
 }
 
+void OvCore::ECS::Components::CCamera::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	m_camera.SetFov(p_data.ReadFloat("fov"));
+	m_camera.SetSize(p_data.ReadFloat("size"));
+	m_camera.SetNear(p_data.ReadFloat("near"));
+	m_camera.SetFar(p_data.ReadFloat("far"));
+	m_camera.SetClearColor(p_data.ReadVec3("clear_color"));
+	m_camera.SetFrustumGeometryCulling(p_data.ReadBoolean("frustum_geometry_culling"));
+	m_camera.SetFrustumLightCulling(p_data.ReadBoolean("frustum_light_culling"));
+
+	/* Same as OnDeserialize, the default projection mode (Perspective) is kept if the scene doesn't specify one */
+	if (p_data.Has("projection_mode"))
+		m_camera.SetProjectionMode(static_cast<OvRendering::Settings::EProjectionMode>(p_data.ReadInt("projection_mode")));
+}
+
 void OvCore::ECS::Components::CCamera::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
     auto currentProjectionMode = GetProjectionMode();
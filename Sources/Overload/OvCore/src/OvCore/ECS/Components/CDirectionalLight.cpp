@@ -11,6 +11,7 @@
 #include "OvCore/ECS/Actor.h"
 
 #include "OvCore/ECS/Components/CDirectionalLight.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CDirectionalLight::CDirectionalLight(ECS::Actor & p_owner) :
 	CLight(p_owner)
@@ -33,6 +34,11 @@ void OvCore::ECS::Components::CDirectionalLight::OnDeserialize(tinyxml2::XMLDocu
 	CLight::OnDeserialize(p_doc, p_node);
 }
 
+void OvCore::ECS::Components::CDirectionalLight::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CLight::OnDeserializeBinary(p_data);
+}
+
 void OvCore::ECS::Components::CDirectionalLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
 {
 	CLight::OnInspector(p_root);
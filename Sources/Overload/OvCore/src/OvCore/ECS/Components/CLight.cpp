@@ -13,11 +13,26 @@
 #include "OvCore/ECS/Actor.h"
 
 #include "OvCore/ECS/Components/CLight.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CLight::CLight(ECS::Actor & p_owner) :
 	AComponent(p_owner),
 	m_data(p_owner.transform.GetFTransform(), {})
 {
+	m_transformNotificationHandlerID = owner.transform.GetFTransform().Notifier.AddNotificationHandler([this](OvMaths::Internal::TransformNotifier::ENotification p_notification)
+	{
+		if (p_notification == OvMaths::Internal::TransformNotifier::ENotification::TRANSFORM_DESTROYED)
+			m_transformAlive = false;
+
+		BoundsChangedEvent.Invoke();
+	});
+}
+
+OvCore::ECS::Components::CLight::~CLight()
+{
+	/* The transform can be destroyed first when the whole actor is destroyed */
+	if (m_transformAlive)
+		owner.transform.GetFTransform().Notifier.RemoveNotificationHandler(m_transformNotificationHandlerID);
 }
 
 const OvRendering::Entities::Light& OvCore::ECS::Components::CLight::GetData() const
@@ -43,6 +58,7 @@ void OvCore::ECS::Components::CLight::SetColor(const OvMaths::FVector3& p_color)
 void OvCore::ECS::Components::CLight::SetIntensity(float p_intensity)
 {
 	m_data.intensity = p_intensity;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CLight::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
@@ -59,6 +75,14 @@ void OvCore::ECS::Components::CLight::OnDeserialize(tinyxml2::XMLDocument & p_do
 
 	Serializer::DeserializeVec3(p_doc, p_node, "color", m_data.color);
 	Serializer::DeserializeFloat(p_doc, p_node, "intensity", m_data.intensity);
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CLight::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	p_data.ReadVec3("color", m_data.color);
+	p_data.ReadFloat("intensity", m_data.intensity);
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -66,5 +90,7 @@ void OvCore::ECS::Components::CLight::OnInspector(OvUI::Internal::WidgetContaine
 	using namespace OvCore::Helpers;
 
 	GUIDrawer::DrawColor(p_root, "Color", reinterpret_cast<OvUI::Types::Color&>(m_data.color));
-	GUIDrawer::DrawScalar<float>(p_root, "Intensity", m_data.intensity, 0.005f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);
+	auto intensityGatherer = [this] { return m_data.intensity; };
+	auto intensityProvider = [this](float p_intensity) { SetIntensity(p_intensity); };
+	GUIDrawer::DrawScalar<float>(p_root, "Intensity", intensityGatherer, intensityProvider, 0.005f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);
 }
@@ -18,11 +18,10 @@
 #include "OvCore/ECS/Components/CModelRenderer.h"
 #include "OvCore/ResourceManagement/MaterialManager.h"
 #include "OvCore/Global/ServiceLocator.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CMaterialRenderer::CMaterialRenderer(ECS::Actor & p_owner) : AComponent(p_owner)
 {
-	m_materials.fill(nullptr);
-
 	for (uint8_t i = 0; i < MAX_MATERIAL_COUNT; ++i)
 		m_materialFields[i].fill(nullptr);
 
@@ -36,39 +35,41 @@ std::string OvCore::ECS::Components::CMaterialRenderer::GetName()
 
 void OvCore::ECS::Components::CMaterialRenderer::FillWithMaterial(OvCore::Resources::Material & p_material)
 {
+	const MaterialHandle handle(OVSERVICE(ResourceManagement::MaterialManager), &p_material);
+
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		m_materials[i] = &p_material;
+		m_materials[i] = handle;
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::SetMaterialAtIndex(uint8_t p_index, OvCore::Resources::Material& p_material)
 {
-	m_materials[p_index] = &p_material;
+	m_materials[p_index] = MaterialHandle(OVSERVICE(ResourceManagement::MaterialManager), &p_material);
 }
 
 OvCore::Resources::Material* OvCore::ECS::Components::CMaterialRenderer::GetMaterialAtIndex(uint8_t p_index)
 {
-	return m_materials.at(p_index);
+	return m_materials.at(p_index).Get();
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialAtIndex(uint8_t p_index)
 {
 	if (p_index < m_materials.size())
 	{
-		m_materials[p_index] = nullptr;;
+		m_materials[p_index].Reset();
 	}
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveMaterialByInstance(OvCore::Resources::Material& p_instance)
 {
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		if (m_materials[i] == &p_instance)
-			m_materials[i] = nullptr;
+		if (m_materials[i].Get() == &p_instance)
+			m_materials[i].Reset();
 }
 
 void OvCore::ECS::Components::CMaterialRenderer::RemoveAllMaterials()
 {
 	for (uint8_t i = 0; i < m_materials.size(); ++i)
-		m_materials[i] = nullptr;
+		m_materials[i].Reset();
 }
 
 const OvMaths::FMatrix4 & OvCore::ECS::Components::CMaterialRenderer::GetUserMatrix() const
@@ -91,7 +92,7 @@ void OvCore::ECS::Components::CMaterialRenderer::OnSerialize(tinyxml2::XMLDocume
 
 	for (uint8_t i = 0; i < elementsToSerialize; ++i)
 	{
-		OvCore::Helpers::Serializer::SerializeMaterial(p_doc, materialsNode, "material", m_materials[i]);
+		OvCore::Helpers::Serializer::SerializeMaterial(p_doc, materialsNode, "material", m_materials[i].Get());
 	}
 }
 
@@ -106,8 +107,10 @@ void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocu
 
 		while (currentMaterial)
 		{
-			if (auto material = Global::ServiceLocator::Get<ResourceManagement::MaterialManager>()[currentMaterial->GetText()])
-				m_materials[materialIndex] = material;
+			auto& materialManager = Global::ServiceLocator::Get<ResourceManagement::MaterialManager>();
+
+			if (auto material = materialManager[currentMaterial->GetText()])
+				m_materials[materialIndex] = MaterialHandle(materialManager, material);
 
 			currentMaterial = currentMaterial->NextSiblingElement("material");
 			++materialIndex;
@@ -117,7 +120,22 @@ void OvCore::ECS::Components::CMaterialRenderer::OnDeserialize(tinyxml2::XMLDocu
 	UpdateMaterialList();
 }
 
-std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvCore::Resources::Material*& p_data)
+void OvCore::ECS::Components::CMaterialRenderer::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	auto& materialManager = Global::ServiceLocator::Get<ResourceManagement::MaterialManager>();
+
+	const auto paths = p_data.ReadStringList("materials");
+
+	for (size_t i = 0; i < paths.size() && i < m_materials.size(); ++i)
+	{
+		if (auto material = materialManager[paths[i]])
+			m_materials[i] = MaterialHandle(materialManager, material);
+	}
+
+	UpdateMaterialList();
+}
+
+std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::WidgetContainer& p_root, const std::string& p_name, OvCore::ECS::Components::CMaterialRenderer::MaterialHandle& p_data)
 {
 	using namespace OvCore::Helpers;
 
@@ -136,9 +154,11 @@ std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::Widg
 	{
 		if (OvTools::Utils::PathParser::GetFileType(p_receivedData.first) == OvTools::Utils::PathParser::EFileType::MATERIAL)
 		{
-			if (auto resource = OVSERVICE(OvCore::ResourceManagement::MaterialManager).GetResource(p_receivedData.first); resource)
+			auto& materialManager = OVSERVICE(OvCore::ResourceManagement::MaterialManager);
+
+			if (auto resource = materialManager.GetResource(p_receivedData.first); resource)
 			{
-				p_data = resource;
+				p_data = OvCore::ECS::Components::CMaterialRenderer::MaterialHandle(materialManager, resource);
 				widget.content = p_receivedData.first;
 			}
 		}
@@ -150,7 +170,7 @@ std::array<OvUI::Widgets::AWidget*, 3> CustomMaterialDrawer(OvUI::Internal::Widg
 	resetButton.idleBackgroundColor = GUIDrawer::ClearButtonColor;
 	resetButton.ClickedEvent += [&widget, &p_data]
 	{
-		p_data = nullptr;
+		p_data.Reset();
 		widget.content = "Empty";
 	};
 
@@ -4,6 +4,8 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include <OvUI/Widgets/Texts/Text.h>
 #include <OvUI/Widgets/Texts/TextColored.h>
 #include <OvUI/Plugins/DDTarget.h>
@@ -19,14 +21,36 @@
 #include "OvCore/ECS/Components/CModelRenderer.h"
 #include "OvCore/ECS/Components/CMaterialRenderer.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CModelRenderer::CModelRenderer(ECS::Actor& p_owner) : AComponent(p_owner)
 {
+	BoundsChangedEvent += [this] { m_worldBoundingSphereDirty = true; };
+
 	m_modelChangedEvent += [this]
 	{
+		UpdateModelReference();
+		BoundsChangedEvent.Invoke();
+
 		if (auto materialRenderer = owner.GetComponent<CMaterialRenderer>())
 			materialRenderer->UpdateMaterialList();
 	};
+
+	/* Children transforms notify their own handlers when a parent moves, so the whole hierarchy is covered */
+	m_transformNotificationHandlerID = owner.transform.GetFTransform().Notifier.AddNotificationHandler([this](OvMaths::Internal::TransformNotifier::ENotification p_notification)
+	{
+		if (p_notification == OvMaths::Internal::TransformNotifier::ENotification::TRANSFORM_DESTROYED)
+			m_transformAlive = false;
+
+		BoundsChangedEvent.Invoke();
+	});
+}
+
+OvCore::ECS::Components::CModelRenderer::~CModelRenderer()
+{
+	/* The transform can be destroyed first when the whole actor is destroyed */
+	if (m_transformAlive)
+		owner.transform.GetFTransform().Notifier.RemoveNotificationHandler(m_transformNotificationHandlerID);
 }
 
 std::string OvCore::ECS::Components::CModelRenderer::GetName()
@@ -48,6 +72,7 @@ OvRendering::Resources::Model * OvCore::ECS::Components::CModelRenderer::GetMode
 void OvCore::ECS::Components::CModelRenderer::SetFrustumBehaviour(EFrustumBehaviour p_boundingMode)
 {
 	m_frustumBehaviour = p_boundingMode;
+	BoundsChangedEvent.Invoke();
 }
 
 OvCore::ECS::Components::CModelRenderer::EFrustumBehaviour OvCore::ECS::Components::CModelRenderer::GetFrustumBehaviour() const
@@ -63,8 +88,42 @@ const OvRendering::Geometry::BoundingSphere& OvCore::ECS::Components::CModelRend
 void OvCore::ECS::Components::CModelRenderer::SetCustomBoundingSphere(const OvRendering::Geometry::BoundingSphere& p_boundingSphere)
 {
 	m_customBoundingSphere = p_boundingSphere;
+	BoundsChangedEvent.Invoke();
+}
+
+const OvRendering::Geometry::BoundingSphere& OvCore::ECS::Components::CModelRenderer::GetWorldBoundingSphere() const
+{
+	if (m_worldBoundingSphereDirty)
+	{
+		const auto& localSphere = m_frustumBehaviour == EFrustumBehaviour::CULL_CUSTOM || !m_model ? m_customBoundingSphere : m_model->GetBoundingSphere();
+
+		/*
+		* Only the world matrix is read: it is already resolved during the update stages, while the world position,
+		* rotation and scale are decomposed on demand, which isn't safe from a worker thread
+		*/
+		const auto& world = owner.transform.GetFTransform().GetWorldMatrix();
+		const OvMaths::FVector4 center = world * OvMaths::FVector4(localSphere.position.x, localSphere.position.y, localSphere.position.z, 1.0f);
+
+		float maxScale = 0.0f;
+		for (uint8_t column = 0; column < 3; ++column)
+		{
+			const OvMaths::FVector3 axis(world.data[column], world.data[4 + column], world.data[8 + column]);
+			maxScale = std::max(maxScale, OvMaths::FVector3::Length(axis));
+		}
+
+		m_worldBoundingSphere = { { center.x, center.y, center.z }, localSphere.radius * maxScale };
+		m_worldBoundingSphereDirty = false;
+	}
+
+	return m_worldBoundingSphere;
+}
+
+void OvCore::ECS::Components::CModelRenderer::OnLateUpdate(float p_deltaTime)
+{
+	GetWorldBoundingSphere();
 }
 
+
 void OvCore::ECS::Components::CModelRenderer::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	OvCore::Helpers::Serializer::SerializeModel(p_doc, p_node, "model", m_model);
@@ -79,6 +138,29 @@ void OvCore::ECS::Components::CModelRenderer::OnDeserialize(tinyxml2::XMLDocumen
 	OvCore::Helpers::Serializer::DeserializeInt(p_doc, p_node, "frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
 	OvCore::Helpers::Serializer::DeserializeVec3(p_doc, p_node, "custom_bounding_sphere_position", m_customBoundingSphere.position);
 	OvCore::Helpers::Serializer::DeserializeFloat(p_doc, p_node, "custom_bounding_sphere_radius", m_customBoundingSphere.radius);
+	UpdateModelReference();
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CModelRenderer::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	if (std::string path = p_data.ReadString("model"); path != "?" && path != "")
+		m_model = OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::ModelManager>().GetResource(path);
+	else
+		m_model = nullptr;
+
+	p_data.ReadInt("frustum_behaviour", reinterpret_cast<int&>(m_frustumBehaviour));
+	p_data.ReadVec3("custom_bounding_sphere_position", m_customBoundingSphere.position);
+	p_data.ReadFloat("custom_bounding_sphere_radius", m_customBoundingSphere.radius);
+	UpdateModelReference();
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CModelRenderer::UpdateModelReference()
+{
+	/* The inspector and the deserialization assign m_model directly, so the reference follows it rather than SetModel only */
+	if (m_modelReference.Get() != m_model)
+		m_modelReference = ResourceManagement::ResourceHandle<OvRendering::Resources::Model>(OVSERVICE(ResourceManagement::ModelManager), m_model);
 }
 
 void OvCore::ECS::Components::CModelRenderer::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -109,7 +191,11 @@ void OvCore::ECS::Components::CModelRenderer::OnInspector(OvUI::Internal::Widget
 	boundingMode.ValueChangedEvent += [&](int p_choice)
 	{
 		centerLabel.enabled = centerWidget.enabled = radiusLabel.enabled = radiusWidget.enabled = p_choice == 3;
+		BoundsChangedEvent.Invoke();
 	};
 
+	centerWidget.ValueChangedEvent += [this](auto&) { BoundsChangedEvent.Invoke(); };
+	radiusWidget.ValueChangedEvent += [this](float) { BoundsChangedEvent.Invoke(); };
+
 	centerLabel.enabled = centerWidget.enabled = radiusLabel.enabled = radiusWidget.enabled = m_frustumBehaviour == EFrustumBehaviour::CULL_CUSTOM;
 }
@@ -8,6 +8,7 @@
 
 #include "OvCore/ECS/Components/CPhysicalBox.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 using namespace OvPhysics::Entities;
 
@@ -51,6 +52,13 @@ void OvCore::ECS::Components::CPhysicalBox::OnDeserialize(tinyxml2::XMLDocument
 	SetSize(Helpers::Serializer::DeserializeVec3(p_doc, p_node, "size"));
 }
 
+void OvCore::ECS::Components::CPhysicalBox::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CPhysicalObject::OnDeserializeBinary(p_data);
+
+	SetSize(p_data.ReadVec3("size"));
+}
+
 void OvCore::ECS::Components::CPhysicalBox::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
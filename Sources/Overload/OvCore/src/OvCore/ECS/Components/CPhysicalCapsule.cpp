@@ -9,6 +9,7 @@
 
 #include "OvCore/ECS/Components/CPhysicalCapsule.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 using namespace OvPhysics::Entities;
 
@@ -64,6 +65,14 @@ void OvCore::ECS::Components::CPhysicalCapsule::OnDeserialize(tinyxml2::XMLDocum
 	SetHeight(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "height"));
 }
 
+void OvCore::ECS::Components::CPhysicalCapsule::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CPhysicalObject::OnDeserializeBinary(p_data);
+
+	SetRadius(p_data.ReadFloat("radius"));
+	SetHeight(p_data.ReadFloat("height"));
+}
+
 void OvCore::ECS::Components::CPhysicalCapsule::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
@@ -13,6 +13,7 @@
 
 #include "OvCore/ECS/Components/CPhysicalObject.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CPhysicalObject::CPhysicalObject(ECS::Actor & p_owner) : 
 	AComponent(p_owner)
@@ -168,6 +169,18 @@ void OvCore::ECS::Components::CPhysicalObject::OnDeserialize(tinyxml2::XMLDocume
 	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(Helpers::Serializer::DeserializeInt(p_doc, p_node, "collision_mode")));
 }
 
+void OvCore::ECS::Components::CPhysicalObject::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	SetTrigger(p_data.ReadBoolean("is_trigger"));
+	SetKinematic(p_data.ReadBoolean("is_kinematic"));
+	SetBounciness(p_data.ReadFloat("bounciness"));
+	SetMass(p_data.ReadFloat("mass"));
+	SetFriction(p_data.ReadFloat("friction"));
+	SetLinearFactor(p_data.ReadVec3("linear_factor"));
+	SetAngularFactor(p_data.ReadVec3("angular_factor"));
+	SetCollisionDetectionMode(static_cast<OvPhysics::Entities::PhysicalObject::ECollisionDetectionMode>(p_data.ReadInt("collision_mode")));
+}
+
 void OvCore::ECS::Components::CPhysicalObject::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	Helpers::GUIDrawer::DrawBoolean(p_root, "Trigger", std::bind(&CPhysicalObject::IsTrigger, this), std::bind(&CPhysicalObject::SetTrigger, this, std::placeholders::_1));
@@ -9,6 +9,7 @@
 
 #include "OvCore/ECS/Components/CPhysicalSphere.h"
 #include "OvCore/ECS/Actor.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 using namespace OvPhysics::Entities;
 
@@ -52,6 +53,13 @@ void OvCore::ECS::Components::CPhysicalSphere::OnDeserialize(tinyxml2::XMLDocume
 	SetRadius(Helpers::Serializer::DeserializeFloat(p_doc, p_node, "radius"));
 }
 
+void OvCore::ECS::Components::CPhysicalSphere::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CPhysicalObject::OnDeserializeBinary(p_data);
+
+	SetRadius(p_data.ReadFloat("radius"));
+}
+
 void OvCore::ECS::Components::CPhysicalSphere::OnInspector(OvUI::Internal::WidgetContainer & p_root)
 {
 	CPhysicalObject::OnInspector(p_root);
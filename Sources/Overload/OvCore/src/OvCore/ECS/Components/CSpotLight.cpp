@@ -13,6 +13,7 @@
 #include "OvCore/ECS/Actor.h"
 
 #include "OvCore/ECS/Components/CSpotLight.h"
+#include "OvCore/SceneSystem/BinaryData.h"
 
 OvCore::ECS::Components::CSpotLight::CSpotLight(ECS::Actor & p_owner) :
 	CLight(p_owner)
@@ -53,16 +54,19 @@ float OvCore::ECS::Components::CSpotLight::GetOuterCutoff() const
 void OvCore::ECS::Components::CSpotLight::SetConstant(float p_constant)
 {
 	m_data.constant = p_constant;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CSpotLight::SetLinear(float p_linear)
 {
 	m_data.linear = p_linear;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CSpotLight::SetQuadratic(float p_quadratic)
 {
 	m_data.quadratic = p_quadratic;
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CSpotLight::SetCutoff(float p_cutoff)
@@ -99,6 +103,19 @@ void OvCore::ECS::Components::CSpotLight::OnDeserialize(tinyxml2::XMLDocument &
 	Serializer::DeserializeFloat(p_doc, p_node, "quadratic", m_data.quadratic);
 	Serializer::DeserializeFloat(p_doc, p_node, "cutoff", m_data.cutoff);
 	Serializer::DeserializeFloat(p_doc, p_node, "outercutoff", m_data.outerCutoff);
+	BoundsChangedEvent.Invoke();
+}
+
+void OvCore::ECS::Components::CSpotLight::OnDeserializeBinary(const SceneSystem::BinaryData& p_data)
+{
+	CLight::OnDeserializeBinary(p_data);
+
+	p_data.ReadFloat("constant", m_data.constant);
+	p_data.ReadFloat("linear", m_data.linear);
+	p_data.ReadFloat("quadratic", m_data.quadratic);
+	p_data.ReadFloat("cutoff", m_data.cutoff);
+	p_data.ReadFloat("outercutoff", m_data.outerCutoff);
+	BoundsChangedEvent.Invoke();
 }
 
 void OvCore::ECS::Components::CSpotLight::OnInspector(OvUI::Internal::WidgetContainer& p_root)
@@ -114,20 +131,20 @@ void OvCore::ECS::Components::CSpotLight::OnInspector(OvUI::Internal::WidgetCont
 	auto& presetsRoot = p_root.CreateWidget<OvUI::Widgets::Layout::Group>();
 
 	auto& constantPreset = presetsRoot.CreateWidget<OvUI::Widgets::Buttons::Button>("Constant");
-	constantPreset.ClickedEvent += [this] { m_data.constant = 1.f, m_data.linear = m_data.quadratic = 0.f; };
+	constantPreset.ClickedEvent += [this] { m_data.constant = 1.f, m_data.linear = m_data.quadratic = 0.f; BoundsChangedEvent.Invoke(); };
 	constantPreset.lineBreak = false;
 	constantPreset.idleBackgroundColor = { 0.7f, 0.5f, 0.f };
 
 	auto& linearPreset = presetsRoot.CreateWidget<OvUI::Widgets::Buttons::Button>("Linear");
-	linearPreset.ClickedEvent += [this] { m_data.linear = 1.f, m_data.constant = m_data.quadratic = 0.f; };
+	linearPreset.ClickedEvent += [this] { m_data.linear = 1.f, m_data.constant = m_data.quadratic = 0.f; BoundsChangedEvent.Invoke(); };
 	linearPreset.lineBreak = false;
 	linearPreset.idleBackgroundColor = { 0.7f, 0.5f, 0.f };
 
 	auto& quadraticPreset = presetsRoot.CreateWidget<OvUI::Widgets::Buttons::Button>("Quadratic");
-	quadraticPreset.ClickedEvent += [this] { m_data.quadratic = 1.f, m_data.constant = m_data.linear = 0.f; };
+	quadraticPreset.ClickedEvent += [this] { m_data.quadratic = 1.f, m_data.constant = m_data.linear = 0.f; BoundsChangedEvent.Invoke(); };
 	quadraticPreset.idleBackgroundColor = { 0.7f, 0.5f, 0.f };
 
-	GUIDrawer::DrawScalar<float>(p_root, "Constant", m_data.constant, 0.005f, 0.f);
-	GUIDrawer::DrawScalar<float>(p_root, "Linear", m_data.linear, 0.005f, 0.f);
-	GUIDrawer::DrawScalar<float>(p_root, "Quadratic", m_data.quadratic, 0.005f, 0.f);
+	GUIDrawer::DrawScalar<float>(p_root, "Constant", [this] { return m_data.constant; }, [this](float p_constant) { SetConstant(p_constant); }, 0.005f, 0.f);
+	GUIDrawer::DrawScalar<float>(p_root, "Linear", [this] { return m_data.linear; }, [this](float p_linear) { SetLinear(p_linear); }, 0.005f, 0.f);
+	GUIDrawer::DrawScalar<float>(p_root, "Quadratic", [this] { return m_data.quadratic; }, [this](float p_quadratic) { SetQuadratic(p_quadratic); }, 0.005f, 0.f);
 }
@@ -0,0 +1,137 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <array>
+#include <cstring>
+
+#include "OvCore/ECS/RenderQueue.h"
+
+namespace
+{
+	/* Fold a pointer into a small identifier. Collisions only affect grouping quality, never correctness */
+	uint64_t FoldPointer(const void* p_pointer, uint32_t p_bits)
+	{
+		uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p_pointer)) >> 4;
+		value ^= value >> p_bits;
+		value ^= value >> (p_bits * 2);
+		return value & ((uint64_t(1) << p_bits) - 1);
+	}
+
+	/* Positive floats keep their ordering when reinterpreted as integers */
+	uint32_t DistanceToBits(float p_distance)
+	{
+		if (!(p_distance > 0.0f))
+			return 0;
+
+		uint32_t bits;
+		std::memcpy(&bits, &p_distance, sizeof(float));
+		return bits;
+	}
+}
+
+OvCore::ECS::RenderQueue::RenderQueue(ESortMode p_sortMode) :
+	m_sortMode(p_sortMode)
+{
+}
+
+void OvCore::ECS::RenderQueue::Clear()
+{
+	m_drawables.clear();
+}
+
+void OvCore::ECS::RenderQueue::Push(OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, const OvMaths::FMatrix4& p_modelMatrix, const OvMaths::FMatrix4& p_userMatrix, float p_distance)
+{
+	m_drawables.push_back({ GenerateSortKey(p_mesh, p_material, p_distance), &p_mesh, &p_material, &p_modelMatrix, &p_userMatrix });
+}
+
+void OvCore::ECS::RenderQueue::Sort()
+{
+	const size_t count = m_drawables.size();
+
+	if (count < 2)
+		return;
+
+	/* Compute the histograms of the 8 key bytes in a single pass */
+	std::array<std::array<uint32_t, 256>, 8> histograms{};
+
+	for (const auto& drawable : m_drawables)
+		for (uint32_t byte = 0; byte < 8; ++byte)
+			++histograms[byte][(drawable.sortKey >> (byte * 8)) & 0xFF];
+
+	m_sortBuffer.resize(count);
+
+	Drawable* source = m_drawables.data();
+	Drawable* destination = m_sortBuffer.data();
+
+	/* LSD radix sort, a byte per pass. Bytes shared by every key (Only one non-empty bucket) are skipped */
+	for (uint32_t byte = 0; byte < 8; ++byte)
+	{
+		auto& histogram = histograms[byte];
+
+		if (histogram[(source[0].sortKey >> (byte * 8)) & 0xFF] == count)
+			continue;
+
+		uint32_t offset = 0;
+		for (auto& bucket : histogram)
+		{
+			const uint32_t bucketSize = bucket;
+			bucket = offset;
+			offset += bucketSize;
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			destination[histogram[(source[i].sortKey >> (byte * 8)) & 0xFF]++] = source[i];
+
+		std::swap(source, destination);
+	}
+
+	if (source != m_drawables.data())
+		m_drawables.swap(m_sortBuffer);
+}
+
+size_t OvCore::ECS::RenderQueue::Size() const
+{
+	return m_drawables.size();
+}
+
+bool OvCore::ECS::RenderQueue::IsEmpty() const
+{
+	return m_drawables.empty();
+}
+
+const std::vector<OvCore::ECS::RenderQueue::Drawable>& OvCore::ECS::RenderQueue::GetDrawables() const
+{
+	return m_drawables;
+}
+
+std::vector<OvCore::ECS::RenderQueue::Drawable>::const_iterator OvCore::ECS::RenderQueue::begin() const
+{
+	return m_drawables.begin();
+}
+
+std::vector<OvCore::ECS::RenderQueue::Drawable>::const_iterator OvCore::ECS::RenderQueue::end() const
+{
+	return m_drawables.end();
+}
+
+uint64_t OvCore::ECS::RenderQueue::GenerateSortKey(const OvRendering::Resources::Mesh& p_mesh, OvCore::Resources::Material& p_material, float p_distance) const
+{
+	const uint64_t shaderID = p_material.GetShader() ? p_material.GetShader()->id & 0xFFF : 0;
+	const uint64_t materialID = FoldPointer(&p_material, 16);
+	const uint32_t depth = DistanceToBits(p_distance);
+
+	switch (m_sortMode)
+	{
+	case ESortMode::BACK_TO_FRONT:
+		/* [63..32] inverted depth | [31..20] shader | [19..4] material */
+		return (static_cast<uint64_t>(~depth) << 32) | (shaderID << 20) | (materialID << 4);
+
+	case ESortMode::STATE_CHANGES:
+	default:
+		/* [63..52] shader | [51..36] material | [35..20] mesh | [19..0] depth (Sign bit is always 0, so 20 of the 31 remaining bits) */
+		return (shaderID << 52) | (materialID << 36) | (FoldPointer(&p_mesh, 16) << 20) | (depth >> 11);
+	}
+}
@@ -4,6 +4,9 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include <OvAnalytics/Profiling/ProfilerSpy.h>
 
 #include <OvRendering/Resources/Loaders/TextureLoader.h>
@@ -21,7 +24,8 @@ OvCore::ECS::Renderer::Renderer(OvRendering::Context::Driver& p_driver) :
 		OvRendering::Settings::ETextureFilteringMode::NEAREST,
 		OvRendering::Settings::ETextureFilteringMode::NEAREST,
 		false
-	))
+	)),
+	m_instancesSSBO(std::make_unique<OvRendering::Buffers::ShaderStorageBuffer>(OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW))
 {
 }
 
@@ -62,21 +66,16 @@ std::vector<OvMaths::FMatrix4> OvCore::ECS::Renderer::FindLightMatricesInFrustum
 {
 	std::vector<OvMaths::FMatrix4> result;
 
-	const auto& facs = p_scene.GetFastAccessComponents();
+	{
+		PROFILER_SPY("Light Culling");
+		p_scene.FindLightsInFrustum(p_frustum, m_visibleLights);
+	}
 
-	for (auto light : facs.lights)
+	for (auto light : m_visibleLights)
 	{
 		if (light->owner.IsActive())
 		{
-			const auto& lightData = light->GetData();
-			const auto& position = lightData.GetTransform().GetWorldPosition();
-			auto effectRange = lightData.GetEffectRange();
-
-			// We always consider lights that have an +inf range (Not necessary to test if they are in frustum)
-			if (std::isinf(effectRange) || p_frustum.SphereInFrustum(position.x, position.y, position.z, lightData.GetEffectRange()))
-			{
-				result.push_back(lightData.GenerateMatrix());
-			}
+			result.push_back(light->GetData().GenerateMatrix());
 		}
 	}
 
@@ -92,214 +91,268 @@ void OvCore::ECS::Renderer::RenderScene
 	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	OpaqueDrawables	opaqueMeshes;
-	TransparentDrawables transparentMeshes;
-
 	if (p_camera.HasFrustumGeometryCulling())
 	{
 		const auto& frustum = p_customFrustum ? *p_customFrustum : p_camera.GetFrustum();
-		std::tie(opaqueMeshes, transparentMeshes) = FindAndSortFrustumCulledDrawables(p_scene, p_cameraPosition, frustum, p_defaultMaterial);
+		FindAndSortFrustumCulledDrawables(m_opaqueQueue, m_transparentQueue, p_scene, p_cameraPosition, frustum, p_defaultMaterial);
 	}
 	else
 	{
-		std::tie(opaqueMeshes, transparentMeshes) = FindAndSortDrawables(p_scene, p_cameraPosition, p_defaultMaterial);
+		FindAndSortDrawables(m_opaqueQueue, m_transparentQueue, p_scene, p_cameraPosition, p_defaultMaterial);
 	}
 
-	for (const auto& [distance, drawable] : opaqueMeshes)
-		DrawDrawable(drawable);
-
-	for (const auto& [distance, drawable] : transparentMeshes)
-		DrawDrawable(drawable);
+	DrawRenderQueue(m_opaqueQueue);
+	DrawRenderQueue(m_transparentQueue);
 }
 
-void FindAndSortDrawables
+void OvCore::ECS::Renderer::FindAndSortFrustumCulledDrawables
 (
-	OvCore::ECS::Renderer::OpaqueDrawables& p_opaques,
-	OvCore::ECS::Renderer::TransparentDrawables& p_transparents,
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
 	const OvCore::SceneSystem::Scene& p_scene,
 	const OvMaths::FVector3& p_cameraPosition,
+	const OvRendering::Data::Frustum& p_frustum,
 	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	for (OvCore::ECS::Components::CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
+	using namespace OvCore::ECS::Components;
+
+	p_opaques.Clear();
+	p_transparents.Clear();
+
+	{
+		PROFILER_SPY("Frustum Culling");
+		p_scene.FindModelRenderersInFrustum(p_frustum, m_visibleModelRenderers);
+	}
+
+	for (CModelRenderer* modelRenderer : m_visibleModelRenderers)
 	{
-		if (modelRenderer->owner.IsActive())
+		auto& owner = modelRenderer->owner;
+
+		if (owner.IsActive())
 		{
 			if (auto model = modelRenderer->GetModel())
 			{
-				float distanceToActor = OvMaths::FVector3::Distance(modelRenderer->owner.transform.GetWorldPosition(), p_cameraPosition);
-
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
+				if (auto materialRenderer = owner.GetComponent<CMaterialRenderer>())
 				{
-					const auto& transform = modelRenderer->owner.transform.GetFTransform();
+					auto& transform = owner.transform.GetFTransform();
+					const auto& meshes = model->GetMeshes();
+
+					// Do not check if the meshes are in frustum if the model has only one mesh, because model and mesh bounding sphere are equals
+					const bool cullMeshes = modelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_MESHES && meshes.size() > 1;
 
+					float distanceToActor = OvMaths::FVector3::Distance(transform.GetWorldPosition(), p_cameraPosition);
 					const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
 
-					for (auto mesh : model->GetMeshes())
+					for (auto mesh : meshes)
 					{
+						if (cullMeshes && !p_frustum.BoundingSphereInFrustum(mesh->GetBoundingSphere(), transform))
+							continue;
+
 						OvCore::Resources::Material* material = nullptr;
 
 						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
 						{
-							material = materials.at(mesh->GetMaterialIndex());
+							material = materials.at(mesh->GetMaterialIndex()).Get();
 							if (!material || !material->GetShader())
 								material = p_defaultMaterial;
 						}
 
 						if (material)
 						{
-							OvCore::ECS::Renderer::Drawable element = { transform.GetWorldMatrix(), mesh, material, materialRenderer->GetUserMatrix() };
-
-							if (material->IsBlendable())
-								p_transparents.emplace(distanceToActor, element);
-							else
-								p_opaques.emplace(distanceToActor, element);
+							auto& queue = material->IsBlendable() ? p_transparents : p_opaques;
+							queue.Push(*mesh, *material, transform.GetWorldMatrix(), materialRenderer->GetUserMatrix(), distanceToActor);
 						}
 					}
 				}
 			}
 		}
 	}
+
+	{
+		PROFILER_SPY("Drawables Sorting");
+		p_opaques.Sort();
+		p_transparents.Sort();
+	}
 }
 
-std::pair<OvCore::ECS::Renderer::OpaqueDrawables, OvCore::ECS::Renderer::TransparentDrawables> OvCore::ECS::Renderer::FindAndSortFrustumCulledDrawables
+void OvCore::ECS::Renderer::FindAndSortDrawables
 (
+	RenderQueue& p_opaques,
+	RenderQueue& p_transparents,
 	const OvCore::SceneSystem::Scene& p_scene,
 	const OvMaths::FVector3& p_cameraPosition,
-	const OvRendering::Data::Frustum& p_frustum,
 	OvCore::Resources::Material* p_defaultMaterial
 )
 {
-	using namespace OvCore::ECS::Components;
+	p_opaques.Clear();
+	p_transparents.Clear();
 
-	OvCore::ECS::Renderer::OpaqueDrawables opaqueDrawables;
-	OvCore::ECS::Renderer::TransparentDrawables transparentDrawables;
-
-	for (CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
+	p_scene.ForEachComponentPair<OvCore::ECS::Components::CModelRenderer, OvCore::ECS::Components::CMaterialRenderer>([&](OvCore::ECS::Components::CModelRenderer& p_modelRenderer, OvCore::ECS::Components::CMaterialRenderer& p_materialRenderer)
 	{
-		auto& owner = modelRenderer->owner;
-
-		if (owner.IsActive())
+		if (p_modelRenderer.owner.IsActive())
 		{
-			if (auto model = modelRenderer->GetModel())
+			if (auto model = p_modelRenderer.GetModel())
 			{
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<CMaterialRenderer>())
-				{
-					auto& transform = owner.transform.GetFTransform();
-
-					OvRendering::Settings::ECullingOptions cullingOptions = OvRendering::Settings::ECullingOptions::NONE;
-
-					if (modelRenderer->GetFrustumBehaviour() != CModelRenderer::EFrustumBehaviour::DISABLED)
-					{
-						cullingOptions |= OvRendering::Settings::ECullingOptions::FRUSTUM_PER_MODEL;
-					}
+				float distanceToActor = OvMaths::FVector3::Distance(p_modelRenderer.owner.transform.GetWorldPosition(), p_cameraPosition);
 
-					if (modelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_MESHES)
-					{
-						cullingOptions |= OvRendering::Settings::ECullingOptions::FRUSTUM_PER_MESH;
-					}
+				const auto& transform = p_modelRenderer.owner.transform.GetFTransform();
 
-					const auto& modelBoundingSphere = modelRenderer->GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::CULL_CUSTOM ? modelRenderer->GetCustomBoundingSphere() : model->GetBoundingSphere();
+				const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = p_materialRenderer.GetMaterials();
 
-					std::vector<std::reference_wrapper<OvRendering::Resources::Mesh>> meshes;
+				for (auto mesh : model->GetMeshes())
+				{
+					OvCore::Resources::Material* material = nullptr;
 
+					if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
 					{
-						PROFILER_SPY("Frustum Culling");
-						meshes = GetMeshesInFrustum(*model, modelBoundingSphere, transform, p_frustum, cullingOptions);
+						material = materials.at(mesh->GetMaterialIndex()).Get();
+						if (!material || !material->GetShader())
+							material = p_defaultMaterial;
 					}
 
-					if (!meshes.empty())
+					if (material)
 					{
-						float distanceToActor = OvMaths::FVector3::Distance(transform.GetWorldPosition(), p_cameraPosition);
-						const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
-
-						for (const auto& mesh : meshes)
-						{
-							OvCore::Resources::Material* material = nullptr;
-
-							if (mesh.get().GetMaterialIndex() < MAX_MATERIAL_COUNT)
-							{
-								material = materials.at(mesh.get().GetMaterialIndex());
-								if (!material || !material->GetShader())
-									material = p_defaultMaterial;
-							}
-
-							if (material)
-							{
-								OvCore::ECS::Renderer::Drawable element = { transform.GetWorldMatrix(), &mesh.get(), material, materialRenderer->GetUserMatrix() };
-
-								if (material->IsBlendable())
-									transparentDrawables.emplace(distanceToActor, element);
-								else
-									opaqueDrawables.emplace(distanceToActor, element);
-							}
-						}
+						auto& queue = material->IsBlendable() ? p_transparents : p_opaques;
+						queue.Push(*mesh, *material, transform.GetWorldMatrix(), p_materialRenderer.GetUserMatrix(), distanceToActor);
 					}
 				}
 			}
 		}
+	});
+
+	{
+		PROFILER_SPY("Drawables Sorting");
+		p_opaques.Sort();
+		p_transparents.Sort();
 	}
+}
 
-	return { opaqueDrawables, transparentDrawables };
+void OvCore::ECS::Renderer::DrawDrawable(const Drawable& p_toDraw)
+{
+	m_userMatrixSender(*p_toDraw.userMatrix);
+	DrawMesh(*p_toDraw.mesh, *p_toDraw.material, p_toDraw.modelMatrix);
 }
 
-std::pair<OvCore::ECS::Renderer::OpaqueDrawables, OvCore::ECS::Renderer::TransparentDrawables> OvCore::ECS::Renderer::FindAndSortDrawables
-(
-	const OvCore::SceneSystem::Scene& p_scene,
-	const OvMaths::FVector3& p_cameraPosition,
-	OvCore::Resources::Material* p_defaultMaterial
-)
+void OvCore::ECS::Renderer::DrawRenderQueue(const RenderQueue& p_queue)
 {
-	OvCore::ECS::Renderer::OpaqueDrawables opaqueDrawables;
-	OvCore::ECS::Renderer::TransparentDrawables transparentDrawables;
+	const auto& drawables = p_queue.GetDrawables();
+
+	/* Consecutive drawables sharing the same mesh, material and user matrix form a run */
+	const auto findRunEnd = [&drawables](size_t p_runStart)
+	{
+		const auto& first = drawables[p_runStart];
+
+		size_t runEnd = p_runStart + 1;
+		while (runEnd < drawables.size() &&
+			drawables[runEnd].mesh == first.mesh &&
+			drawables[runEnd].material == first.material &&
+			std::memcmp(drawables[runEnd].userMatrix->data, first.userMatrix->data, sizeof(first.userMatrix->data)) == 0)
+			++runEnd;
+
+		return runEnd;
+	};
+
+	/* Materials with custom GPU instances already rely on gl_InstanceID, so they are never batched */
+	const auto isBatched = [](const Drawable& p_first, size_t p_runLength)
+	{
+		const auto& material = *p_first.material;
+		return p_runLength > 1 && material.HasShader() && material.GetGPUInstances() == 1 && material.GetShader()->SupportsInstancing();
+	};
+
+	/* Each run binds its own range of the SSBO, so its first matrix must start on an aligned offset */
+	const size_t alignment = std::max<size_t>(OvRendering::Buffers::ShaderStorageBuffer::GetOffsetAlignment() / sizeof(OvMaths::FMatrix4), 1);
+	const auto align = [alignment](size_t p_count) { return (p_count + alignment - 1) / alignment * alignment; };
+
+	/* The model matrices of every batched run are uploaded at once, instead of once per run */
+	m_instancesData.clear();
 
-	for (OvCore::ECS::Components::CModelRenderer* modelRenderer : p_scene.GetFastAccessComponents().modelRenderers)
+	for (size_t runStart = 0, runEnd = 0; runStart < drawables.size(); runStart = runEnd)
 	{
-		if (modelRenderer->owner.IsActive())
+		runEnd = findRunEnd(runStart);
+
+		if (isBatched(drawables[runStart], runEnd - runStart))
 		{
-			if (auto model = modelRenderer->GetModel())
-			{
-				float distanceToActor = OvMaths::FVector3::Distance(modelRenderer->owner.transform.GetWorldPosition(), p_cameraPosition);
+			m_instancesData.resize(align(m_instancesData.size()));
 
-				if (auto materialRenderer = modelRenderer->owner.GetComponent<OvCore::ECS::Components::CMaterialRenderer>())
-				{
-					const auto& transform = modelRenderer->owner.transform.GetFTransform();
+			for (size_t i = runStart; i < runEnd; ++i)
+				m_instancesData.push_back(OvMaths::FMatrix4::Transpose(*drawables[i].modelMatrix));
+		}
+	}
 
-					const OvCore::ECS::Components::CMaterialRenderer::MaterialList& materials = materialRenderer->GetMaterials();
+	if (!m_instancesData.empty())
+	{
+		const size_t size = m_instancesData.size() * sizeof(OvMaths::FMatrix4);
+		m_instancesSSBO->Reserve(size);
+		m_instancesSSBO->SetSubData<OvMaths::FMatrix4>(m_instancesData.data(), size, 0);
+	}
 
-					for (auto mesh : model->GetMeshes())
-					{
-						OvCore::Resources::Material* material = nullptr;
+	OvRendering::Resources::Shader* boundShader = nullptr;
+	OvCore::Resources::Material* boundMaterial = nullptr;
+	size_t instancesOffset = 0;
 
-						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
-						{
-							material = materials.at(mesh->GetMaterialIndex());
-							if (!material || !material->GetShader())
-								material = p_defaultMaterial;
-						}
+	for (size_t runStart = 0, runEnd = 0; runStart < drawables.size(); runStart = runEnd)
+	{
+		const auto& first = drawables[runStart];
+		auto& material = *first.material;
 
-						if (material)
-						{
-							OvCore::ECS::Renderer::Drawable element = { transform.GetWorldMatrix(), mesh, material, materialRenderer->GetUserMatrix() };
+		runEnd = findRunEnd(runStart);
 
-							if (material->IsBlendable())
-								transparentDrawables.emplace(distanceToActor, element);
-							else
-								opaqueDrawables.emplace(distanceToActor, element);
-						}
-					}
-				}
+		if (!material.HasShader() || material.GetGPUInstances() <= 0)
+			continue;
+
+		if (&material != boundMaterial)
+		{
+			const bool bindShader = material.GetShader() != boundShader;
+
+			ApplyStateMask(material.GenerateStateMask());
+			material.Bind(m_emptyTexture, bindShader);
+
+			if (bindShader)
+				++m_frameInfo.programBinds;
+
+			++m_frameInfo.materialBinds;
+
+			boundMaterial = &material;
+			boundShader = material.GetShader();
+		}
+
+		const size_t runLength = runEnd - runStart;
+
+		if (isBatched(first, runLength))
+		{
+			/* Every instance of the run shares the same user matrix, it is sent once through the engine UBO */
+			instancesOffset = align(instancesOffset);
+			m_userMatrixSender(*first.userMatrix);
+			DrawInstances(&first, runLength, instancesOffset);
+			instancesOffset += runLength;
+		}
+		else
+		{
+			for (size_t i = runStart; i < runEnd; ++i)
+			{
+				m_modelMatrixSender(*drawables[i].modelMatrix);
+				m_userMatrixSender(*drawables[i].userMatrix);
+				Draw(*drawables[i].mesh, OvRendering::Settings::EPrimitiveMode::TRIANGLES, material.GetGPUInstances());
 			}
 		}
 	}
 
-	return { opaqueDrawables, transparentDrawables };
+	if (boundMaterial)
+		boundMaterial->UnBind();
 }
 
-void OvCore::ECS::Renderer::DrawDrawable(const Drawable& p_toDraw)
+void OvCore::ECS::Renderer::DrawInstances(const Drawable* p_first, size_t p_count, size_t p_offset)
 {
-	m_userMatrixSender(std::get<3>(p_toDraw));
-	DrawMesh(*std::get<1>(p_toDraw), *std::get<2>(p_toDraw), &std::get<0>(p_toDraw));
+	auto& shader = *p_first->material->GetShader();
+
+	m_instancesSSBO->BindRange(1, p_offset * sizeof(OvMaths::FMatrix4), p_count * sizeof(OvMaths::FMatrix4));
+	shader.SetInstanced(true);
+
+	Draw(*p_first->mesh, OvRendering::Settings::EPrimitiveMode::TRIANGLES, static_cast<uint32_t>(p_count));
+
+	shader.SetInstanced(false);
+	m_instancesSSBO->Unbind();
 }
 
 void OvCore::ECS::Renderer::DrawModelWithSingleMaterial(OvRendering::Resources::Model& p_model, OvCore::Resources::Material& p_material, OvMaths::FMatrix4 const* p_modelMatrix, OvCore::Resources::Material* p_defaultMaterial)
@@ -343,6 +396,8 @@ void OvCore::ECS::Renderer::DrawMesh(OvRendering::Resources::Mesh& p_mesh, OvCor
 		
 		/* Draw the mesh */
 		p_material.Bind(m_emptyTexture);
+		++m_frameInfo.programBinds;
+		++m_frameInfo.materialBinds;
 		Draw(p_mesh, OvRendering::Settings::EPrimitiveMode::TRIANGLES, p_material.GetGPUInstances());
 		p_material.UnBind();
 	}
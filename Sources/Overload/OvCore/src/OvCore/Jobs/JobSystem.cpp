@@ -0,0 +1,215 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "OvCore/Jobs/JobSystem.h"
+
+namespace
+{
+	using BatchFunction = OvCore::Jobs::JobSystem::BatchFunction;
+
+	struct Batch
+	{
+		const BatchFunction* function = nullptr;
+		uint32_t begin = 0;
+		uint32_t end = 0;
+		std::atomic<uint32_t>* remaining = nullptr;
+	};
+
+	struct BatchQueue
+	{
+		std::mutex mutex;
+		std::deque<Batch> batches;
+	};
+
+	/* Queue owned by the current thread. Worker i owns the queue i + 1, other threads share the queue 0 */
+	thread_local size_t t_queueIndex = 0;
+
+	/**
+	* Workers and their queues. A thread pops the most recent batch of its own queue (Likely still in cache),
+	* and steals the oldest batch of another queue
+	*/
+	class Scheduler
+	{
+	public:
+		Scheduler()
+		{
+			/* One core is left to the main thread, which runs batches while it waits */
+			const size_t workerCount = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+
+			m_queues = std::vector<BatchQueue>(workerCount + 1);
+
+			for (size_t i = 0; i < workerCount; ++i)
+				m_workers.emplace_back([this, i] { Work(i + 1); });
+		}
+
+		~Scheduler()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_wakeMutex);
+				m_stop = true;
+			}
+
+			m_wakeCondition.notify_all();
+
+			for (auto& worker : m_workers)
+				worker.join();
+		}
+
+		void Run(uint32_t p_count, uint32_t p_batchSize, const BatchFunction& p_function)
+		{
+			const uint32_t batchCount = (p_count + p_batchSize - 1) / p_batchSize;
+			const size_t queueCount = m_queues.size();
+			const size_t ownQueue = t_queueIndex;
+
+			std::atomic<uint32_t> remaining = batchCount;
+
+			/* Batches are dealt round robin, starting with the queue of the calling thread */
+			for (size_t i = 0; i < std::min<size_t>(queueCount, batchCount); ++i)
+			{
+				auto& queue = m_queues[(ownQueue + i) % queueCount];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				for (uint32_t batch = static_cast<uint32_t>(i); batch < batchCount; batch += static_cast<uint32_t>(queueCount))
+				{
+					const uint32_t begin = batch * p_batchSize;
+					queue.batches.push_back({ &p_function, begin, begin + std::min(p_batchSize, p_count - begin), &remaining });
+				}
+			}
+
+			m_available += static_cast<int32_t>(batchCount);
+
+			/* Locking the mutex orders the notification after the check of a worker about to sleep */
+			{
+				std::lock_guard<std::mutex> lock(m_wakeMutex);
+			}
+
+			m_wakeCondition.notify_all();
+
+			/* Batches of other jobs can be run while waiting, which keeps nested jobs from blocking the thread */
+			while (remaining.load(std::memory_order_acquire) > 0)
+			{
+				if (!RunBatch(ownQueue))
+					std::this_thread::yield();
+			}
+		}
+
+		uint32_t GetThreadCount() const
+		{
+			return static_cast<uint32_t>(m_queues.size());
+		}
+
+	private:
+		void Work(size_t p_queueIndex)
+		{
+			t_queueIndex = p_queueIndex;
+
+			for (;;)
+			{
+				if (RunBatch(p_queueIndex))
+					continue;
+
+				std::unique_lock<std::mutex> lock(m_wakeMutex);
+				m_wakeCondition.wait(lock, [this] { return m_stop || m_available.load() > 0; });
+
+				if (m_stop)
+					return;
+			}
+		}
+
+		bool RunBatch(size_t p_queueIndex)
+		{
+			Batch batch;
+
+			if (!PopBatch(p_queueIndex, batch))
+				return false;
+
+			(*batch.function)(batch.begin, batch.end);
+
+			/* The job can end as soon as the counter reaches zero: the batch must not be accessed afterward */
+			batch.remaining->fetch_sub(1, std::memory_order_release);
+
+			return true;
+		}
+
+		bool PopBatch(size_t p_queueIndex, Batch& p_batch)
+		{
+			{
+				auto& queue = m_queues[p_queueIndex];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				if (!queue.batches.empty())
+				{
+					p_batch = queue.batches.back();
+					queue.batches.pop_back();
+					--m_available;
+					return true;
+				}
+			}
+
+			for (size_t offset = 1; offset < m_queues.size(); ++offset)
+			{
+				auto& queue = m_queues[(p_queueIndex + offset) % m_queues.size()];
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				if (!queue.batches.empty())
+				{
+					p_batch = queue.batches.front();
+					queue.batches.pop_front();
+					--m_available;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		std::vector<BatchQueue> m_queues;
+		std::vector<std::thread> m_workers;
+		std::atomic<int32_t> m_available = 0;
+
+		std::mutex m_wakeMutex;
+		std::condition_variable m_wakeCondition;
+		bool m_stop = false;
+	};
+
+	Scheduler& GetScheduler()
+	{
+		/* Created on the first parallel job, so applications that never run one don't spawn threads */
+		static Scheduler scheduler;
+		return scheduler;
+	}
+}
+
+void OvCore::Jobs::JobSystem::ParallelFor(uint32_t p_count, uint32_t p_batchSize, const BatchFunction& p_function)
+{
+	if (p_count == 0)
+		return;
+
+	p_batchSize = std::max(p_batchSize, 1u);
+
+	/* A single batch isn't worth waking the workers */
+	if (p_count <= p_batchSize)
+	{
+		p_function(0, p_count);
+		return;
+	}
+
+	GetScheduler().Run(p_count, p_batchSize, p_function);
+}
+
+uint32_t OvCore::Jobs::JobSystem::GetThreadCount()
+{
+	return GetScheduler().GetThreadCount();
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 */
 
 #include "OvCore/ResourceManagement/MaterialManager.h"
+#include "OvCore/ResourceManagement/TextureManager.h"
 
 OvCore::Resources::Material * OvCore::ResourceManagement::MaterialManager::CreateResource(const std::string & p_path)
 {
@@ -28,3 +29,21 @@ void OvCore::ResourceManagement::MaterialManager::ReloadResource(OvCore::Resourc
 {
 	OvCore::Resources::Loaders::MaterialLoader::Reload(*p_resource, p_path);
 }
+
+size_t OvCore::ResourceManagement::MaterialManager::GetResourceSize(OvCore::Resources::Material* p_resource) const
+{
+	using OvRendering::Resources::Texture;
+
+	size_t size = 0;
+
+	for (const auto& [name, value] : p_resource->GetUniformsData())
+	{
+		if (value.type() == typeid(Texture*))
+		{
+			if (auto texture = std::any_cast<Texture*>(value); texture)
+				size += TextureManager::GetTextureSize(*texture);
+		}
+	}
+
+	return size;
+}
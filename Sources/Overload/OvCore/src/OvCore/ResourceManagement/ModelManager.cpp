@@ -4,11 +4,33 @@
 * @licence: MIT
 */
 
+#include <filesystem>
+#include <memory>
+#include <utility>
+
 #include "OvCore/ResourceManagement/ModelManager.h"
 
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Filesystem/MemoryMappedFile.h>
 
-OvRendering::Resources::Parsers::EModelParserFlags GetAssetMetadata(const std::string& p_path)
+namespace
+{
+	/**
+	* Cooked model decoded by a worker thread. The mapping is kept open until the upload reads the vertices from it
+	*/
+	struct DecodedCookedModel
+	{
+		std::shared_ptr<OvTools::Filesystem::MemoryMappedFile> file;
+		std::shared_ptr<OvRendering::Resources::Parsers::CookedModel> model;
+	};
+
+	std::string GetCookedPath(const std::string& p_path)
+	{
+		return p_path + ".ovmesh";
+	}
+}
+
+std::pair<OvRendering::Resources::Parsers::EModelParserFlags, OvRendering::Geometry::EVertexFormat> GetAssetMetadata(const std::string& p_path)
 {
 	auto metaFile = OvTools::Filesystem::IniFile(p_path + ".meta");
 
@@ -46,17 +68,72 @@ OvRendering::Resources::Parsers::EModelParserFlags GetAssetMetadata(const std::s
 	if (metaFile.GetOrDefault("DROP_NORMALS",				false))	flags |= OvRendering::Resources::Parsers::EModelParserFlags::DROP_NORMALS;
 	if (metaFile.GetOrDefault("GEN_BOUNDING_BOXES",			false))	flags |= OvRendering::Resources::Parsers::EModelParserFlags::GEN_BOUNDING_BOXES;
 
-	return { flags };
+	const auto vertexFormat = metaFile.GetOrDefault("COMPRESS_VERTICES", false) ? OvRendering::Geometry::EVertexFormat::COMPRESSED : OvRendering::Geometry::EVertexFormat::STANDARD;
+
+	return { flags, vertexFormat };
 }
 
 OvRendering::Resources::Model* OvCore::ResourceManagement::ModelManager::CreateResource(const std::string& p_path)
+{
+	std::any decodedData = DecodeResource(p_path);
+	return UploadResource(p_path, decodedData);
+}
+
+std::any OvCore::ResourceManagement::ModelManager::DecodeResource(const std::string& p_path)
 {
 	std::string realPath = GetRealPath(p_path);
-	auto model = OvRendering::Resources::Loaders::ModelLoader::Create(realPath, GetAssetMetadata(realPath));
-	if (model)
-		*reinterpret_cast<std::string*>(reinterpret_cast<char*>(model) + offsetof(OvRendering::Resources::Model, path)) = p_path; // Force the resource path to fit the given path
+	const auto [flags, vertexFormat] = GetAssetMetadata(realPath);
+
+	/* The cooked model is used if it matches the source (Or if the source isn't shipped), skipping the Assimp import */
+	auto cookedFile = std::make_shared<OvTools::Filesystem::MemoryMappedFile>(GetCookedPath(realPath));
+
+	if (cookedFile->IsOpen())
+	{
+		auto cookedModel = std::make_shared<OvRendering::Resources::Parsers::CookedModel>(cookedFile->GetData(), cookedFile->GetSize());
+
+		if (cookedModel->IsValid() && (!std::filesystem::exists(realPath) || cookedModel->GetSourceKey() == OvRendering::Resources::Loaders::ModelLoader::ComputeSourceKey(realPath, flags, vertexFormat)))
+			return DecodedCookedModel{ cookedFile, cookedModel };
+	}
+
+	OvRendering::Resources::Loaders::ModelLoader::ModelData data;
+
+	if (!OvRendering::Resources::Loaders::ModelLoader::Decode(realPath, data, flags, vertexFormat))
+		return {};
 
-	return model;
+	return data;
+}
+
+OvRendering::Resources::Model* OvCore::ResourceManagement::ModelManager::UploadResource(const std::string& p_path, std::any& p_decodedData)
+{
+	if (auto cooked = std::any_cast<DecodedCookedModel>(&p_decodedData))
+		return OvRendering::Resources::Loaders::ModelLoader::Upload(p_path, *cooked->model);
+
+	/* An empty value means the parsing failed, models never need the main thread to parse */
+	if (auto data = std::any_cast<OvRendering::Resources::Loaders::ModelLoader::ModelData>(&p_decodedData))
+		return OvRendering::Resources::Loaders::ModelLoader::Upload(p_path, *data);
+
+	return nullptr;
+}
+
+size_t OvCore::ResourceManagement::ModelManager::GetResourceSize(OvRendering::Resources::Model* p_resource) const
+{
+	using namespace OvRendering::Geometry;
+
+	size_t size = 0;
+
+	for (auto mesh : p_resource->GetMeshes())
+	{
+		size += static_cast<size_t>(mesh->GetVertexCount()) * VertexFormat::GetVertexSize(mesh->GetVertexFormat());
+		size += static_cast<size_t>(mesh->GetIndexCount()) * VertexFormat::GetIndexSize(mesh->GetIndexType());
+	}
+
+	return size;
+}
+
+bool OvCore::ResourceManagement::ModelManager::CookModel(const std::string& p_filePath)
+{
+	const auto [flags, vertexFormat] = GetAssetMetadata(p_filePath);
+	return OvRendering::Resources::Loaders::ModelLoader::Cook(p_filePath, GetCookedPath(p_filePath), flags, vertexFormat);
 }
 
 void OvCore::ResourceManagement::ModelManager::DestroyResource(OvRendering::Resources::Model* p_resource)
@@ -67,5 +144,6 @@ void OvCore::ResourceManagement::ModelManager::DestroyResource(OvRendering::Reso
 void OvCore::ResourceManagement::ModelManager::ReloadResource(OvRendering::Resources::Model* p_resource, const std::string& p_path)
 {
 	std::string realPath = GetRealPath(p_path);
-	OvRendering::Resources::Loaders::ModelLoader::Reload(*p_resource, realPath, GetAssetMetadata(realPath));
+	const auto [flags, vertexFormat] = GetAssetMetadata(realPath);
+	OvRendering::Resources::Loaders::ModelLoader::Reload(*p_resource, realPath, flags, vertexFormat);
 }
@@ -0,0 +1,200 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OvAnalytics/Profiling/ProfilerSpy.h>
+
+#include "OvCore/ResourceManagement/ResourceLoader.h"
+
+namespace
+{
+	using UploadTask = OvCore::ResourceManagement::ResourceLoader::UploadTask;
+	using DecodeTask = OvCore::ResourceManagement::ResourceLoader::DecodeTask;
+
+	std::atomic<uint32_t> g_pendingTasks = 0;
+	float g_uploadTimeBudget = 0.008f;
+
+	/**
+	* Workers decoding the submitted tasks, and the queue of uploads they produced
+	*/
+	class WorkerPool
+	{
+	public:
+		WorkerPool()
+		{
+			/* One core is left to the main thread */
+			const size_t workerCount = std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1;
+
+			for (size_t i = 0; i < workerCount; ++i)
+				m_workers.emplace_back([this] { Work(); });
+		}
+
+		~WorkerPool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_decodeMutex);
+				m_stop = true;
+			}
+
+			m_decodeCondition.notify_all();
+
+			for (auto& worker : m_workers)
+				worker.join();
+		}
+
+		void Submit(DecodeTask p_task)
+		{
+			++g_pendingTasks;
+
+			{
+				std::lock_guard<std::mutex> lock(m_decodeMutex);
+				m_decodeTasks.push_back(std::move(p_task));
+			}
+
+			m_decodeCondition.notify_one();
+		}
+
+		bool RunUpload()
+		{
+			UploadTask task;
+
+			{
+				std::lock_guard<std::mutex> lock(m_uploadMutex);
+
+				if (m_uploadTasks.empty())
+					return false;
+
+				task = std::move(m_uploadTasks.front());
+				m_uploadTasks.pop_front();
+			}
+
+			if (task)
+				task();
+
+			--g_pendingTasks;
+
+			return true;
+		}
+
+		void WaitDecodes()
+		{
+			std::unique_lock<std::mutex> lock(m_decodeMutex);
+			m_idleCondition.wait(lock, [this] { return m_decodeTasks.empty() && m_decoding == 0; });
+		}
+
+	private:
+		void Work()
+		{
+			for (;;)
+			{
+				DecodeTask task;
+
+				{
+					std::unique_lock<std::mutex> lock(m_decodeMutex);
+					m_decodeCondition.wait(lock, [this] { return m_stop || !m_decodeTasks.empty(); });
+
+					if (m_stop)
+						return;
+
+					task = std::move(m_decodeTasks.front());
+					m_decodeTasks.pop_front();
+					++m_decoding;
+				}
+
+				UploadTask upload = task();
+
+				/* The upload is queued before the task leaves the decoding count, so WaitDecodes never misses it */
+				{
+					std::lock_guard<std::mutex> lock(m_uploadMutex);
+					m_uploadTasks.push_back(std::move(upload));
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(m_decodeMutex);
+					--m_decoding;
+				}
+
+				m_idleCondition.notify_all();
+			}
+		}
+
+	private:
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_decodeMutex;
+		std::condition_variable m_decodeCondition;
+		std::condition_variable m_idleCondition;
+		std::deque<DecodeTask> m_decodeTasks;
+		uint32_t m_decoding = 0;
+		bool m_stop = false;
+
+		std::mutex m_uploadMutex;
+		std::deque<UploadTask> m_uploadTasks;
+	};
+
+	WorkerPool& GetWorkerPool()
+	{
+		/* Created on the first submission, so applications that never load in background don't spawn threads */
+		static WorkerPool pool;
+		return pool;
+	}
+}
+
+void OvCore::ResourceManagement::ResourceLoader::Submit(DecodeTask p_task)
+{
+	GetWorkerPool().Submit(std::move(p_task));
+}
+
+void OvCore::ResourceManagement::ResourceLoader::ProcessUploads()
+{
+	if (GetPendingCount() == 0)
+		return;
+
+	PROFILER_SPY("Resource Uploads");
+
+	auto& pool = GetWorkerPool();
+	const auto start = std::chrono::steady_clock::now();
+
+	while (pool.RunUpload())
+	{
+		if (std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count() >= g_uploadTimeBudget)
+			break;
+	}
+}
+
+void OvCore::ResourceManagement::ResourceLoader::Flush()
+{
+	if (GetPendingCount() == 0)
+		return;
+
+	auto& pool = GetWorkerPool();
+
+	/* An upload can submit new tasks (A resource depending on another one), so flushing loops until nothing is left */
+	while (GetPendingCount() > 0)
+	{
+		pool.WaitDecodes();
+
+		while (pool.RunUpload());
+	}
+}
+
+void OvCore::ResourceManagement::ResourceLoader::SetUploadTimeBudget(float p_budget)
+{
+	g_uploadTimeBudget = p_budget;
+}
+
+uint32_t OvCore::ResourceManagement::ResourceLoader::GetPendingCount()
+{
+	return g_pendingTasks;
+}
\ No newline at end of file
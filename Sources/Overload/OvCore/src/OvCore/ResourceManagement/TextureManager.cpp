@@ -4,45 +4,140 @@
 * @licence: MIT
 */
 
+#include <filesystem>
+#include <memory>
+#include <algorithm>
+
 #include "OvCore/ResourceManagement/TextureManager.h"
 #include "OvRendering/Settings/DriverSettings.h"
 
 #include <OvTools/Filesystem/IniFile.h>
+#include <OvTools/Filesystem/MemoryMappedFile.h>
+#include <OvRendering/Resources/Parsers/BlockCompressor.h>
 
-std::tuple<OvRendering::Settings::ETextureFilteringMode, OvRendering::Settings::ETextureFilteringMode, bool> GetAssetMetadata(const std::string& p_path)
+namespace
+{
+	/**
+	* Texture data and settings decoded by a worker thread
+	*/
+	struct DecodedTexture
+	{
+		OvRendering::Resources::Loaders::TextureLoader::TextureData data;
+		OvRendering::Settings::ETextureFilteringMode firstFilter;
+		OvRendering::Settings::ETextureFilteringMode secondFilter;
+		bool generateMipmap;
+	};
+
+	/**
+	* Cooked texture decoded by a worker thread. The mapping is kept open until the upload reads the levels from it
+	*/
+	struct DecodedCookedTexture
+	{
+		std::shared_ptr<OvTools::Filesystem::MemoryMappedFile> file;
+		std::shared_ptr<OvRendering::Resources::Parsers::CookedTexture> texture;
+		OvRendering::Settings::ETextureFilteringMode firstFilter;
+		OvRendering::Settings::ETextureFilteringMode secondFilter;
+	};
+
+	std::string GetCookedPath(const std::string& p_path)
+	{
+		return p_path + ".ovtex";
+	}
+}
+
+std::tuple<OvRendering::Settings::ETextureFilteringMode, OvRendering::Settings::ETextureFilteringMode, bool, OvRendering::Settings::ETextureCompression> GetAssetMetadata(const std::string& p_path)
 {
 	auto metaFile = OvTools::Filesystem::IniFile(p_path + ".meta");
 
 	auto min = metaFile.GetOrDefault("MIN_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR_MIPMAP_LINEAR));
 	auto mag = metaFile.GetOrDefault("MAG_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR));
 	auto mipmap = metaFile.GetOrDefault("ENABLE_MIPMAPPING", true);
+	auto compression = metaFile.GetOrDefault("COMPRESSION", static_cast<int>(OvRendering::Settings::ETextureCompression::NONE));
 
-	return { static_cast<OvRendering::Settings::ETextureFilteringMode>(min), static_cast<OvRendering::Settings::ETextureFilteringMode>(mag), mipmap };
+	return { static_cast<OvRendering::Settings::ETextureFilteringMode>(min), static_cast<OvRendering::Settings::ETextureFilteringMode>(mag), mipmap, static_cast<OvRendering::Settings::ETextureCompression>(compression) };
 }
 
 OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::CreateResource(const std::string & p_path)
+{
+	std::any decodedData = DecodeResource(p_path);
+	return UploadResource(p_path, decodedData);
+}
+
+void OvCore::ResourceManagement::TextureManager::DestroyResource(OvRendering::Resources::Texture* p_resource)
+{
+	OvRendering::Resources::Loaders::TextureLoader::Destroy(p_resource);
+}
+
+std::any OvCore::ResourceManagement::TextureManager::DecodeResource(const std::string& p_path)
 {
 	std::string realPath = GetRealPath(p_path);
 
-	auto [min, mag, mipmap] = GetAssetMetadata(realPath);
+	DecodedTexture decoded;
+	OvRendering::Settings::ETextureCompression compression;
+	std::tie(decoded.firstFilter, decoded.secondFilter, decoded.generateMipmap, compression) = GetAssetMetadata(realPath);
+
+	/* The cooked texture is used if it matches the source (Or if the source isn't shipped), skipping the image decoding */
+	auto cookedFile = std::make_shared<OvTools::Filesystem::MemoryMappedFile>(GetCookedPath(realPath));
+
+	if (cookedFile->IsOpen())
+	{
+		auto cookedTexture = std::make_shared<OvRendering::Resources::Parsers::CookedTexture>(cookedFile->GetData(), cookedFile->GetSize());
+
+		if (cookedTexture->IsValid() && (!std::filesystem::exists(realPath) || cookedTexture->GetSourceKey() == OvRendering::Resources::Loaders::TextureLoader::ComputeSourceKey(realPath, compression, decoded.generateMipmap)))
+			return DecodedCookedTexture{ cookedFile, cookedTexture, decoded.firstFilter, decoded.secondFilter };
+	}
 
-	OvRendering::Resources::Texture* texture = OvRendering::Resources::Loaders::TextureLoader::Create(realPath, min, mag, mipmap);
-	if (texture)
-		*reinterpret_cast<std::string*>(reinterpret_cast<char*>(texture) + offsetof(OvRendering::Resources::Texture, path)) = p_path; // Force the resource path to fit the given path
+	if (!OvRendering::Resources::Loaders::TextureLoader::Decode(realPath, decoded.data))
+		return {};
 
-	return texture;
+	return decoded;
 }
 
-void OvCore::ResourceManagement::TextureManager::DestroyResource(OvRendering::Resources::Texture* p_resource)
+OvRendering::Resources::Texture* OvCore::ResourceManagement::TextureManager::UploadResource(const std::string& p_path, std::any& p_decodedData)
 {
-	OvRendering::Resources::Loaders::TextureLoader::Destroy(p_resource);
+	if (auto cooked = std::any_cast<DecodedCookedTexture>(&p_decodedData))
+		return OvRendering::Resources::Loaders::TextureLoader::Upload(p_path, *cooked->texture, cooked->firstFilter, cooked->secondFilter);
+
+	auto decoded = std::any_cast<DecodedTexture>(&p_decodedData);
+
+	/* An empty value means the decoding failed, textures never need the main thread to decode */
+	if (!decoded)
+		return nullptr;
+
+	return OvRendering::Resources::Loaders::TextureLoader::Upload(p_path, decoded->data, decoded->firstFilter, decoded->secondFilter, decoded->generateMipmap);
+}
+
+size_t OvCore::ResourceManagement::TextureManager::GetResourceSize(OvRendering::Resources::Texture* p_resource) const
+{
+	return GetTextureSize(*p_resource);
 }
 
 void OvCore::ResourceManagement::TextureManager::ReloadResource(OvRendering::Resources::Texture* p_resource, const std::string& p_path)
 {
 	std::string realPath = GetRealPath(p_path);
 
-	auto [min, mag, mipmap] = GetAssetMetadata(realPath);
+	auto [min, mag, mipmap, compression] = GetAssetMetadata(realPath);
 
 	OvRendering::Resources::Loaders::TextureLoader::Reload(*p_resource, realPath, min, mag, mipmap);
 }
+
+bool OvCore::ResourceManagement::TextureManager::CookTexture(const std::string& p_filePath)
+{
+	auto [min, mag, mipmap, compression] = GetAssetMetadata(p_filePath);
+	return OvRendering::Resources::Loaders::TextureLoader::Cook(p_filePath, GetCookedPath(p_filePath), compression, mipmap);
+}
+
+size_t OvCore::ResourceManagement::TextureManager::GetTextureSize(const OvRendering::Resources::Texture& p_texture)
+{
+	size_t size = 0;
+
+	for (uint32_t width = p_texture.width, height = p_texture.height;; width = std::max(width / 2, 1u), height = std::max(height / 2, 1u))
+	{
+		size += OvRendering::Resources::Parsers::BlockCompressor::GetCompressedSize(p_texture.compression, width, height);
+
+		if (!p_texture.isMimapped || (width == 1 && height == 1))
+			break;
+	}
+
+	return size;
+}
@@ -33,14 +33,15 @@ void OvCore::Resources::Material::FillUniform()
 		m_uniformsData.emplace(element.name, element.defaultValue);
 }
 
-void OvCore::Resources::Material::Bind(OvRendering::Resources::Texture* p_emptyTexture)
+void OvCore::Resources::Material::Bind(OvRendering::Resources::Texture* p_emptyTexture, bool p_bindShader)
 {
 	if (HasShader())
 	{
 		using namespace OvMaths;
 		using namespace OvRendering::Resources;
 
-		m_shader->Bind();
+		if (p_bindShader)
+			m_shader->Bind();
 
 		int textureSlot = 0;
 
@@ -186,6 +187,30 @@ std::map<std::string, std::any>& OvCore::Resources::Material::GetUniformsData()
 	return m_uniformsData;
 }
 
+void OvCore::Resources::Material::UpdateTextureReferences()
+{
+	using namespace OvRendering::Resources;
+
+	std::map<std::string, ResourceManagement::ResourceHandle<Texture>> references;
+
+	/* The new references are taken before the previous ones are released, so unchanged textures never become evictable */
+	for (const auto& [name, value] : m_uniformsData)
+	{
+		if (value.type() == typeid(Texture*))
+		{
+			if (auto texture = std::any_cast<Texture*>(value); texture)
+			{
+				if (auto previous = m_textureReferences.find(name); previous != m_textureReferences.end() && previous->second.Get() == texture)
+					references.emplace(name, std::move(previous->second));
+				else
+					references.emplace(name, ResourceManagement::ResourceHandle<Texture>(OVSERVICE(ResourceManagement::TextureManager), texture));
+			}
+		}
+	}
+
+	m_textureReferences = std::move(references);
+}
+
 void OvCore::Resources::Material::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_node)
 {
 	using namespace OvCore::Helpers;
@@ -334,4 +359,6 @@ void OvCore::Resources::Material::OnDeserialize(tinyxml2::XMLDocument & p_doc, t
 			}
 		}
 	}
+
+	UpdateTextureReferences();
 }
\ No newline at end of file
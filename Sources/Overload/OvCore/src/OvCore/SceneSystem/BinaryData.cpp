@@ -0,0 +1,162 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvCore/SceneSystem/BinaryData.h"
+
+OvCore::SceneSystem::BinaryData::BinaryData(const BinaryScene& p_scene, uint32_t p_firstNode, uint32_t p_nodeCount) :
+	m_scene(p_scene),
+	m_firstNode(p_firstNode),
+	m_nodeCount(p_nodeCount)
+{
+}
+
+bool OvCore::SceneSystem::BinaryData::Has(const std::string& p_name) const
+{
+	return Find(p_name) != nullptr;
+}
+
+void OvCore::SceneSystem::BinaryData::ReadBoolean(const std::string& p_name, bool& p_out) const
+{
+	if (auto node = Find(p_name))
+		p_out = node->value != 0.0f;
+}
+
+void OvCore::SceneSystem::BinaryData::ReadInt(const std::string& p_name, int& p_out) const
+{
+	if (auto node = Find(p_name))
+		p_out = static_cast<int>(node->value);
+}
+
+void OvCore::SceneSystem::BinaryData::ReadFloat(const std::string& p_name, float& p_out) const
+{
+	if (auto node = Find(p_name))
+		p_out = node->value;
+}
+
+void OvCore::SceneSystem::BinaryData::ReadVec3(const std::string& p_name, OvMaths::FVector3& p_out) const
+{
+	const BinaryData vector = GetChild(p_name);
+	vector.ReadFloat("x", p_out.x);
+	vector.ReadFloat("y", p_out.y);
+	vector.ReadFloat("z", p_out.z);
+}
+
+void OvCore::SceneSystem::BinaryData::ReadString(const std::string& p_name, std::string& p_out) const
+{
+	if (auto node = Find(p_name))
+		p_out = m_scene.GetString(node->text);
+}
+
+bool OvCore::SceneSystem::BinaryData::ReadBoolean(const std::string& p_name) const
+{
+	bool result = false;
+	ReadBoolean(p_name, result);
+	return result;
+}
+
+int OvCore::SceneSystem::BinaryData::ReadInt(const std::string& p_name) const
+{
+	int result = 0;
+	ReadInt(p_name, result);
+	return result;
+}
+
+float OvCore::SceneSystem::BinaryData::ReadFloat(const std::string& p_name) const
+{
+	float result = 0.0f;
+	ReadFloat(p_name, result);
+	return result;
+}
+
+OvMaths::FVector3 OvCore::SceneSystem::BinaryData::ReadVec3(const std::string& p_name) const
+{
+	OvMaths::FVector3 result(0.0f, 0.0f, 0.0f);
+	ReadVec3(p_name, result);
+	return result;
+}
+
+std::string OvCore::SceneSystem::BinaryData::ReadString(const std::string& p_name) const
+{
+	std::string result;
+	ReadString(p_name, result);
+	return result;
+}
+
+std::vector<std::string> OvCore::SceneSystem::BinaryData::ReadStringList(const std::string& p_name) const
+{
+	std::vector<std::string> result;
+
+	uint32_t index = 0;
+
+	if (auto node = Find(p_name, &index))
+	{
+		const auto& nodes = m_scene.GetNodes();
+		const uint32_t end = m_firstNode + m_nodeCount;
+
+		/* Children are stored right after their parent, each one followed by its own subtree */
+		++index;
+
+		for (uint32_t i = 0; i < node->childCount && index < end; ++i)
+		{
+			result.push_back(m_scene.GetString(nodes[index].text));
+
+			uint32_t pending = nodes[index++].childCount;
+			for (; pending > 0 && index < end; ++index)
+				pending = pending - 1 + nodes[index].childCount;
+		}
+	}
+
+	return result;
+}
+
+OvCore::SceneSystem::BinaryData OvCore::SceneSystem::BinaryData::GetChild(const std::string& p_name) const
+{
+	uint32_t index = 0;
+
+	if (!Find(p_name, &index))
+		return BinaryData(m_scene, 0, 0);
+
+	/* The subtree of a node ends where the count of its pending descendants reaches zero */
+	const auto& nodes = m_scene.GetNodes();
+	const uint32_t end = m_firstNode + m_nodeCount;
+
+	uint32_t last = index + 1;
+	for (uint32_t pending = nodes[index].childCount; pending > 0 && last < end; ++last)
+		pending = pending - 1 + nodes[last].childCount;
+
+	return BinaryData(m_scene, index + 1, last - index - 1);
+}
+
+void OvCore::SceneSystem::BinaryData::BuildNodes(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent) const
+{
+	m_scene.BuildNodes(p_doc, p_parent, m_firstNode, m_nodeCount);
+}
+
+const OvCore::SceneSystem::BinaryScene::NodeRecord* OvCore::SceneSystem::BinaryData::Find(const std::string& p_name, uint32_t* p_index) const
+{
+	const auto& nodes = m_scene.GetNodes();
+	const uint32_t end = m_firstNode + m_nodeCount;
+
+	/* Only the root nodes of the range are compared, the subtree of any other node is skipped */
+	for (uint32_t index = m_firstNode; index < end;)
+	{
+		const BinaryScene::NodeRecord& node = nodes[index];
+
+		if (p_name == m_scene.GetString(node.name))
+		{
+			if (p_index)
+				*p_index = index;
+
+			return &node;
+		}
+
+		uint32_t pending = node.childCount;
+		for (++index; pending > 0 && index < end; ++index)
+			pending = pending - 1 + nodes[index].childCount;
+	}
+
+	return nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,751 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <OvTools/Filesystem/MemoryMappedFile.h>
+
+#include "OvCore/SceneSystem/BinaryScene.h"
+#include "OvCore/ECS/Actor.h"
+#include "OvCore/Helpers/Serializer.h"
+
+namespace
+{
+	using namespace OvCore::SceneSystem;
+
+	constexpr char		SIGNATURE[4]	= { 'O', 'V', 'S', 'B' };
+	constexpr uint32_t	CHUNK_ALIGNMENT	= 8;
+	constexpr uint32_t	MAX_NODE_DEPTH	= 64;
+
+	constexpr uint32_t MakeChunkID(const char p_id[5])
+	{
+		return uint32_t(p_id[0]) | (uint32_t(p_id[1]) << 8) | (uint32_t(p_id[2]) << 16) | (uint32_t(p_id[3]) << 24);
+	}
+
+	constexpr uint32_t STRINGS_CHUNK	= MakeChunkID("STRS");
+	constexpr uint32_t ACTORS_CHUNK		= MakeChunkID("ACTR");
+	constexpr uint32_t TRANSFORMS_CHUNK	= MakeChunkID("TRSF");
+	constexpr uint32_t COMPONENTS_CHUNK	= MakeChunkID("CMPS");
+	constexpr uint32_t BEHAVIOURS_CHUNK	= MakeChunkID("BHVR");
+	constexpr uint32_t NODES_CHUNK		= MakeChunkID("NODE");
+	constexpr uint32_t RESOURCES_CHUNK	= MakeChunkID("RSRC");
+
+	struct Header
+	{
+		char		signature[4];
+		uint32_t	version;
+		uint32_t	chunkCount;
+		uint32_t	reserved;
+	};
+
+	struct ChunkEntry
+	{
+		uint32_t id;
+		uint32_t offset;
+		uint32_t size;
+		uint32_t count;
+	};
+
+	struct ComponentBlockHeader
+	{
+		uint32_t type;
+		uint32_t count;
+	};
+
+	/* Numbers and booleans serialized as text are stored parsed next to their text (0 for anything else) */
+	float ParseNodeValue(const char* p_text)
+	{
+		if (!p_text)
+			return 0.0f;
+
+		if (std::strcmp(p_text, "true") == 0)
+			return 1.0f;
+
+		char* end = nullptr;
+		const float value = std::strtof(p_text, &end);
+		return end != p_text && *end == '\0' ? value : 0.0f;
+	}
+
+	/* Chunks are assembled one after the other, each one starting on an aligned offset */
+	class ChunkWriter
+	{
+	public:
+		template<typename T>
+		void Write(const T& p_value)
+		{
+			const char* bytes = reinterpret_cast<const char*>(&p_value);
+			m_current.insert(m_current.end(), bytes, bytes + sizeof(T));
+		}
+
+		template<typename T>
+		void WriteArray(const std::vector<T>& p_values)
+		{
+			const char* bytes = reinterpret_cast<const char*>(p_values.data());
+			m_current.insert(m_current.end(), bytes, bytes + p_values.size() * sizeof(T));
+		}
+
+		void WriteBytes(const char* p_data, size_t p_size)
+		{
+			m_current.insert(m_current.end(), p_data, p_data + p_size);
+		}
+
+		void EndChunk(uint32_t p_id, uint32_t p_count)
+		{
+			m_chunks.push_back({ p_id, 0, static_cast<uint32_t>(m_current.size()), p_count });
+			m_chunksData.push_back(std::move(m_current));
+			m_current.clear();
+		}
+
+		std::vector<char> Assemble() const
+		{
+			auto align = [](size_t p_offset) { return (p_offset + CHUNK_ALIGNMENT - 1) & ~size_t(CHUNK_ALIGNMENT - 1); };
+
+			std::vector<ChunkEntry> chunks = m_chunks;
+			size_t offset = align(sizeof(Header) + sizeof(ChunkEntry) * chunks.size());
+
+			for (auto& chunk : chunks)
+			{
+				chunk.offset = static_cast<uint32_t>(offset);
+				offset = align(offset + chunk.size);
+			}
+
+			std::vector<char> result(offset, 0);
+
+			Header header;
+			std::memcpy(header.signature, SIGNATURE, sizeof(SIGNATURE));
+			header.version = BinaryScene::VERSION;
+			header.chunkCount = static_cast<uint32_t>(chunks.size());
+			header.reserved = 0;
+
+			std::memcpy(result.data(), &header, sizeof(Header));
+			std::memcpy(result.data() + sizeof(Header), chunks.data(), sizeof(ChunkEntry) * chunks.size());
+
+			for (size_t i = 0; i < chunks.size(); ++i)
+				if (!m_chunksData[i].empty())
+					std::memcpy(result.data() + chunks[i].offset, m_chunksData[i].data(), m_chunksData[i].size());
+
+			return result;
+		}
+
+	private:
+		std::vector<char> m_current;
+		std::vector<ChunkEntry> m_chunks;
+		std::vector<std::vector<char>> m_chunksData;
+	};
+
+	/* Collects the content of an XML scene, interning every string */
+	class SceneCompiler
+	{
+	public:
+		SceneCompiler(tinyxml2::XMLDocument& p_doc) : m_doc(p_doc)
+		{
+			Intern("");
+		}
+
+		bool Compile(tinyxml2::XMLNode* p_sceneNode)
+		{
+			if (auto actorsRoot = p_sceneNode->FirstChildElement("actors"))
+			{
+				for (auto actorNode = actorsRoot->FirstChildElement("actor"); actorNode; actorNode = actorNode->NextSiblingElement("actor"))
+					CompileActor(actorNode);
+			}
+
+			return true;
+		}
+
+		std::vector<char> Assemble() const
+		{
+			ChunkWriter writer;
+
+			/* Strings: offsets, followed by the null terminated characters */
+			std::vector<uint32_t> offsets;
+			std::vector<char> characters;
+			offsets.reserve(m_strings.size());
+
+			for (auto& string : m_strings)
+			{
+				offsets.push_back(static_cast<uint32_t>(characters.size()));
+				characters.insert(characters.end(), string.begin(), string.end());
+				characters.push_back('\0');
+			}
+
+			writer.WriteArray(offsets);
+			writer.WriteBytes(characters.data(), characters.size());
+			writer.EndChunk(STRINGS_CHUNK, static_cast<uint32_t>(m_strings.size()));
+
+			writer.WriteArray(m_actors);
+			writer.EndChunk(ACTORS_CHUNK, static_cast<uint32_t>(m_actors.size()));
+
+			writer.WriteArray(m_transforms);
+			writer.EndChunk(TRANSFORMS_CHUNK, static_cast<uint32_t>(m_transforms.size()));
+
+			for (auto& [type, components] : m_componentBlocks)
+			{
+				writer.Write(ComponentBlockHeader{ type, static_cast<uint32_t>(components.size()) });
+				writer.WriteArray(components);
+			}
+			writer.EndChunk(COMPONENTS_CHUNK, static_cast<uint32_t>(m_componentBlocks.size()));
+
+			writer.WriteArray(m_behaviours);
+			writer.EndChunk(BEHAVIOURS_CHUNK, static_cast<uint32_t>(m_behaviours.size()));
+
+			writer.WriteArray(m_nodes);
+			writer.EndChunk(NODES_CHUNK, static_cast<uint32_t>(m_nodes.size()));
+
+			writer.WriteArray(m_resources);
+			writer.EndChunk(RESOURCES_CHUNK, static_cast<uint32_t>(m_resources.size()));
+
+			return writer.Assemble();
+		}
+
+	private:
+		uint32_t Intern(const char* p_string)
+		{
+			auto [it, inserted] = m_stringsIDs.emplace(p_string ? p_string : "", static_cast<uint32_t>(m_strings.size()));
+
+			if (inserted)
+				m_strings.push_back(it->first);
+
+			return it->second;
+		}
+
+		const char* GetChildText(tinyxml2::XMLNode* p_node, const char* p_name)
+		{
+			auto child = p_node->FirstChildElement(p_name);
+			return child && child->GetText() ? child->GetText() : "";
+		}
+
+		void CompileActor(tinyxml2::XMLElement* p_actorNode)
+		{
+			using namespace OvCore::Helpers;
+
+			const uint32_t actorIndex = static_cast<uint32_t>(m_actors.size());
+
+			BinaryScene::ActorRecord actor{};
+			actor.name = Intern(GetChildText(p_actorNode, "name"));
+			actor.tag = Intern(GetChildText(p_actorNode, "tag"));
+			actor.active = Serializer::DeserializeBoolean(m_doc, p_actorNode, "active") ? 1 : 0;
+			actor.id = Serializer::DeserializeInt64(m_doc, p_actorNode, "id");
+			actor.parent = Serializer::DeserializeInt64(m_doc, p_actorNode, "parent");
+			m_actors.push_back(actor);
+
+			BinaryScene::TransformRecord transform{ actorIndex, 0, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f } };
+
+			if (auto componentsRoot = p_actorNode->FirstChildElement("components"))
+			{
+				uint32_t order = 0;
+
+				for (auto componentNode = componentsRoot->FirstChildElement("component"); componentNode; componentNode = componentNode->NextSiblingElement("component"), ++order)
+				{
+					const std::string type = OvCore::ECS::Actor::ResolveSerializationID(GetChildText(componentNode, "type"));
+					tinyxml2::XMLElement* data = componentNode->FirstChildElement("data");
+
+					if (type == OvCore::ECS::Components::CTransform::SERIALIZATION_ID)
+					{
+						transform.order = order;
+
+						if (data)
+						{
+							const auto position = Serializer::DeserializeVec3(m_doc, data, "position");
+							const auto rotation = Serializer::DeserializeQuat(m_doc, data, "rotation");
+							const auto scale = Serializer::DeserializeVec3(m_doc, data, "scale");
+
+							std::memcpy(transform.position, &position, sizeof(transform.position));
+							std::memcpy(transform.rotation, &rotation, sizeof(transform.rotation));
+							std::memcpy(transform.scale, &scale, sizeof(transform.scale));
+						}
+					}
+					else
+					{
+						const uint32_t typeID = Intern(type.c_str());
+
+						auto [block, inserted] = m_componentBlocksIndices.emplace(typeID, m_componentBlocks.size());
+						if (inserted)
+							m_componentBlocks.emplace_back(typeID, std::vector<BinaryScene::ComponentRecord>());
+
+						const uint32_t firstNode = static_cast<uint32_t>(m_nodes.size());
+						CompileNodes(data);
+						m_componentBlocks[block->second].second.push_back({ actorIndex, order, firstNode, static_cast<uint32_t>(m_nodes.size()) - firstNode });
+					}
+				}
+			}
+
+			m_transforms.push_back(transform);
+
+			if (auto behavioursRoot = p_actorNode->FirstChildElement("behaviours"))
+			{
+				for (auto behaviourNode = behavioursRoot->FirstChildElement("behaviour"); behaviourNode; behaviourNode = behaviourNode->NextSiblingElement("behaviour"))
+				{
+					const uint32_t type = Intern(GetChildText(behaviourNode, "type"));
+					const uint32_t firstNode = static_cast<uint32_t>(m_nodes.size());
+					CompileNodes(behaviourNode->FirstChildElement("data"));
+					m_behaviours.push_back({ actorIndex, type, firstNode, static_cast<uint32_t>(m_nodes.size()) - firstNode });
+				}
+			}
+		}
+
+		/* Append the children of the given node in pre-order */
+		void CompileNodes(tinyxml2::XMLElement* p_parent)
+		{
+			if (!p_parent)
+				return;
+
+			for (auto child = p_parent->FirstChildElement(); child; child = child->NextSiblingElement())
+			{
+				const size_t index = m_nodes.size();
+				const char* text = child->GetText();
+
+				m_nodes.push_back({ Intern(child->Name()), Intern(text), 0, ParseNodeValue(text) });
+
+				if (text)
+					RegisterResource(text);
+
+				uint32_t childCount = 0;
+				for (auto grandChild = child->FirstChildElement(); grandChild; grandChild = grandChild->NextSiblingElement())
+					++childCount;
+
+				m_nodes[index].childCount = childCount;
+				CompileNodes(child);
+			}
+		}
+
+		void RegisterResource(const char* p_text)
+		{
+			using EFileType = OvTools::Utils::PathParser::EFileType;
+
+			const EFileType type = OvTools::Utils::PathParser::GetFileType(p_text);
+
+			if (type == EFileType::MODEL || type == EFileType::TEXTURE || type == EFileType::SHADER || type == EFileType::MATERIAL || type == EFileType::SOUND)
+			{
+				const uint32_t path = Intern(p_text);
+
+				if (m_registeredResources.insert(path).second)
+					m_resources.push_back({ path, type });
+			}
+		}
+
+	private:
+		tinyxml2::XMLDocument& m_doc;
+
+		std::unordered_map<std::string, uint32_t> m_stringsIDs;
+		std::vector<std::string> m_strings;
+
+		std::vector<BinaryScene::ActorRecord> m_actors;
+		std::vector<BinaryScene::TransformRecord> m_transforms;
+		std::unordered_map<uint32_t, size_t> m_componentBlocksIndices;
+		std::vector<std::pair<uint32_t, std::vector<BinaryScene::ComponentRecord>>> m_componentBlocks;
+		std::vector<BinaryScene::BehaviourRecord> m_behaviours;
+		std::vector<BinaryScene::NodeRecord> m_nodes;
+		std::unordered_set<uint32_t> m_registeredResources;
+		std::vector<BinaryScene::ResourceRecord> m_resources;
+	};
+
+	bool WriteFile(const std::string& p_path, const std::vector<char>& p_data)
+	{
+		std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+		file.write(p_data.data(), p_data.size());
+		return file.good();
+	}
+}
+
+OvCore::SceneSystem::BinaryScene::BinaryScene(const char* p_data, size_t p_size) :
+	m_data(p_data),
+	m_size(p_size)
+{
+	m_valid = Parse();
+}
+
+bool OvCore::SceneSystem::BinaryScene::IsBinaryScene(const char* p_data, size_t p_size)
+{
+	return p_data && p_size >= sizeof(Header) && std::memcmp(p_data, SIGNATURE, sizeof(SIGNATURE)) == 0;
+}
+
+bool OvCore::SceneSystem::BinaryScene::IsValid() const
+{
+	return m_valid;
+}
+
+const char* OvCore::SceneSystem::BinaryScene::GetString(uint32_t p_index) const
+{
+	return p_index < m_stringCount ? m_stringData + m_stringOffsets[p_index] : "";
+}
+
+const OvCore::SceneSystem::BinaryScene::Records<OvCore::SceneSystem::BinaryScene::ActorRecord>& OvCore::SceneSystem::BinaryScene::GetActors() const
+{
+	return m_actors;
+}
+
+const OvCore::SceneSystem::BinaryScene::Records<OvCore::SceneSystem::BinaryScene::TransformRecord>& OvCore::SceneSystem::BinaryScene::GetTransforms() const
+{
+	return m_transforms;
+}
+
+const std::vector<OvCore::SceneSystem::BinaryScene::ComponentBlock>& OvCore::SceneSystem::BinaryScene::GetComponentBlocks() const
+{
+	return m_componentBlocks;
+}
+
+const OvCore::SceneSystem::BinaryScene::Records<OvCore::SceneSystem::BinaryScene::BehaviourRecord>& OvCore::SceneSystem::BinaryScene::GetBehaviours() const
+{
+	return m_behaviours;
+}
+
+const OvCore::SceneSystem::BinaryScene::Records<OvCore::SceneSystem::BinaryScene::ResourceRecord>& OvCore::SceneSystem::BinaryScene::GetResources() const
+{
+	return m_resources;
+}
+
+const OvCore::SceneSystem::BinaryScene::Records<OvCore::SceneSystem::BinaryScene::NodeRecord>& OvCore::SceneSystem::BinaryScene::GetNodes() const
+{
+	return m_nodes;
+}
+
+std::vector<OvCore::SceneSystem::BinaryScene::ComponentEntry> OvCore::SceneSystem::BinaryScene::GetOrderedComponents(std::vector<uint32_t>& p_actorOffsets) const
+{
+	/* Counting sort by actor, then by serialization order inside each actor (Actors only have a few components) */
+	p_actorOffsets.assign(m_actors.count + 1, 0);
+
+	for (auto& transform : m_transforms)
+		++p_actorOffsets[transform.actor + 1];
+
+	for (auto& block : m_componentBlocks)
+		for (auto& component : block.components)
+			++p_actorOffsets[component.actor + 1];
+
+	for (uint32_t i = 0; i < m_actors.count; ++i)
+		p_actorOffsets[i + 1] += p_actorOffsets[i];
+
+	std::vector<ComponentEntry> entries(p_actorOffsets.back());
+	std::vector<uint32_t> cursors(p_actorOffsets.begin(), p_actorOffsets.end() - 1);
+
+	for (auto& transform : m_transforms)
+		entries[cursors[transform.actor]++] = { OvCore::ECS::Components::CTransform::SERIALIZATION_ID, &transform, nullptr };
+
+	for (auto& block : m_componentBlocks)
+		for (auto& component : block.components)
+			entries[cursors[component.actor]++] = { block.type, nullptr, &component };
+
+	auto order = [](const ComponentEntry& p_entry) { return p_entry.transform ? p_entry.transform->order : p_entry.component->order; };
+
+	for (uint32_t i = 0; i < m_actors.count; ++i)
+	{
+		std::sort(entries.begin() + p_actorOffsets[i], entries.begin() + p_actorOffsets[i + 1], [&order](const ComponentEntry& p_left, const ComponentEntry& p_right)
+		{
+			return order(p_left) < order(p_right);
+		});
+	}
+
+	return entries;
+}
+
+void OvCore::SceneSystem::BinaryScene::BuildNodes(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent, uint32_t p_firstNode, uint32_t p_nodeCount) const
+{
+	uint32_t index = p_firstNode;
+	const uint32_t end = p_firstNode + p_nodeCount;
+
+	while (index < end)
+		BuildNode(p_doc, p_parent, index, end, 0);
+}
+
+void OvCore::SceneSystem::BinaryScene::BuildNode(tinyxml2::XMLDocument& p_doc, tinyxml2::XMLNode* p_parent, uint32_t& p_index, uint32_t p_end, uint32_t p_depth) const
+{
+	const NodeRecord& node = m_nodes[p_index++];
+
+	tinyxml2::XMLElement* element = p_doc.NewElement(GetString(node.name));
+	p_parent->InsertEndChild(element);
+
+	if (node.text != 0)
+		element->SetText(GetString(node.text));
+
+	if (p_depth < MAX_NODE_DEPTH)
+	{
+		for (uint32_t i = 0; i < node.childCount && p_index < p_end; ++i)
+			BuildNode(p_doc, element, p_index, p_end, p_depth + 1);
+	}
+}
+
+void OvCore::SceneSystem::BinaryScene::Decompile(tinyxml2::XMLDocument& p_doc) const
+{
+	using namespace OvCore::Helpers;
+
+	p_doc.Clear();
+
+	tinyxml2::XMLNode* root = p_doc.NewElement("root");
+	p_doc.InsertFirstChild(root);
+
+	tinyxml2::XMLNode* sceneNode = p_doc.NewElement("scene");
+	root->InsertEndChild(sceneNode);
+
+	tinyxml2::XMLNode* actorsNode = p_doc.NewElement("actors");
+	sceneNode->InsertEndChild(actorsNode);
+
+	std::vector<uint32_t> actorOffsets;
+	const auto components = GetOrderedComponents(actorOffsets);
+	const BehaviourRecord* behaviour = m_behaviours.begin();
+
+	for (uint32_t i = 0; i < m_actors.count; ++i)
+	{
+		const ActorRecord& actor = m_actors[i];
+
+		tinyxml2::XMLNode* actorNode = p_doc.NewElement("actor");
+		actorsNode->InsertEndChild(actorNode);
+
+		Serializer::SerializeString(p_doc, actorNode, "name", GetString(actor.name));
+		Serializer::SerializeString(p_doc, actorNode, "tag", GetString(actor.tag));
+		Serializer::SerializeBoolean(p_doc, actorNode, "active", actor.active != 0);
+		Serializer::SerializeInt64(p_doc, actorNode, "id", actor.id);
+		Serializer::SerializeInt64(p_doc, actorNode, "parent", actor.parent);
+
+		tinyxml2::XMLNode* componentsNode = p_doc.NewElement("components");
+		actorNode->InsertEndChild(componentsNode);
+
+		for (uint32_t j = actorOffsets[i]; j < actorOffsets[i + 1]; ++j)
+		{
+			const ComponentEntry& entry = components[j];
+
+			tinyxml2::XMLNode* componentNode = p_doc.NewElement("component");
+			componentsNode->InsertEndChild(componentNode);
+
+			Serializer::SerializeString(p_doc, componentNode, "type", entry.type);
+
+			tinyxml2::XMLElement* data = p_doc.NewElement("data");
+			componentNode->InsertEndChild(data);
+
+			if (entry.transform)
+			{
+				const auto& transform = *entry.transform;
+				Serializer::SerializeVec3(p_doc, data, "position", { transform.position[0], transform.position[1], transform.position[2] });
+				Serializer::SerializeQuat(p_doc, data, "rotation", { transform.rotation[0], transform.rotation[1], transform.rotation[2], transform.rotation[3] });
+				Serializer::SerializeVec3(p_doc, data, "scale", { transform.scale[0], transform.scale[1], transform.scale[2] });
+			}
+			else
+			{
+				BuildNodes(p_doc, data, entry.component->firstNode, entry.component->nodeCount);
+			}
+		}
+
+		tinyxml2::XMLNode* behavioursNode = p_doc.NewElement("behaviours");
+		actorNode->InsertEndChild(behavioursNode);
+
+		for (; behaviour != m_behaviours.end() && behaviour->actor == i; ++behaviour)
+		{
+			tinyxml2::XMLNode* behaviourNode = p_doc.NewElement("behaviour");
+			behavioursNode->InsertEndChild(behaviourNode);
+
+			Serializer::SerializeString(p_doc, behaviourNode, "type", GetString(behaviour->type));
+
+			tinyxml2::XMLElement* data = p_doc.NewElement("data");
+			behaviourNode->InsertEndChild(data);
+
+			BuildNodes(p_doc, data, behaviour->firstNode, behaviour->nodeCount);
+		}
+	}
+}
+
+std::vector<char> OvCore::SceneSystem::BinaryScene::Compile(tinyxml2::XMLDocument& p_doc)
+{
+	if (p_doc.Error())
+		return {};
+
+	tinyxml2::XMLNode* root = p_doc.FirstChild();
+	tinyxml2::XMLNode* sceneNode = root ? root->FirstChildElement("scene") : nullptr;
+
+	if (!sceneNode)
+		return {};
+
+	SceneCompiler compiler(p_doc);
+
+	if (!compiler.Compile(sceneNode))
+		return {};
+
+	return compiler.Assemble();
+}
+
+bool OvCore::SceneSystem::BinaryScene::CompileFile(const std::string& p_sourcePath, const std::string& p_destinationPath)
+{
+	std::vector<char> compiled;
+
+	{
+		OvTools::Filesystem::MemoryMappedFile file(p_sourcePath);
+
+		if (!file.IsOpen() || IsBinaryScene(file.GetData(), file.GetSize()))
+			return false;
+
+		tinyxml2::XMLDocument doc;
+		doc.Parse(file.GetData(), file.GetSize());
+		compiled = Compile(doc);
+	}
+
+	return !compiled.empty() && WriteFile(p_destinationPath, compiled);
+}
+
+bool OvCore::SceneSystem::BinaryScene::DecompileFile(const std::string& p_sourcePath, const std::string& p_destinationPath)
+{
+	tinyxml2::XMLDocument doc;
+
+	{
+		OvTools::Filesystem::MemoryMappedFile file(p_sourcePath);
+
+		if (!file.IsOpen())
+			return false;
+
+		BinaryScene scene(file.GetData(), file.GetSize());
+
+		if (!scene.IsValid())
+			return false;
+
+		scene.Decompile(doc);
+	}
+
+	return doc.SaveFile(p_destinationPath.c_str()) == tinyxml2::XML_SUCCESS;
+}
+
+bool OvCore::SceneSystem::BinaryScene::Parse()
+{
+	if (!IsBinaryScene(m_data, m_size))
+		return false;
+
+	Header header;
+	std::memcpy(&header, m_data, sizeof(Header));
+
+	if (header.version != VERSION || header.chunkCount > (m_size - sizeof(Header)) / sizeof(ChunkEntry))
+		return false;
+
+	/* Every chunk has to be found, aligned and inside of the data */
+	const ChunkEntry* strings = nullptr;
+	const ChunkEntry* actors = nullptr;
+	const ChunkEntry* transforms = nullptr;
+	const ChunkEntry* components = nullptr;
+	const ChunkEntry* behaviours = nullptr;
+	const ChunkEntry* nodes = nullptr;
+	const ChunkEntry* resources = nullptr;
+
+	const ChunkEntry* chunks = reinterpret_cast<const ChunkEntry*>(m_data + sizeof(Header));
+
+	for (uint32_t i = 0; i < header.chunkCount; ++i)
+	{
+		const ChunkEntry& chunk = chunks[i];
+
+		if (chunk.offset % CHUNK_ALIGNMENT != 0 || chunk.offset > m_size || chunk.size > m_size - chunk.offset)
+			return false;
+
+		switch (chunk.id)
+		{
+		case STRINGS_CHUNK:		strings = &chunk;		break;
+		case ACTORS_CHUNK:		actors = &chunk;		break;
+		case TRANSFORMS_CHUNK:	transforms = &chunk;	break;
+		case COMPONENTS_CHUNK:	components = &chunk;	break;
+		case BEHAVIOURS_CHUNK:	behaviours = &chunk;	break;
+		case NODES_CHUNK:		nodes = &chunk;			break;
+		case RESOURCES_CHUNK:	resources = &chunk;		break;
+		}
+	}
+
+	if (!strings || !actors || !transforms || !components || !behaviours || !nodes || !resources)
+		return false;
+
+	auto readRecords = [this](const ChunkEntry& p_chunk, auto& p_records)
+	{
+		using Record = std::remove_reference_t<decltype(*p_records.data)>;
+
+		if (p_chunk.count > p_chunk.size / sizeof(Record))
+			return false;
+
+		p_records.data = reinterpret_cast<const Record*>(m_data + p_chunk.offset);
+		p_records.count = p_chunk.count;
+		return true;
+	};
+
+	/* String table: every offset must point inside of the characters, which end with a terminator */
+	if (strings->count == 0 || strings->count > strings->size / sizeof(uint32_t))
+		return false;
+
+	m_stringCount = strings->count;
+	m_stringOffsets = reinterpret_cast<const uint32_t*>(m_data + strings->offset);
+	m_stringData = reinterpret_cast<const char*>(m_stringOffsets + m_stringCount);
+
+	const size_t charactersSize = strings->size - m_stringCount * sizeof(uint32_t);
+
+	if (charactersSize == 0 || m_stringData[charactersSize - 1] != '\0')
+		return false;
+
+	for (uint32_t i = 0; i < m_stringCount; ++i)
+		if (m_stringOffsets[i] >= charactersSize)
+			return false;
+
+	if (!readRecords(*actors, m_actors) || !readRecords(*transforms, m_transforms) || !readRecords(*behaviours, m_behaviours) || !readRecords(*nodes, m_nodes) || !readRecords(*resources, m_resources))
+		return false;
+
+	auto isValidString = [this](uint32_t p_index) { return p_index < m_stringCount; };
+	auto isValidActor = [this](uint32_t p_index) { return p_index < m_actors.count; };
+	auto isValidNodeRange = [this](uint32_t p_first, uint32_t p_count) { return p_first <= m_nodes.count && p_count <= m_nodes.count - p_first; };
+
+	for (auto& actor : m_actors)
+		if (!isValidString(actor.name) || !isValidString(actor.tag))
+			return false;
+
+	if (m_transforms.count != m_actors.count)
+		return false;
+
+	for (auto& transform : m_transforms)
+		if (!isValidActor(transform.actor))
+			return false;
+
+	for (auto& node : m_nodes)
+		if (!isValidString(node.name) || !isValidString(node.text))
+			return false;
+
+	for (size_t i = 0; i < m_behaviours.count; ++i)
+	{
+		const BehaviourRecord& behaviour = m_behaviours[i];
+
+		if (!isValidActor(behaviour.actor) || !isValidString(behaviour.type) || !isValidNodeRange(behaviour.firstNode, behaviour.nodeCount))
+			return false;
+
+		if (i > 0 && behaviour.actor < m_behaviours[i - 1].actor)
+			return false;
+	}
+
+	for (auto& resource : m_resources)
+		if (!isValidString(resource.path) || resource.type > OvTools::Utils::PathParser::EFileType::FONT)
+			return false;
+
+	/* Component blocks: a header followed by the records of a component type */
+	size_t blockOffset = components->offset;
+	const size_t blocksEnd = static_cast<size_t>(components->offset) + components->size;
+
+	m_componentBlocks.reserve(components->count);
+
+	for (uint32_t i = 0; i < components->count; ++i)
+	{
+		if (blocksEnd - blockOffset < sizeof(ComponentBlockHeader))
+			return false;
+
+		ComponentBlockHeader blockHeader;
+		std::memcpy(&blockHeader, m_data + blockOffset, sizeof(ComponentBlockHeader));
+		blockOffset += sizeof(ComponentBlockHeader);
+
+		if (!isValidString(blockHeader.type) || blockHeader.count > (blocksEnd - blockOffset) / sizeof(ComponentRecord))
+			return false;
+
+		ComponentBlock block{ GetString(blockHeader.type), { reinterpret_cast<const ComponentRecord*>(m_data + blockOffset), blockHeader.count } };
+		blockOffset += blockHeader.count * sizeof(ComponentRecord);
+
+		for (auto& component : block.components)
+			if (!isValidActor(component.actor) || !isValidNodeRange(component.firstNode, component.nodeCount))
+				return false;
+
+		m_componentBlocks.push_back(block);
+	}
+
+	return true;
+}
\ No newline at end of file
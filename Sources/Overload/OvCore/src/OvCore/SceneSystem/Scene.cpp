@@ -6,8 +6,74 @@
 
 #include <algorithm>
 #include <string>
+#include <limits>
+#include <cmath>
 
 #include "OvCore/SceneSystem/Scene.h"
+#include "OvCore/Jobs/JobSystem.h"
+#include "OvCore/SceneSystem/BinaryData.h"
+
+namespace
+{
+	/* Below this amount of model renderers, testing every bounding sphere with SIMD is cheaper than traversing the tree */
+	constexpr size_t kModelTreeQueryThreshold = 1024;
+
+	/* Components updated by a job of a parallel update stage */
+	constexpr uint32_t kUpdateBatchSize = 64;
+
+	bool Intersects(const std::vector<OvCore::ECS::ComponentTypeID>& p_first, const std::vector<OvCore::ECS::ComponentTypeID>& p_second)
+	{
+		return std::find_first_of(p_first.begin(), p_first.end(), p_second.begin(), p_second.end()) != p_first.end();
+	}
+
+	bool CanRunInParallel(const OvCore::ECS::ComponentUpdateAccess& p_access)
+	{
+		/* Transform changes are propagated to the children and to the scene indices, which only the main thread can do */
+		const auto transformTypeID = OvCore::ECS::GetComponentTypeID<OvCore::ECS::Components::CTransform>();
+		return p_access.parallel && std::find(p_access.writes.begin(), p_access.writes.end(), transformTypeID) == p_access.writes.end();
+	}
+
+	template<typename Key, typename Index>
+	void InsertInIndex(Index& p_index, const Key& p_key, uint64_t p_creationOrder, OvCore::ECS::Actor& p_actor)
+	{
+		p_index[p_key].emplace(p_creationOrder, &p_actor);
+	}
+
+	template<typename Key, typename Index>
+	void EraseFromIndex(Index& p_index, const Key& p_key, uint64_t p_creationOrder)
+	{
+		if (auto bucket = p_index.find(p_key); bucket != p_index.end())
+		{
+			bucket->second.erase(p_creationOrder);
+
+			if (bucket->second.empty())
+				p_index.erase(bucket);
+		}
+	}
+
+	template<typename Key, typename Index>
+	OvCore::ECS::Actor* FindFirstInIndex(const Index& p_index, const Key& p_key)
+	{
+		auto bucket = p_index.find(p_key);
+		return bucket != p_index.end() ? bucket->second.begin()->second : nullptr;
+	}
+
+	template<typename Key, typename Index>
+	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> FindAllInIndex(const Index& p_index, const Key& p_key)
+	{
+		std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
+
+		if (auto bucket = p_index.find(p_key); bucket != p_index.end())
+		{
+			actors.reserve(bucket->second.size());
+
+			for (auto& [creationOrder, actor] : bucket->second)
+				actors.push_back(std::ref(*actor));
+		}
+
+		return actors;
+	}
+}
 
 OvCore::SceneSystem::Scene::Scene()
 {
@@ -31,9 +97,11 @@ void OvCore::SceneSystem::Scene::Play()
 	/* Wake up actors to allow them to react to OnEnable, OnDisable and OnDestroy, */
 	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { p_element->SetSleeping(false); });
 
+	BeginActorsIteration();
 	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { if (p_element->IsActive()) p_element->OnAwake(); });
 	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { if (p_element->IsActive()) p_element->OnEnable(); });
 	std::for_each(m_actors.begin(), m_actors.end(), [](ECS::Actor * p_element) { if (p_element->IsActive()) p_element->OnStart(); });
+	EndActorsIteration();
 }
 
 bool OvCore::SceneSystem::Scene::IsPlaying() const
@@ -43,20 +111,141 @@ bool OvCore::SceneSystem::Scene::IsPlaying() const
 
 void OvCore::SceneSystem::Scene::Update(float p_deltaTime)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnUpdate), std::placeholders::_1, p_deltaTime));
+	UpdateActors(&ECS::Components::AComponent::OnUpdate, ECS::Components::Behaviour::EHook::UPDATE, p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::FixedUpdate(float p_deltaTime)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnFixedUpdate), std::placeholders::_1, p_deltaTime));
+	UpdateActors(&ECS::Components::AComponent::OnFixedUpdate, ECS::Components::Behaviour::EHook::FIXED_UPDATE, p_deltaTime);
 }
 
 void OvCore::SceneSystem::Scene::LateUpdate(float p_deltaTime)
 {
-	auto actors = m_actors;
-	std::for_each(actors.begin(), actors.end(), std::bind(std::mem_fn(&ECS::Actor::OnLateUpdate), std::placeholders::_1, p_deltaTime));
+	UpdateActors(&ECS::Components::AComponent::OnLateUpdate, ECS::Components::Behaviour::EHook::LATE_UPDATE, p_deltaTime);
+}
+
+void OvCore::SceneSystem::Scene::UpdateActors(UpdateCallback p_callback, ECS::Components::Behaviour::EHook p_hook, float p_deltaTime)
+{
+	if (m_updateStagesChanged)
+		BuildUpdateStages();
+
+	BeginActorsIteration();
+
+	for (const auto& stage : m_updateStages)
+	{
+		m_updateBatch.clear();
+
+		/* Pools also hold the components retrieved through a base type, they are updated with their own type */
+		for (auto typeID : stage.types)
+		{
+			for (auto component : m_componentPools[typeID].components)
+			{
+				if (component->GetTypeIDs().front() == typeID && component->owner.IsActive())
+					m_updateBatch.push_back(component);
+			}
+		}
+
+		if (stage.parallel)
+		{
+			/* World matrices are resolved lazily by the transform getters, workers must only read resolved ones */
+			ResolveTransforms();
+
+			Jobs::JobSystem::ParallelFor(static_cast<uint32_t>(m_updateBatch.size()), kUpdateBatchSize, [&](uint32_t p_begin, uint32_t p_end)
+			{
+				for (uint32_t i = p_begin; i < p_end; ++i)
+					(m_updateBatch[i]->*p_callback)(p_deltaTime);
+			});
+		}
+		else
+		{
+			/* Main thread updates can remove components or deactivate actors, removed components are cleared from the batch */
+			for (size_t i = 0; i < m_updateBatch.size(); ++i)
+			{
+				if (auto component = m_updateBatch[i]; component && component->owner.IsActive())
+					(component->*p_callback)(p_deltaTime);
+			}
+		}
+	}
+
+	/* Behaviours share the scripting state, so they are always updated on the main thread. Scripts without the hook are skipped */
+	for (auto actor : m_actors)
+	{
+		if (!actor->GetBehaviours().empty() && actor->IsActive())
+		{
+			for (auto& [name, behaviour] : actor->GetBehaviours())
+			{
+				if (behaviour.HasHook(p_hook))
+					(behaviour.*p_callback)(p_deltaTime);
+			}
+		}
+	}
+
+	EndActorsIteration();
+}
+
+void OvCore::SceneSystem::Scene::BuildUpdateStages()
+{
+	m_updateStages.clear();
+
+	std::vector<ECS::ComponentTypeID> stageReads;
+	std::vector<ECS::ComponentTypeID> stageWrites;
+
+	/* Types are added to the current stage until one accesses what the stage writes, or writes what the stage accesses */
+	for (ECS::ComponentTypeID typeID = 0; typeID < m_updateAccesses.size(); ++typeID)
+	{
+		const auto access = m_updateAccesses[typeID];
+
+		if (!access)
+			continue;
+
+		const bool parallel = CanRunInParallel(*access);
+		const bool conflicts = parallel && (Intersects(access->writes, stageReads) || Intersects(access->writes, stageWrites) || Intersects(access->reads, stageWrites));
+
+		if (m_updateStages.empty() || m_updateStages.back().parallel != parallel || conflicts)
+		{
+			m_updateStages.push_back({ parallel, {} });
+			stageReads.clear();
+			stageWrites.clear();
+		}
+
+		m_updateStages.back().types.push_back(typeID);
+
+		if (parallel)
+		{
+			stageReads.insert(stageReads.end(), access->reads.begin(), access->reads.end());
+			stageWrites.insert(stageWrites.end(), access->writes.begin(), access->writes.end());
+		}
+	}
+
+	m_updateStagesChanged = false;
+}
+
+void OvCore::SceneSystem::Scene::BeginActorsIteration()
+{
+	m_iteratingActors = true;
+}
+
+void OvCore::SceneSystem::Scene::EndActorsIteration()
+{
+	m_iteratingActors = false;
+
+	m_actors.insert(m_actors.end(), m_createdDuringIteration.begin(), m_createdDuringIteration.end());
+	m_createdDuringIteration.clear();
+
+	for (auto actor : m_destroyedDuringIteration)
+		DestroyActor(*actor);
+
+	m_destroyedDuringIteration.clear();
+}
+
+void OvCore::SceneSystem::Scene::ResolveTransforms()
+{
+	/* Clean transforms return immediately, dirty ones resolve their dirty parents first */
+	for (auto actor : m_actors)
+		actor->transform.GetFTransform().UpdateWorldMatrix();
+
+	for (auto actor : m_createdDuringIteration)
+		actor->transform.GetFTransform().UpdateWorldMatrix();
 }
 
 OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor()
@@ -66,10 +255,16 @@ OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor()
 
 OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor(const std::string& p_name, const std::string& p_tag)
 {
-	m_actors.push_back(new OvCore::ECS::Actor(m_availableID++, p_name, p_tag, m_isPlaying));
-	ECS::Actor& instance = *m_actors.back();
+	/* The actors being iterated can't be resized, the actor is added to them at the end of the iteration */
+	auto& actors = m_iteratingActors ? m_createdDuringIteration : m_actors;
+	actors.push_back(new OvCore::ECS::Actor(m_availableID++, p_name, p_tag, m_isPlaying));
+	ECS::Actor& instance = *actors.back();
 	instance.ComponentAddedEvent	+= std::bind(&Scene::OnComponentAdded, this, std::placeholders::_1);
 	instance.ComponentRemovedEvent	+= std::bind(&Scene::OnComponentRemoved, this, std::placeholders::_1);
+	instance.NameChangedEvent		+= std::bind(&Scene::OnActorNameChanged, this, std::placeholders::_1, std::placeholders::_2);
+	instance.TagChangedEvent		+= std::bind(&Scene::OnActorTagChanged, this, std::placeholders::_1, std::placeholders::_2);
+	instance.IDChangedEvent			+= std::bind(&Scene::OnActorIDChanged, this, std::placeholders::_1, std::placeholders::_2);
+	IndexActor(instance);
 	if (m_isPlaying)
 	{
 		instance.SetSleeping(false);
@@ -85,6 +280,18 @@ OvCore::ECS::Actor& OvCore::SceneSystem::Scene::CreateActor(const std::string& p
 
 bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 {
+	if (m_iteratingActors)
+	{
+		const bool inScene = std::find(m_actors.begin(), m_actors.end(), &p_target) != m_actors.end() || std::find(m_createdDuringIteration.begin(), m_createdDuringIteration.end(), &p_target) != m_createdDuringIteration.end();
+		const bool alreadyDestroyed = std::find(m_destroyedDuringIteration.begin(), m_destroyedDuringIteration.end(), &p_target) != m_destroyedDuringIteration.end();
+
+		if (!inScene || alreadyDestroyed)
+			return false;
+
+		m_destroyedDuringIteration.push_back(&p_target);
+		return true;
+	}
+
 	auto found = std::find_if(m_actors.begin(), m_actors.end(), [&p_target](OvCore::ECS::Actor* element)
 	{
 		return element == &p_target;
@@ -92,6 +299,7 @@ bool OvCore::SceneSystem::Scene::DestroyActor(ECS::Actor& p_target)
 
 	if (found != m_actors.end())
 	{
+		UnindexActor(**found);
 		delete *found;
 		m_actors.erase(found);
 		return true;
@@ -109,6 +317,7 @@ void OvCore::SceneSystem::Scene::CollectGarbages()
 		bool isGarbage = !element->IsAlive();
 		if (isGarbage)
 		{
+			UnindexActor(*element);
 			delete element;
 		}
 		return isGarbage;
@@ -117,91 +326,152 @@ void OvCore::SceneSystem::Scene::CollectGarbages()
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByName(const std::string& p_name)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_name](OvCore::ECS::Actor* element)
-	{ 
-		return element->GetName() == p_name;
-	});
-
-	if (result != m_actors.end())
-		return *result;
-	else
-		return nullptr;
+	return FindFirstInIndex(m_actorsByName, p_name);
 }
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByTag(const std::string & p_tag)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_tag](OvCore::ECS::Actor* element)
-	{
-		return element->GetTag() == p_tag;
-	});
-
-	if (result != m_actors.end())
-		return *result;
-	else
-		return nullptr;
+	return FindFirstInIndex(m_actorsByTag, p_tag);
 }
 
 OvCore::ECS::Actor* OvCore::SceneSystem::Scene::FindActorByID(int64_t p_id)
 {
-	auto result = std::find_if(m_actors.begin(), m_actors.end(), [p_id](OvCore::ECS::Actor* element)
-	{
-		return element->GetID() == p_id;
-	});
-
-	if (result != m_actors.end())
-		return *result;
-	else
-		return nullptr;
+	return FindFirstInIndex(m_actorsByID, p_id);
 }
 
 std::vector<std::reference_wrapper<OvCore::ECS::Actor>> OvCore::SceneSystem::Scene::FindActorsByName(const std::string & p_name)
 {
-	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
-
-	for (auto actor : m_actors)
-	{
-		if (actor->GetName() == p_name)
-			actors.push_back(std::ref(*actor));
-	}
-
-	return actors;
+	return FindAllInIndex(m_actorsByName, p_name);
 }
 
 std::vector<std::reference_wrapper<OvCore::ECS::Actor>> OvCore::SceneSystem::Scene::FindActorsByTag(const std::string & p_tag)
 {
-	std::vector<std::reference_wrapper<OvCore::ECS::Actor>> actors;
+	return FindAllInIndex(m_actorsByTag, p_tag);
+}
+
+void OvCore::SceneSystem::Scene::IndexActor(ECS::Actor& p_actor)
+{
+	const uint64_t creationOrder = m_createdActors++;
+	m_actorsCreationOrder.emplace(&p_actor, creationOrder);
 
-	for (auto actor : m_actors)
+	InsertInIndex(m_actorsByID, p_actor.GetID(), creationOrder, p_actor);
+	InsertInIndex(m_actorsByName, p_actor.GetName(), creationOrder, p_actor);
+	InsertInIndex(m_actorsByTag, p_actor.GetTag(), creationOrder, p_actor);
+}
+
+void OvCore::SceneSystem::Scene::UnindexActor(ECS::Actor& p_actor)
+{
+	if (auto found = m_actorsCreationOrder.find(&p_actor); found != m_actorsCreationOrder.end())
 	{
-		if (actor->GetTag() == p_tag)
-			actors.push_back(std::ref(*actor));
+		EraseFromIndex(m_actorsByID, p_actor.GetID(), found->second);
+		EraseFromIndex(m_actorsByName, p_actor.GetName(), found->second);
+		EraseFromIndex(m_actorsByTag, p_actor.GetTag(), found->second);
+		m_actorsCreationOrder.erase(found);
 	}
+}
 
-	return actors;
+void OvCore::SceneSystem::Scene::OnActorNameChanged(ECS::Actor& p_actor, const std::string& p_previousName)
+{
+	const uint64_t creationOrder = m_actorsCreationOrder.at(&p_actor);
+	EraseFromIndex(m_actorsByName, p_previousName, creationOrder);
+	InsertInIndex(m_actorsByName, p_actor.GetName(), creationOrder, p_actor);
+}
+
+void OvCore::SceneSystem::Scene::OnActorTagChanged(ECS::Actor& p_actor, const std::string& p_previousTag)
+{
+	const uint64_t creationOrder = m_actorsCreationOrder.at(&p_actor);
+	EraseFromIndex(m_actorsByTag, p_previousTag, creationOrder);
+	InsertInIndex(m_actorsByTag, p_actor.GetTag(), creationOrder, p_actor);
+}
+
+void OvCore::SceneSystem::Scene::OnActorIDChanged(ECS::Actor& p_actor, int64_t p_previousID)
+{
+	const uint64_t creationOrder = m_actorsCreationOrder.at(&p_actor);
+	EraseFromIndex(m_actorsByID, p_previousID, creationOrder);
+	InsertInIndex(m_actorsByID, p_actor.GetID(), creationOrder, p_actor);
 }
 
 void OvCore::SceneSystem::Scene::OnComponentAdded(ECS::Components::AComponent& p_compononent)
 {
-	if (auto result = dynamic_cast<ECS::Components::CModelRenderer*>(&p_compononent))
+	/* The first component of a type brings its update access to the schedule */
+	if (const auto ownTypeID = p_compononent.GetTypeIDs().front(); ownTypeID >= m_updateAccesses.size() || !m_updateAccesses[ownTypeID])
+	{
+		if (ownTypeID >= m_updateAccesses.size())
+			m_updateAccesses.resize(ownTypeID + 1, nullptr);
+
+		m_updateAccesses[ownTypeID] = &p_compononent.GetUpdateAccess();
+		m_updateStagesChanged = true;
+	}
+
+	for (auto typeID : p_compononent.GetTypeIDs())
+	{
+		if (typeID >= m_componentPools.size())
+			m_componentPools.resize(typeID + 1);
+
+		auto& pool = m_componentPools[typeID];
+		pool.indices[&p_compononent] = pool.components.size();
+		pool.components.push_back(&p_compononent);
+	}
+
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CModelRenderer>()))
+	{
+		auto result = static_cast<ECS::Components::CModelRenderer*>(&p_compononent);
 		m_fastAccessComponents.modelRenderers.push_back(result);
+		AddModelSlot(*result);
+	}
 
-	if (auto result = dynamic_cast<ECS::Components::CCamera*>(&p_compononent))
-		m_fastAccessComponents.cameras.push_back(result);
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CCamera>()))
+		m_fastAccessComponents.cameras.push_back(static_cast<ECS::Components::CCamera*>(&p_compononent));
 
-	if (auto result = dynamic_cast<ECS::Components::CLight*>(&p_compononent))
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CLight>()))
+	{
+		auto result = static_cast<ECS::Components::CLight*>(&p_compononent);
 		m_fastAccessComponents.lights.push_back(result);
+		AddLightSlot(*result);
+	}
 }
 
 void OvCore::SceneSystem::Scene::OnComponentRemoved(ECS::Components::AComponent& p_compononent)
 {
-	if (auto result = dynamic_cast<ECS::Components::CModelRenderer*>(&p_compononent))
+	if (m_iteratingActors)
+		std::replace(m_updateBatch.begin(), m_updateBatch.end(), &p_compononent, static_cast<ECS::Components::AComponent*>(nullptr));
+
+	for (auto typeID : p_compononent.GetTypeIDs())
+	{
+		if (typeID >= m_componentPools.size())
+			continue;
+
+		auto& pool = m_componentPools[typeID];
+
+		if (auto found = pool.indices.find(&p_compononent); found != pool.indices.end())
+		{
+			const size_t index = found->second;
+			pool.components[index] = pool.components.back();
+			pool.indices[pool.components[index]] = index;
+			pool.components.pop_back();
+			pool.indices.erase(found);
+		}
+	}
+
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CModelRenderer>()))
+	{
+		auto result = static_cast<ECS::Components::CModelRenderer*>(&p_compononent);
 		m_fastAccessComponents.modelRenderers.erase(std::remove(m_fastAccessComponents.modelRenderers.begin(), m_fastAccessComponents.modelRenderers.end(), result), m_fastAccessComponents.modelRenderers.end());
+		RemoveModelSlot(*result);
+	}
 
-	if (auto result = dynamic_cast<ECS::Components::CCamera*>(&p_compononent))
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CCamera>()))
+	{
+		auto result = static_cast<ECS::Components::CCamera*>(&p_compononent);
 		m_fastAccessComponents.cameras.erase(std::remove(m_fastAccessComponents.cameras.begin(), m_fastAccessComponents.cameras.end(), result), m_fastAccessComponents.cameras.end());
+	}
 
-	if (auto result = dynamic_cast<ECS::Components::CLight*>(&p_compononent))
+	if (p_compononent.IsOfType(ECS::GetComponentTypeID<ECS::Components::CLight>()))
+	{
+		auto result = static_cast<ECS::Components::CLight*>(&p_compononent);
 		m_fastAccessComponents.lights.erase(std::remove(m_fastAccessComponents.lights.begin(), m_fastAccessComponents.lights.end(), result), m_fastAccessComponents.lights.end());
+		RemoveLightSlot(*result);
+	}
 }
 
 std::vector<OvCore::ECS::Actor*>& OvCore::SceneSystem::Scene::GetActors()
@@ -214,6 +484,296 @@ const OvCore::SceneSystem::Scene::FastAccessComponents& OvCore::SceneSystem::Sce
 	return m_fastAccessComponents;
 }
 
+void OvCore::SceneSystem::Scene::FindModelRenderersInFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<ECS::Components::CModelRenderer*>& p_result) const
+{
+	UpdateModelSlots();
+
+	p_result.clear();
+
+	if (m_modelSlots.size() < kModelTreeQueryThreshold)
+	{
+		/* Free slots have a negative infinite radius and unbounded ones an infinite radius, so the SIMD test handles them */
+		p_frustum.SpheresInFrustum(m_modelBoundingSpheres, m_queryResults);
+
+		for (uint32_t slot : m_queryResults)
+			p_result.push_back(m_modelSlots[slot].modelRenderer);
+	}
+	else
+	{
+		m_queryResults.clear();
+		m_modelTree.QueryFrustum(p_frustum, m_queryResults);
+
+		/* The tree only knows the fat boxes, the exact spheres of the candidates are gathered to be tested with SIMD */
+		const float* xs = m_modelBoundingSpheres.GetX();
+		const float* ys = m_modelBoundingSpheres.GetY();
+		const float* zs = m_modelBoundingSpheres.GetZ();
+		const float* radii = m_modelBoundingSpheres.GetRadii();
+
+		m_candidateBoundingSpheres.Resize(m_queryResults.size());
+
+		for (size_t i = 0; i < m_queryResults.size(); ++i)
+		{
+			const uint32_t slot = m_queryResults[i];
+			m_candidateBoundingSpheres.Set(i, OvMaths::FVector3(xs[slot], ys[slot], zs[slot]), radii[slot]);
+		}
+
+		p_frustum.SpheresInFrustum(m_candidateBoundingSpheres, m_visibleCandidates);
+
+		for (uint32_t candidate : m_visibleCandidates)
+			p_result.push_back(m_modelSlots[m_queryResults[candidate]].modelRenderer);
+
+		for (uint32_t slot : m_unboundedModelSlots)
+			p_result.push_back(m_modelSlots[slot].modelRenderer);
+	}
+}
+
+void OvCore::SceneSystem::Scene::FindLightsInFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<ECS::Components::CLight*>& p_result) const
+{
+	UpdateLightSlots();
+
+	p_result.clear();
+	m_queryResults.clear();
+	m_lightTree.QueryFrustum(p_frustum, m_queryResults);
+
+	for (uint32_t slot : m_queryResults)
+	{
+		const auto& lightData = m_lightSlots[slot].light->GetData();
+		const auto& position = lightData.GetTransform().GetWorldPosition();
+
+		if (p_frustum.SphereInFrustum(position.x, position.y, position.z, lightData.GetEffectRange()))
+			p_result.push_back(m_lightSlots[slot].light);
+	}
+
+	for (uint32_t slot : m_unboundedLightSlots)
+		p_result.push_back(m_lightSlots[slot].light);
+}
+
+const OvCore::SceneSystem::Scene::ComponentPool* OvCore::SceneSystem::Scene::GetComponentPool(ECS::ComponentTypeID p_typeID) const
+{
+	return p_typeID < m_componentPools.size() ? &m_componentPools[p_typeID] : nullptr;
+}
+
+void OvCore::SceneSystem::Scene::AddModelSlot(ECS::Components::CModelRenderer& p_modelRenderer)
+{
+	uint32_t slot;
+
+	if (m_freeModelSlots.empty())
+	{
+		slot = static_cast<uint32_t>(m_modelSlots.size());
+		m_modelSlots.emplace_back();
+		m_modelBoundingSpheres.Resize(m_modelSlots.size());
+	}
+	else
+	{
+		slot = m_freeModelSlots.back();
+		m_freeModelSlots.pop_back();
+	}
+
+	auto markDirty = [this, slot]
+	{
+		if (!m_modelSlots[slot].dirty)
+		{
+			m_modelSlots[slot].dirty = true;
+			m_dirtyModelSlots.push_back(slot);
+		}
+	};
+
+	m_modelSlots[slot].modelRenderer = &p_modelRenderer;
+	m_modelSlots[slot].boundsListener = p_modelRenderer.BoundsChangedEvent += markDirty;
+	m_modelSlotIndices[&p_modelRenderer] = slot;
+
+	markDirty();
+}
+
+void OvCore::SceneSystem::Scene::RemoveModelSlot(ECS::Components::CModelRenderer& p_modelRenderer)
+{
+	auto found = m_modelSlotIndices.find(&p_modelRenderer);
+
+	if (found == m_modelSlotIndices.end())
+		return;
+
+	const uint32_t slot = found->second;
+	m_modelSlotIndices.erase(found);
+
+	auto& entry = m_modelSlots[slot];
+
+	p_modelRenderer.BoundsChangedEvent -= entry.boundsListener;
+
+	if (entry.proxy != OvRendering::Geometry::DynamicAABBTree::NULL_NODE)
+		m_modelTree.DestroyProxy(entry.proxy);
+
+	if (entry.unbounded)
+		m_unboundedModelSlots.erase(std::remove(m_unboundedModelSlots.begin(), m_unboundedModelSlots.end(), slot), m_unboundedModelSlots.end());
+
+	/* The slot may still be in the dirty list, it is skipped there since it isn't flagged anymore */
+	entry = ModelSlot();
+	m_modelBoundingSpheres.Set(slot, OvMaths::FVector3(), -std::numeric_limits<float>::infinity());
+	m_freeModelSlots.push_back(slot);
+}
+
+void OvCore::SceneSystem::Scene::UpdateModelSlots() const
+{
+	using namespace OvCore::ECS::Components;
+	using OvRendering::Geometry::DynamicAABBTree;
+
+	for (uint32_t slot : m_dirtyModelSlots)
+	{
+		auto& entry = m_modelSlots[slot];
+
+		if (!entry.dirty)
+			continue;
+
+		entry.dirty = false;
+
+		const CModelRenderer& modelRenderer = *entry.modelRenderer;
+		const auto& transform = modelRenderer.owner.transform.GetFTransform();
+		const auto model = modelRenderer.GetModel();
+		const bool unbounded = model && modelRenderer.GetFrustumBehaviour() == CModelRenderer::EFrustumBehaviour::DISABLED;
+
+		if (!model)
+			m_modelBoundingSpheres.Set(slot, transform.GetWorldPosition(), -std::numeric_limits<float>::infinity());
+		else if (unbounded)
+			m_modelBoundingSpheres.Set(slot, transform.GetWorldPosition(), std::numeric_limits<float>::infinity());
+		else
+			m_modelBoundingSpheres.Set(slot, modelRenderer.GetWorldBoundingSphere().position, modelRenderer.GetWorldBoundingSphere().radius);
+
+		/* Only model renderers with a finite bounding sphere are in the tree */
+		if (model && !unbounded)
+		{
+			const OvMaths::FVector3 center(m_modelBoundingSpheres.GetX()[slot], m_modelBoundingSpheres.GetY()[slot], m_modelBoundingSpheres.GetZ()[slot]);
+			const float radius = m_modelBoundingSpheres.GetRadii()[slot];
+			const OvRendering::Geometry::BoundingBox box = { center - OvMaths::FVector3(radius, radius, radius), center + OvMaths::FVector3(radius, radius, radius) };
+
+			if (entry.proxy == DynamicAABBTree::NULL_NODE)
+				entry.proxy = m_modelTree.CreateProxy(box, slot);
+			else
+				m_modelTree.MoveProxy(entry.proxy, box);
+		}
+		else if (entry.proxy != DynamicAABBTree::NULL_NODE)
+		{
+			m_modelTree.DestroyProxy(entry.proxy);
+			entry.proxy = DynamicAABBTree::NULL_NODE;
+		}
+
+		if (unbounded != entry.unbounded)
+		{
+			if (unbounded)
+				m_unboundedModelSlots.push_back(slot);
+			else
+				m_unboundedModelSlots.erase(std::remove(m_unboundedModelSlots.begin(), m_unboundedModelSlots.end(), slot), m_unboundedModelSlots.end());
+
+			entry.unbounded = unbounded;
+		}
+	}
+
+	m_dirtyModelSlots.clear();
+}
+
+void OvCore::SceneSystem::Scene::AddLightSlot(ECS::Components::CLight& p_light)
+{
+	uint32_t slot;
+
+	if (m_freeLightSlots.empty())
+	{
+		slot = static_cast<uint32_t>(m_lightSlots.size());
+		m_lightSlots.emplace_back();
+	}
+	else
+	{
+		slot = m_freeLightSlots.back();
+		m_freeLightSlots.pop_back();
+	}
+
+	auto markDirty = [this, slot]
+	{
+		if (!m_lightSlots[slot].dirty)
+		{
+			m_lightSlots[slot].dirty = true;
+			m_dirtyLightSlots.push_back(slot);
+		}
+	};
+
+	m_lightSlots[slot].light = &p_light;
+	m_lightSlots[slot].boundsListener = p_light.BoundsChangedEvent += markDirty;
+	m_lightSlotIndices[&p_light] = slot;
+
+	markDirty();
+}
+
+void OvCore::SceneSystem::Scene::RemoveLightSlot(ECS::Components::CLight& p_light)
+{
+	auto found = m_lightSlotIndices.find(&p_light);
+
+	if (found == m_lightSlotIndices.end())
+		return;
+
+	const uint32_t slot = found->second;
+	m_lightSlotIndices.erase(found);
+
+	auto& entry = m_lightSlots[slot];
+
+	p_light.BoundsChangedEvent -= entry.boundsListener;
+
+	if (entry.proxy != OvRendering::Geometry::DynamicAABBTree::NULL_NODE)
+		m_lightTree.DestroyProxy(entry.proxy);
+
+	if (entry.unbounded)
+		m_unboundedLightSlots.erase(std::remove(m_unboundedLightSlots.begin(), m_unboundedLightSlots.end(), slot), m_unboundedLightSlots.end());
+
+	/* The slot may still be in the dirty list, it is skipped there since it isn't flagged anymore */
+	entry = LightSlot();
+	m_freeLightSlots.push_back(slot);
+}
+
+void OvCore::SceneSystem::Scene::UpdateLightSlots() const
+{
+	using OvRendering::Geometry::DynamicAABBTree;
+
+	for (uint32_t slot : m_dirtyLightSlots)
+	{
+		auto& entry = m_lightSlots[slot];
+
+		if (!entry.dirty)
+			continue;
+
+		entry.dirty = false;
+
+		const auto& lightData = entry.light->GetData();
+		const float effectRange = lightData.GetEffectRange();
+
+		/* Infinite (Or invalid) effect ranges can't be bounded */
+		const bool unbounded = !std::isfinite(effectRange);
+
+		if (!unbounded)
+		{
+			const auto& position = lightData.GetTransform().GetWorldPosition();
+			const OvRendering::Geometry::BoundingBox box = { position - OvMaths::FVector3(effectRange, effectRange, effectRange), position + OvMaths::FVector3(effectRange, effectRange, effectRange) };
+
+			if (entry.proxy == DynamicAABBTree::NULL_NODE)
+				entry.proxy = m_lightTree.CreateProxy(box, slot);
+			else
+				m_lightTree.MoveProxy(entry.proxy, box);
+		}
+		else if (entry.proxy != DynamicAABBTree::NULL_NODE)
+		{
+			m_lightTree.DestroyProxy(entry.proxy);
+			entry.proxy = DynamicAABBTree::NULL_NODE;
+		}
+
+		if (unbounded != entry.unbounded)
+		{
+			if (unbounded)
+				m_unboundedLightSlots.push_back(slot);
+			else
+				m_unboundedLightSlots.erase(std::remove(m_unboundedLightSlots.begin(), m_unboundedLightSlots.end(), slot), m_unboundedLightSlots.end());
+
+			entry.unbounded = unbounded;
+		}
+	}
+
+	m_dirtyLightSlots.clear();
+}
+
 void OvCore::SceneSystem::Scene::OnSerialize(tinyxml2::XMLDocument & p_doc, tinyxml2::XMLNode * p_root)
 {
 	tinyxml2::XMLNode* sceneNode = p_doc.NewElement("scene");
@@ -248,7 +808,7 @@ void OvCore::SceneSystem::Scene::OnDeserialize(tinyxml2::XMLDocument & p_doc, ti
 
 		m_availableID = maxID;
 
-		/* We recreate the hierarchy of the scene by attaching children to their parents */
+		/* We recreate the hierarchy of the scene by attaching children to their parents (Found through the ID index) */
 		for (auto actor : m_actors)
 		{
 			if (actor->GetParentID() > 0)
@@ -259,3 +819,66 @@ void OvCore::SceneSystem::Scene::OnDeserialize(tinyxml2::XMLDocument & p_doc, ti
 		}
 	}
 }
+
+void OvCore::SceneSystem::Scene::DeserializeBinary(const BinaryScene& p_binaryScene)
+{
+	const auto& actorRecords = p_binaryScene.GetActors();
+
+	std::vector<ECS::Actor*> actors;
+	actors.reserve(actorRecords.count);
+
+	int64_t maxID = 1;
+
+	for (auto& record : actorRecords)
+	{
+		auto& actor = CreateActor(p_binaryScene.GetString(record.name), p_binaryScene.GetString(record.tag));
+		actor.SetID(record.id);
+		actor.SetActive(record.active != 0);
+		actors.push_back(&actor);
+		maxID = std::max(record.id + 1, maxID);
+	}
+
+	m_availableID = maxID;
+
+	for (auto& record : p_binaryScene.GetTransforms())
+	{
+		actors[record.actor]->transform.GetFTransform().GenerateMatricesLocal
+		(
+			{ record.position[0], record.position[1], record.position[2] },
+			{ record.rotation[0], record.rotation[1], record.rotation[2], record.rotation[3] },
+			{ record.scale[0], record.scale[1], record.scale[2] }
+		);
+	}
+
+	/* Components are added in their serialization order, each one reading its data nodes in place */
+	std::vector<uint32_t> actorOffsets;
+	const auto components = p_binaryScene.GetOrderedComponents(actorOffsets);
+
+	for (uint32_t i = 0; i < actors.size(); ++i)
+	{
+		for (uint32_t j = actorOffsets[i]; j < actorOffsets[i + 1]; ++j)
+		{
+			if (const auto& entry = components[j]; entry.component)
+			{
+				if (auto component = actors[i]->AddComponentFromSerializationID(entry.type))
+					component->OnDeserializeBinary(BinaryData(p_binaryScene, entry.component->firstNode, entry.component->nodeCount));
+			}
+		}
+	}
+
+	for (auto& record : p_binaryScene.GetBehaviours())
+	{
+		auto& behaviour = actors[record.actor]->AddBehaviour(p_binaryScene.GetString(record.type));
+		behaviour.OnDeserializeBinary(BinaryData(p_binaryScene, record.firstNode, record.nodeCount));
+	}
+
+	/* We recreate the hierarchy of the scene by attaching children to their parents */
+	for (uint32_t i = 0; i < actors.size(); ++i)
+	{
+		if (const int64_t parentID = actorRecords[i].parent; parentID > 0)
+		{
+			if (auto found = FindActorByID(parentID))
+				actors[i]->SetParent(*found);
+		}
+	}
+}
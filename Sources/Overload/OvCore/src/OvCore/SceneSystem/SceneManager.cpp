@@ -4,14 +4,57 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+
 #include <OvTools/Filesystem/tinyxml2.h>
+#include <OvTools/Filesystem/MemoryMappedFile.h>
 #include <OvWindowing/Dialogs/MessageBox.h>
+#include <OvAnalytics/Profiling/ProfilerSpy.h>
 
 #include "OvCore/SceneSystem/SceneManager.h"
+#include "OvCore/ResourceManagement/ModelManager.h"
+#include "OvCore/ResourceManagement/TextureManager.h"
+#include "OvCore/ResourceManagement/ShaderManager.h"
+#include "OvCore/ResourceManagement/MaterialManager.h"
+#include "OvCore/ResourceManagement/SoundManager.h"
+#include "OvCore/Global/ServiceLocator.h"
 #include "OvCore/ECS/Components/CDirectionalLight.h"
 #include "OvCore/ECS/Components/CAmbientSphereLight.h"
 #include "OvCore/ECS/Components/CCamera.h"
 
+namespace
+{
+	template<typename T>
+	std::function<bool()> IsResourceReady(std::shared_future<T*> p_resource)
+	{
+		return [p_resource] { return p_resource.wait_for(std::chrono::seconds(0)) == std::future_status::ready; };
+	}
+
+	/* Returns a function telling if the resource is loaded, or nullptr if the resource isn't loadable */
+	std::function<bool()> RequestSceneResource(const std::string& p_path, OvTools::Utils::PathParser::EFileType p_type)
+	{
+		using namespace OvCore::ResourceManagement;
+		using OvCore::Global::ServiceLocator;
+		using EFileType = OvTools::Utils::PathParser::EFileType;
+
+		if (p_path.empty() || p_path == "?")
+			return nullptr;
+
+		switch (p_type)
+		{
+		case EFileType::MODEL:		return IsResourceReady(ServiceLocator::Get<ModelManager>().LoadResourceAsync(p_path));
+		case EFileType::TEXTURE:	return IsResourceReady(ServiceLocator::Get<TextureManager>().LoadResourceAsync(p_path));
+		case EFileType::SHADER:		return IsResourceReady(ServiceLocator::Get<ShaderManager>().LoadResourceAsync(p_path));
+		case EFileType::MATERIAL:	return IsResourceReady(ServiceLocator::Get<MaterialManager>().LoadResourceAsync(p_path));
+		case EFileType::SOUND:		return IsResourceReady(ServiceLocator::Get<SoundManager>().LoadResourceAsync(p_path));
+		default:					return nullptr;
+		}
+	}
+}
+
 OvCore::SceneSystem::SceneManager::SceneManager(const std::string& p_sceneRootFolder) : m_sceneRootFolder(p_sceneRootFolder)
 {
 	LoadEmptyScene();
@@ -19,31 +62,77 @@ OvCore::SceneSystem::SceneManager::SceneManager(const std::string& p_sceneRootFo
 
 OvCore::SceneSystem::SceneManager::~SceneManager()
 {
+	CancelAsyncLoad();
 	UnloadCurrentScene();
 }
 
 void OvCore::SceneSystem::SceneManager::Update()
 {
-	if (m_delayedLoadCall)
-	{
-		m_delayedLoadCall();
-		m_delayedLoadCall = 0;
-	}
+	if (m_asyncLoad)
+		UpdateAsyncLoad();
 }
 
 void OvCore::SceneSystem::SceneManager::LoadAndPlayDelayed(const std::string& p_path, bool p_absolute)
 {
-	m_delayedLoadCall = [this, p_path, p_absolute]
+	/* The source path of the scene that requested the load is kept, so stopping the game goes back to it */
+	LoadSceneAsync(p_path, p_absolute, [this, previousSourcePath = GetCurrentSceneSourcePath()]
 	{
-		std::string previousSourcePath = GetCurrentSceneSourcePath();
-		LoadScene(p_path, p_absolute);
 		StoreCurrentSceneSourcePath(previousSourcePath);
 		GetCurrentScene()->Play();
-	};
+	});
+}
+
+void OvCore::SceneSystem::SceneManager::LoadSceneAsync(const std::string& p_path, bool p_absolute, std::function<void()> p_onLoaded)
+{
+	m_asyncLoad = std::make_unique<AsyncSceneLoad>();
+	m_asyncLoad->path = (p_absolute ? "" : m_sceneRootFolder) + p_path;
+	m_asyncLoad->onLoaded = std::move(p_onLoaded);
+
+	/* Reading and parsing the file doesn't touch the engine state, so the worker hands back a compiled scene */
+	m_asyncLoad->compilation = std::async(std::launch::async, [path = m_asyncLoad->path]
+	{
+		std::ifstream file(path, std::ios::binary);
+
+		if (!file)
+			return std::vector<char>();
+
+		std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		if (BinaryScene::IsBinaryScene(data.data(), data.size()))
+			return data;
+
+		tinyxml2::XMLDocument doc;
+		doc.Parse(data.data(), data.size());
+		return doc.Error() ? std::vector<char>() : BinaryScene::Compile(doc);
+	});
+
+	SetSceneLoadingProgress(0.0f);
+}
+
+void OvCore::SceneSystem::SceneManager::CancelAsyncLoad()
+{
+	if (m_asyncLoad)
+	{
+		/* Resources already loaded stay in their managers, only the swap of the scene (And its callback) is dropped */
+		m_asyncLoad->pendingResources.clear();
+		m_asyncLoad.reset();
+	}
+}
+
+bool OvCore::SceneSystem::SceneManager::IsLoadingScene() const
+{
+	return m_asyncLoad != nullptr;
+}
+
+float OvCore::SceneSystem::SceneManager::GetSceneLoadingProgress() const
+{
+	return m_asyncLoad ? m_asyncLoad->progress : 1.0f;
 }
 
 void OvCore::SceneSystem::SceneManager::LoadEmptyScene()
 {
+	/* Loading any scene supersedes a pending asynchronous load, which would replace it once ready */
+	CancelAsyncLoad();
 	UnloadCurrentScene();
 
 	m_currentScene = new Scene();
@@ -53,6 +142,7 @@ void OvCore::SceneSystem::SceneManager::LoadEmptyScene()
 
 void OvCore::SceneSystem::SceneManager::LoadEmptyLightedScene()
 {
+	CancelAsyncLoad();
 	UnloadCurrentScene();
 
 	m_currentScene = new Scene();
@@ -75,12 +165,31 @@ void OvCore::SceneSystem::SceneManager::LoadEmptyLightedScene()
 
 bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, bool p_absolute)
 {
+	CancelAsyncLoad();
+
 	std::string completePath = (p_absolute ? "" : m_sceneRootFolder) + p_path;
 
-	tinyxml2::XMLDocument doc;
-	doc.LoadFile(completePath.c_str());
+	/* Compiled scenes are read in place from the mapped file, XML scenes are parsed from it */
+	OvTools::Filesystem::MemoryMappedFile file(completePath);
+	bool loaded = false;
+
+	if (file.IsOpen() && BinaryScene::IsBinaryScene(file.GetData(), file.GetSize()))
+	{
+		loaded = LoadSceneFromMemory(BinaryScene(file.GetData(), file.GetSize()));
+	}
+	else
+	{
+		tinyxml2::XMLDocument doc;
+
+		if (file.IsOpen())
+			doc.Parse(file.GetData(), file.GetSize());
+		else
+			doc.LoadFile(completePath.c_str());
+
+		loaded = LoadSceneFromMemory(doc);
+	}
 
-	if (LoadSceneFromMemory(doc))
+	if (loaded)
 	{
 		StoreCurrentSceneSourcePath(completePath);
 		return true;
@@ -91,6 +200,8 @@ bool OvCore::SceneSystem::SceneManager::LoadScene(const std::string& p_path, boo
 
 bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(tinyxml2::XMLDocument& p_doc)
 {
+	CancelAsyncLoad();
+
 	if (!p_doc.Error())
 	{
 		tinyxml2::XMLNode* root = p_doc.FirstChild();
@@ -110,6 +221,21 @@ bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(tinyxml2::XMLDocumen
 	return false;
 }
 
+bool OvCore::SceneSystem::SceneManager::LoadSceneFromMemory(const BinaryScene& p_binaryScene)
+{
+	CancelAsyncLoad();
+
+	if (p_binaryScene.IsValid())
+	{
+		LoadEmptyScene();
+		m_currentScene->DeserializeBinary(p_binaryScene);
+		return true;
+	}
+
+	OvWindowing::Dialogs::MessageBox message("Scene loading failed", "The scene you are trying to load was not found or corrupted", OvWindowing::Dialogs::MessageBox::EMessageType::ERROR, OvWindowing::Dialogs::MessageBox::EButtonLayout::OK, true);
+	return false;
+}
+
 void OvCore::SceneSystem::SceneManager::UnloadCurrentScene()
 {
 	if (m_currentScene)
@@ -149,6 +275,68 @@ void OvCore::SceneSystem::SceneManager::StoreCurrentSceneSourcePath(const std::s
 	CurrentSceneSourcePathChangedEvent.Invoke(m_currentSceneSourcePath);
 }
 
+void OvCore::SceneSystem::SceneManager::UpdateAsyncLoad()
+{
+	PROFILER_SPY("Scene Streaming");
+
+	auto& load = *m_asyncLoad;
+
+	if (!load.scene)
+	{
+		if (load.compilation.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return;
+
+		load.data = load.compilation.get();
+		load.scene = std::make_unique<BinaryScene>(load.data.data(), load.data.size());
+
+		if (!load.scene->IsValid())
+		{
+			m_asyncLoad.reset();
+			OvWindowing::Dialogs::MessageBox message("Scene loading failed", "The scene you are trying to load was not found or corrupted", OvWindowing::Dialogs::MessageBox::EMessageType::ERROR, OvWindowing::Dialogs::MessageBox::EButtonLayout::OK, true);
+			return;
+		}
+
+		/* Every resource is requested at once, so the workers decode them in parallel */
+		for (const auto& resource : load.scene->GetResources())
+		{
+			if (auto isReady = RequestSceneResource(load.scene->GetString(resource.path), resource.type))
+				load.pendingResources.push_back(std::move(isReady));
+		}
+
+		load.resourceCount = static_cast<uint32_t>(load.pendingResources.size());
+	}
+
+	auto& pending = load.pendingResources;
+	pending.erase(std::remove_if(pending.begin(), pending.end(), [](const auto& p_isReady) { return p_isReady(); }), pending.end());
+
+	/* The last step (Scene instantiation) is accounted as one more resource */
+	const uint32_t loadedResources = load.resourceCount - static_cast<uint32_t>(pending.size());
+	SetSceneLoadingProgress(static_cast<float>(loadedResources) / static_cast<float>(load.resourceCount + 1));
+
+	if (!pending.empty())
+		return;
+
+	/* Every resource is in the managers now, instantiating the scene only resolves them */
+	std::unique_ptr<AsyncSceneLoad> completed = std::move(m_asyncLoad);
+
+	if (LoadSceneFromMemory(*completed->scene))
+	{
+		StoreCurrentSceneSourcePath(completed->path);
+		SetSceneLoadingProgress(1.0f);
+
+		if (completed->onLoaded)
+			completed->onLoaded();
+	}
+}
+
+void OvCore::SceneSystem::SceneManager::SetSceneLoadingProgress(float p_progress)
+{
+	if (m_asyncLoad)
+		m_asyncLoad->progress = p_progress;
+
+	SceneLoadProgressEvent.Invoke(p_progress);
+}
+
 void OvCore::SceneSystem::SceneManager::ForgetCurrentSceneSourcePath()
 {
 	m_currentSceneSourcePath = "";
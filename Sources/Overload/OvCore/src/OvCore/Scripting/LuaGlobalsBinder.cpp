@@ -222,6 +222,7 @@ void OvCore::Scripting::LuaGlobalsBinder::BindGlobals(sol::state & p_luaState)
 		OVSERVICE(SceneManager).LoadAndPlayDelayed(p_path);
 	};
 
+	/* Scripts get raw pointers: a resource that nothing references can be evicted, then the pointer dangles */
 	p_luaState["Resources"]["GetModel"] = [](const std::string& p_resPath) { return OVSERVICE(ModelManager).GetResource(p_resPath); };
 	p_luaState["Resources"]["GetShader"] = [](const std::string& p_resPath) { return OVSERVICE(ShaderManager).GetResource(p_resPath); };
 	p_luaState["Resources"]["GetTexture"] = [](const std::string& p_resPath) { return OVSERVICE(TextureManager).GetResource(p_resPath); };
@@ -13,6 +13,25 @@
 #include <OvMaths/FMatrix4.h>
 #include <OvMaths/FQuaternion.h>
 
+namespace
+{
+	/* Call the given function with a reference to every element of a Lua array, so the elements are modified in place.
+	An element of another type raises a Lua error (Elements before it are already modified) */
+	template<typename T, typename Func>
+	void ForEachElement(const sol::table& p_array, Func p_function)
+	{
+		for (size_t i = 1, count = p_array.size(); i <= count; ++i)
+		{
+			sol::optional<T&> element = p_array.get<sol::optional<T&>>(i);
+
+			if (!element)
+				throw sol::error("Element " + std::to_string(i) + " of the array has an unexpected type");
+
+			p_function(*element);
+		}
+	}
+}
+
 void OvCore::Scripting::LuaMathsBinder::BindMaths(sol::state & p_luaState)
 {
 	using namespace OvMaths;
@@ -87,7 +106,26 @@ void OvCore::Scripting::LuaMathsBinder::BindMaths(sol::state & p_luaState)
 		"Normalize", &FVector3::Normalize,
 		"Lerp", &FVector3::Lerp,
 		"AngleBetween", &FVector3::AngleBetween,
-		"Distance", &FVector3::Distance
+		"Distance", &FVector3::Distance,
+
+		/* In-place methods (Modify the vector instead of creating a new one, so they produce no garbage) */
+		"Set", sol::overload
+		(
+			[](FVector3& target, float x, float y, float z) { target.x = x; target.y = y; target.z = z; },
+			[](FVector3& target, const FVector3& other) { target = other; }
+		),
+		"AddInPlace", [](FVector3& target, const FVector3& other) { target += other; },
+		"SubtractInPlace", [](FVector3& target, const FVector3& other) { target -= other; },
+		"ScaleInPlace", [](FVector3& target, float scalar) { target *= scalar; },
+		"AddScaledInPlace", [](FVector3& target, const FVector3& other, float scalar) { target.x += other.x * scalar; target.y += other.y * scalar; target.z += other.z * scalar; },
+		"NormalizeInPlace", [](FVector3& target) { target = FVector3::Normalize(target); },
+		"LerpInPlace", [](FVector3& target, const FVector3& end, float alpha) { target = FVector3::Lerp(target, end, alpha); },
+		"RotateInPlace", [](FVector3& target, const FQuaternion& rotation) { target = FQuaternion::RotatePoint(target, rotation); },
+
+		/* Bulk methods (Modify every vector of an array in a single call) */
+		"AddToAll", [](const sol::table& vectors, const FVector3& offset) { ForEachElement<FVector3>(vectors, [&offset](FVector3& vector) { vector += offset; }); },
+		"ScaleAll", [](const sol::table& vectors, float scalar) { ForEachElement<FVector3>(vectors, [scalar](FVector3& vector) { vector *= scalar; }); },
+		"NormalizeAll", [](const sol::table& vectors) { ForEachElement<FVector3>(vectors, [](FVector3& vector) { vector = FVector3::Normalize(vector); }); }
 		);
 
 	p_luaState.new_usertype<FVector4>("Vector4",
@@ -228,7 +266,24 @@ void OvCore::Scripting::LuaMathsBinder::BindMaths(sol::state & p_luaState)
 		"CreateView", &FMatrix4::CreateView,
 		"CreateFrustum", &FMatrix4::CreateFrustum,
 		"Get", [](FMatrix4& target, int row, int col) { return target(row, col); },
-		"Set", [](FMatrix4& target, int row, int col, float value) { target(row, col) = value; }
+		"Set", sol::overload
+		(
+			[](FMatrix4& target, int row, int col, float value) { target(row, col) = value; },
+			[](FMatrix4& target, const FMatrix4& other) { target = other; }
+		),
+
+		/* In-place methods (Modify the matrix instead of creating a new one, so they produce no garbage) */
+		"MultiplyInPlace", [](FMatrix4& target, const FMatrix4& other) { target = target * other; },
+
+		/* Bulk methods (Modify every vector of an array in a single call) */
+		"TransformPoints", [](const FMatrix4& matrix, const sol::table& points)
+		{
+			ForEachElement<FVector3>(points, [&matrix](FVector3& point)
+			{
+				const FVector4 result = matrix * FVector4(point.x, point.y, point.z, 1.0f);
+				point = FVector3(result.x, result.y, result.z);
+			});
+		}
 	);
 
 	auto RotatePointOverload = sol::overload
@@ -283,6 +338,19 @@ void OvCore::Scripting::LuaMathsBinder::BindMaths(sol::state & p_luaState)
 		"ToMatrix3", &FQuaternion::ToMatrix3,
 		"ToMatrix4", &FQuaternion::ToMatrix4,
 
+		/* In-place methods (Modify the quaternion instead of creating a new one, so they produce no garbage) */
+		"Set", sol::overload
+		(
+			[](FQuaternion& target, float x, float y, float z, float w) { target.x = x; target.y = y; target.z = z; target.w = w; },
+			[](FQuaternion& target, const FQuaternion& other) { target = other; }
+		),
+		"MultiplyInPlace", [](FQuaternion& target, const FQuaternion& other) { target *= other; },
+		"NormalizeInPlace", [](FQuaternion& target) { target = FQuaternion::Normalize(target); },
+		"SlerpInPlace", [](FQuaternion& target, const FQuaternion& end, float alpha) { target = FQuaternion::Slerp(target, end, alpha); },
+
+		/* Bulk methods (Modify every vector of an array in a single call) */
+		"RotatePoints", [](const FQuaternion& rotation, const sol::table& points) { ForEachElement<FVector3>(points, [&rotation](FVector3& point) { point = FQuaternion::RotatePoint(point, rotation); }); },
+
 		/* Variables */
 		"x", &FQuaternion::x,
 		"y", &FQuaternion::y,
@@ -4,14 +4,48 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <fstream>
+
 #include <OvDebug/Logger.h>
 
 #include "OvCore/Scripting/LuaBinder.h"
 #include "OvCore/Scripting/ScriptInterpreter.h"
 
+namespace
+{
+	const std::string kManifestName = "Scripts.manifest";
+	const std::string kSourceExtension = ".lua";
+	const std::string kBytecodeExtension = ".luac";
+
+	/* Script names are compared with forward slashes, whatever the platform they have been written on */
+	std::string NormalizeScriptName(std::string p_name)
+	{
+		std::replace(p_name.begin(), p_name.end(), '\\', '/');
+		return p_name;
+	}
+
+	std::unique_ptr<sol::state> CreateLuaState()
+	{
+		auto luaState = std::make_unique<sol::state>();
+		luaState->open_libraries(sol::lib::base, sol::lib::math);
+		OvCore::Scripting::LuaBinder::CallBinders(*luaState);
+		return luaState;
+	}
+}
+
 OvCore::Scripting::ScriptInterpreter::ScriptInterpreter(const std::string& p_scriptRootFolder) :
 	m_scriptRootFolder(p_scriptRootFolder)
 {
+	/* A shipped build lists its precompiled scripts in a manifest, one script name per line */
+	std::ifstream manifest(m_scriptRootFolder + kManifestName);
+
+	for (std::string line; std::getline(manifest, line);)
+	{
+		if (!line.empty())
+			m_bytecodeScripts.insert(NormalizeScriptName(line));
+	}
+
 	CreateLuaContextAndBindGlobals();
 
 	/* Listen to behaviours */
@@ -28,20 +62,41 @@ void OvCore::Scripting::ScriptInterpreter::CreateLuaContextAndBindGlobals()
 {
 	if (!m_luaState)
 	{
-		m_luaState = std::make_unique<sol::state>();
-		m_luaState->open_libraries(sol::lib::base, sol::lib::math);
-		OvCore::Scripting::LuaBinder::CallBinders(*m_luaState);
-		m_isOk = true;
+		m_luaState = CreateLuaState();
+		RegisterBehaviours();
+	}
+}
 
-		std::for_each(m_behaviours.begin(), m_behaviours.end(), [this](ECS::Components::Behaviour* behaviour)
+void OvCore::Scripting::ScriptInterpreter::ResetLuaContext()
+{
+	/* Compiled chunks belong to the state they have been loaded in: the up-to-date ones are dumped, then loaded as bytecode in the new state */
+	std::unordered_map<std::string, std::pair<std::filesystem::file_time_type, sol::bytecode>> upToDateScripts;
+
+	for (auto& [name, script] : m_compiledScripts)
+	{
+		std::error_code error;
+		const auto lastWriteTime = std::filesystem::last_write_time(GetScriptPath(name), error);
+
+		if (!error && lastWriteTime == script.lastWriteTime)
 		{
-			if (!behaviour->RegisterToLuaContext(*m_luaState, m_scriptRootFolder))
-				m_isOk = false;
-		});
+			if (auto bytecode = script.chunk.dump(&sol::dump_pass_on_error); !bytecode.empty())
+				upToDateScripts.emplace(name, std::make_pair(script.lastWriteTime, std::move(bytecode)));
+		}
+	}
+
+	DestroyLuaContext();
 
-		if (!m_isOk)
-			OVLOG_ERROR("Script interpreter failed to register scripts. Check your lua scripts");
+	m_luaState = CreateLuaState();
+
+	for (auto& [name, script] : upToDateScripts)
+	{
+		sol::load_result loadResult = m_luaState->load(script.second.as_string_view(), "@" + GetScriptPath(name), sol::load_mode::binary);
+
+		if (loadResult.valid())
+			m_compiledScripts[name] = { script.first, loadResult.get<sol::protected_function>() };
 	}
+
+	RegisterBehaviours();
 }
 
 void OvCore::Scripting::ScriptInterpreter::DestroyLuaContext()
@@ -53,6 +108,7 @@ void OvCore::Scripting::ScriptInterpreter::DestroyLuaContext()
 			behaviour->UnregisterFromLuaContext();
 		});
 
+		m_compiledScripts.clear();
 		m_luaState.reset();
 		m_isOk = false;
 	}
@@ -64,7 +120,7 @@ void OvCore::Scripting::ScriptInterpreter::Consider(OvCore::ECS::Components::Beh
 	{
 		m_behaviours.push_back(p_toConsider);
 
-		if (!p_toConsider->RegisterToLuaContext(*m_luaState, m_scriptRootFolder))
+		if (!RegisterBehaviour(*p_toConsider))
 			m_isOk = false;
 	}
 }
@@ -74,21 +130,174 @@ void OvCore::Scripting::ScriptInterpreter::Unconsider(OvCore::ECS::Components::B
 	if (m_luaState)
 		p_toUnconsider->UnregisterFromLuaContext();
 
-	m_behaviours.erase(std::remove_if(m_behaviours.begin(), m_behaviours.end(), [p_toUnconsider](ECS::Components::Behaviour* behaviour)
-	{
-		return p_toUnconsider == behaviour;
-	}));
+	m_behaviours.erase(std::remove(m_behaviours.begin(), m_behaviours.end(), p_toUnconsider), m_behaviours.end());
 
-	RefreshAll(); // Unconsidering a script is impossible with Lua, we have to reparse every behaviours
+	/* The table of the behaviour is left to the garbage collector, only a failing behaviour can change the status */
+	if (m_luaState && !m_isOk)
+	{
+		m_isOk = std::all_of(m_behaviours.begin(), m_behaviours.end(), [](ECS::Components::Behaviour* behaviour)
+		{
+			return behaviour->GetTable().valid();
+		});
+	}
 }
 
 void OvCore::Scripting::ScriptInterpreter::RefreshAll()
 {
-	DestroyLuaContext();
-	CreateLuaContextAndBindGlobals();
+	if (!m_luaState)
+	{
+		CreateLuaContextAndBindGlobals();
+		return;
+	}
+
+	std::vector<std::string> outdatedScripts;
+
+	for (auto it = m_compiledScripts.begin(); it != m_compiledScripts.end();)
+	{
+		std::error_code error;
+		const auto lastWriteTime = std::filesystem::last_write_time(GetScriptPath(it->first), error);
+
+		if (error || lastWriteTime != it->second.lastWriteTime)
+		{
+			outdatedScripts.push_back(it->first);
+			it = m_compiledScripts.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	m_isOk = true;
+
+	for (auto behaviour : m_behaviours)
+	{
+		const bool outdated = std::find(outdatedScripts.begin(), outdatedScripts.end(), behaviour->name) != outdatedScripts.end();
+
+		if (outdated || !behaviour->GetTable().valid())
+		{
+			behaviour->UnregisterFromLuaContext();
+
+			if (!RegisterBehaviour(*behaviour))
+				m_isOk = false;
+		}
+	}
+
+	if (!m_isOk)
+		OVLOG_ERROR("Script interpreter failed to register scripts. Check your lua scripts");
 }
 
 bool OvCore::Scripting::ScriptInterpreter::IsOk() const
 {
 	return m_isOk;
 }
+
+bool OvCore::Scripting::ScriptInterpreter::CompileScripts(const std::string& p_scriptFolder)
+{
+	/* Compiling doesn't run the scripts, so the state needs neither libraries nor bindings */
+	sol::state luaState;
+	std::vector<std::string> compiledScripts;
+	bool succeeded = true;
+
+	std::vector<std::filesystem::path> sources;
+
+	for (auto& entry : std::filesystem::recursive_directory_iterator(p_scriptFolder))
+	{
+		if (entry.is_regular_file() && entry.path().extension() == kSourceExtension)
+			sources.push_back(entry.path());
+	}
+
+	for (const auto& source : sources)
+	{
+		sol::load_result loadResult = luaState.load_file(source.string(), sol::load_mode::text);
+
+		if (!loadResult.valid())
+		{
+			sol::error err = loadResult;
+			OVLOG_ERROR(err.what());
+			succeeded = false;
+			continue;
+		}
+
+		/* Debug information is kept, so runtime errors still report script lines */
+		const sol::function chunk = loadResult;
+		const auto bytecode = chunk.dump(&sol::dump_pass_on_error);
+
+		auto destination = source;
+		destination.replace_extension(kBytecodeExtension);
+
+		std::ofstream output(destination, std::ios::binary);
+		output.write(reinterpret_cast<const char*>(bytecode.data()), bytecode.size());
+
+		if (bytecode.empty() || !output)
+		{
+			OVLOG_ERROR("Failed to write the bytecode of: " + source.string());
+			output.close();
+			std::filesystem::remove(destination);
+			succeeded = false;
+			continue;
+		}
+
+		std::filesystem::remove(source);
+
+		auto name = std::filesystem::relative(source, p_scriptFolder);
+		name.replace_extension();
+		compiledScripts.push_back(name.generic_string());
+	}
+
+	std::ofstream manifest(std::filesystem::path(p_scriptFolder) / kManifestName);
+
+	for (const auto& name : compiledScripts)
+		manifest << name << '\n';
+
+	return succeeded && manifest.good();
+}
+
+std::string OvCore::Scripting::ScriptInterpreter::GetScriptPath(const std::string& p_name) const
+{
+	const bool precompiled = m_bytecodeScripts.find(NormalizeScriptName(p_name)) != m_bytecodeScripts.end();
+	return m_scriptRootFolder + p_name + (precompiled ? kBytecodeExtension : kSourceExtension);
+}
+
+const sol::protected_function* OvCore::Scripting::ScriptInterpreter::GetCompiledScript(const std::string& p_name)
+{
+	if (auto found = m_compiledScripts.find(p_name); found != m_compiledScripts.end())
+		return &found->second.chunk;
+
+	const std::string path = GetScriptPath(p_name);
+
+	sol::load_result loadResult = m_luaState->load_file(path);
+
+	if (!loadResult.valid())
+	{
+		sol::error err = loadResult;
+		OVLOG_ERROR(err.what());
+		return nullptr;
+	}
+
+	std::error_code error;
+	auto& compiledScript = m_compiledScripts[p_name];
+	compiledScript.lastWriteTime = std::filesystem::last_write_time(path, error);
+	compiledScript.chunk = loadResult.get<sol::protected_function>();
+	return &compiledScript.chunk;
+}
+
+void OvCore::Scripting::ScriptInterpreter::RegisterBehaviours()
+{
+	m_isOk = true;
+
+	std::for_each(m_behaviours.begin(), m_behaviours.end(), [this](ECS::Components::Behaviour* behaviour)
+	{
+		if (!RegisterBehaviour(*behaviour))
+			m_isOk = false;
+	});
+
+	if (!m_isOk)
+		OVLOG_ERROR("Script interpreter failed to register scripts. Check your lua scripts");
+}
+
+bool OvCore::Scripting::ScriptInterpreter::RegisterBehaviour(OvCore::ECS::Components::Behaviour& p_behaviour)
+{
+	const auto chunk = GetCompiledScript(p_behaviour.name);
+	return chunk && p_behaviour.RegisterToLuaContext(*chunk);
+}
@@ -98,14 +98,15 @@ namespace OvEditor::Core
 		std::unique_ptr<OvRendering::Buffers::ShaderStorageBuffer>	lightSSBO;
 		std::unique_ptr<OvRendering::Buffers::ShaderStorageBuffer>	simulatedLightSSBO;
 		
-		OvCore::SceneSystem::SceneManager sceneManager;
-
+		/* Declared before the scene manager: the components of the scene release their resource references when it is destroyed */
 		OvCore::ResourceManagement::ModelManager	modelManager;
 		OvCore::ResourceManagement::TextureManager	textureManager;
 		OvCore::ResourceManagement::ShaderManager	shaderManager;
 		OvCore::ResourceManagement::MaterialManager	materialManager;
 		OvCore::ResourceManagement::SoundManager	soundManager;
 
+		OvCore::SceneSystem::SceneManager sceneManager;
+
 		OvWindowing::Settings::WindowSettings windowSettings;
 
 		OvTools::Filesystem::IniFile projectSettings;
@@ -61,8 +61,9 @@ namespace OvEditor::Core
 
 		/**
 		* Render the scene for actor picking (Unlit version of the scene with colors indicating actor IDs)
+		* @param p_frustum (Only the models in this frustum are rendered)
 		*/
-		void RenderSceneForActorPicking();
+		void RenderSceneForActorPicking(const OvRendering::Data::Frustum& p_frustum);
 
 		/**
 		* Render the User Interface
@@ -201,5 +202,7 @@ namespace OvEditor::Core
 		OvCore::Resources::Material m_gizmoBallMaterial;
 		OvCore::Resources::Material m_gizmoPickingMaterial;
 		OvCore::Resources::Material m_actorPickingMaterial;
+
+		std::vector<OvCore::ECS::Components::CModelRenderer*> m_pickableModelRenderers;
 	};
 }
\ No newline at end of file
@@ -85,6 +85,7 @@ namespace OvEditor::Panels
 
 		OvTools::Eventing::Event<> m_materialDroppedEvent;
 		OvTools::Eventing::Event<> m_shaderDroppedEvent;
+		OvTools::Eventing::Event<> m_textureDroppedEvent;
 
 		OvUI::Widgets::Layout::Group* m_settings			= nullptr;
 		OvUI::Widgets::Layout::Group* m_materialSettings	= nullptr;
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <OvAnalytics/Profiling/Profiler.h>
+#include <OvCore/ResourceManagement/AResourceManager.h>
 
 #include <OvUI/Panels/PanelWindow.h>
 #include <OvUI/Widgets/Texts/TextColored.h>
@@ -51,6 +52,7 @@ namespace OvEditor::Panels
 	private:
 		OvUI::Types::Color CalculateActionColor(double p_percentage) const;
 		std::string GenerateActionString(OvAnalytics::Profiling::ProfilerReport::Action& p_action);
+		void AddResourceStatistics(const std::string& p_name, const OvCore::ResourceManagement::ResourceStatistics& p_statistics);
 
 	private:
 		enum class EProfilingMode
@@ -71,6 +73,8 @@ namespace OvEditor::Panels
 		OvUI::Widgets::Texts::TextColored* m_fpsText;
 		OvUI::Widgets::Texts::TextColored* m_elapsedFramesText;
 		OvUI::Widgets::Texts::TextColored* m_elapsedTimeText;
+		OvUI::Widgets::Texts::TextColored* m_frameInfoText;
 		OvUI::Widgets::Layout::Columns<5>* m_actionList;
+		OvUI::Widgets::Layout::Columns<7>* m_resourceList;
 	};
 }
\ No newline at end of file
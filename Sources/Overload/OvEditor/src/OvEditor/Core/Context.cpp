@@ -5,6 +5,7 @@
 */
 
 #include <filesystem>
+#include <algorithm>
 
 #include <OvRendering/Entities/Light.h>
 #include <OvCore/Global/ServiceLocator.h>
@@ -31,6 +32,15 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 		projectSettings.Rewrite();
 	}
 
+	/* Settings introduced after the creation of the project get their default value */
+	const bool modelBudgetAdded = projectSettings.Add<int>("model_memory_budget", 0);
+	const bool textureBudgetAdded = projectSettings.Add<int>("texture_memory_budget", 0);
+	const bool materialBudgetAdded = projectSettings.Add<int>("material_memory_budget", 0);
+	const bool physicsRateAdded = projectSettings.Add<int>("physics_fixed_rate", 60);
+
+	if (modelBudgetAdded || textureBudgetAdded || materialBudgetAdded || physicsRateAdded)
+		projectSettings.Rewrite();
+
 	ModelManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	TextureManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
 	ShaderManager::ProvideAssetPaths(projectAssetsPath, engineAssetsPath);
@@ -113,7 +123,8 @@ OvEditor::Core::Context::Context(const std::string& p_projectPath, const std::st
 		sizeof(float) +
 		sizeof(OvMaths::FMatrix4),
 		0, 0,
-		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW
+		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW,
+		OvRendering::Buffers::EUniformBufferMode::PERSISTENT_RING
 	);
 
 	lightSSBO			= std::make_unique<OvRendering::Buffers::ShaderStorageBuffer>(OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW);
@@ -154,6 +165,7 @@ void OvEditor::Core::Context::ResetProjectSettings()
 {
 	projectSettings.RemoveAll();
 	projectSettings.Add<float>("gravity", -9.81f);
+	projectSettings.Add<int>("physics_fixed_rate", 60);
 	projectSettings.Add<int>("x_resolution", 1280);
 	projectSettings.Add<int>("y_resolution", 720);
 	projectSettings.Add<bool>("fullscreen", false);
@@ -165,6 +177,9 @@ void OvEditor::Core::Context::ResetProjectSettings()
 	projectSettings.Add<int>("opengl_major", 4);
 	projectSettings.Add<int>("opengl_minor", 3);
 	projectSettings.Add<bool>("dev_build", true);
+	projectSettings.Add<int>("model_memory_budget", 0);
+	projectSettings.Add<int>("texture_memory_budget", 0);
+	projectSettings.Add<int>("material_memory_budget", 0);
 }
 
 bool OvEditor::Core::Context::IsProjectSettingsIntegrityVerified()
@@ -187,4 +202,5 @@ bool OvEditor::Core::Context::IsProjectSettingsIntegrityVerified()
 void OvEditor::Core::Context::ApplyProjectSettings()
 {
 	physicsEngine->SetGravity({ 0.0f, projectSettings.Get<float>("gravity"), 0.0f });
+	physicsEngine->SetFixedTimeStep(1.0f / std::max(projectSettings.Get<int>("physics_fixed_rate"), 1));
 }
@@ -6,6 +6,7 @@
 
 #include <OvAnalytics/Profiling/ProfilerSpy.h>
 #include <OvPhysics/Core/PhysicsEngine.h>
+#include <OvCore/ResourceManagement/ResourceLoader.h>
 
 #include "OvEditor/Core/Editor.h"
 #include "OvEditor/Panels/MenuBar.h"
@@ -85,6 +86,7 @@ void OvEditor::Core::Editor::Update(float p_deltaTime)
 	UpdateCurrentEditorMode(p_deltaTime);
 	PrepareRendering(p_deltaTime);
 	UpdateEditorPanels(p_deltaTime);
+	m_context.renderer->ClearFrameInfo(); // Cleared after the panels update so the profiler displays the previous frame
 	RenderViews(p_deltaTime);
 	RenderEditorUI(p_deltaTime);
 	m_editorActions.ExecuteDelayedActions();
@@ -106,27 +108,31 @@ void OvEditor::Core::Editor::UpdateCurrentEditorMode(float p_deltaTime)
 	else
 		UpdateEditMode(p_deltaTime);
 
+	{
+		PROFILER_SPY("Transform Resolve");
+		m_context.sceneManager.GetCurrentScene()->ResolveTransforms();
+	}
+
 	{
 		PROFILER_SPY("Scene garbage collection");
 		m_context.sceneManager.GetCurrentScene()->CollectGarbages();
-		m_context.sceneManager.Update();
 	}
+
+	OvCore::ResourceManagement::ResourceLoader::ProcessUploads();
+	m_context.sceneManager.Update();
 }
 
 void OvEditor::Core::Editor::UpdatePlayMode(float p_deltaTime)
 {
 	auto currentScene = m_context.sceneManager.GetCurrentScene();
-	bool simulationApplied = false;
 
 	{
 		PROFILER_SPY("Physics Update");
-		simulationApplied = m_context.physicsEngine->Update(p_deltaTime);
-	}
-
-	if (simulationApplied)
-	{
-		PROFILER_SPY("FixedUpdate");
-		currentScene->FixedUpdate(p_deltaTime);
+		m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+		{
+			PROFILER_SPY("FixedUpdate");
+			currentScene->FixedUpdate(p_fixedDeltaTime);
+		});
 	}
 
 	{
@@ -244,6 +250,7 @@ void OvEditor::Core::Editor::PostUpdate()
 	PROFILER_SPY("Editor Post-Update");
 
 	m_context.window->SwapBuffers();
+	m_context.engineUBO->NextFrame();
 	m_context.inputManager->ClearEvents();
 	++m_elapsedFrames;
 }
\ No newline at end of file
@@ -16,6 +16,8 @@
 #include <OvCore/ECS/Components/CModelRenderer.h>
 #include <OvCore/ECS/Components/CMaterialRenderer.h>
 #include <OvCore/ECS/Components/CAudioSource.h>
+#include <OvCore/SceneSystem/BinaryScene.h>
+#include <OvCore/Scripting/ScriptInterpreter.h>
 
 #include <OvWindowing/Dialogs/OpenFileDialog.h>
 #include <OvWindowing/Dialogs/SaveFileDialog.h>
@@ -219,12 +221,52 @@ void OvEditor::Core::EditorActions::BuildAtLocation(const std::string & p_config
 					{
 						OVLOG_INFO("Data\\User\\Assets\\ directory copied");
 
+						/* Scenes are shipped compiled, models and textures cooked, so the game reads them in place instead of parsing them */
+						for (auto& entry : std::filesystem::recursive_directory_iterator(buildPath + "Data\\User\\Assets\\"))
+						{
+							if (!entry.is_regular_file())
+								continue;
+
+							switch (OvTools::Utils::PathParser::GetFileType(entry.path().string()))
+							{
+							case OvTools::Utils::PathParser::EFileType::SCENE:
+								if (OvCore::SceneSystem::BinaryScene::CompileFile(entry.path().string(), entry.path().string()))
+									OVLOG_INFO("Scene compiled: " + entry.path().string());
+								else
+									OVLOG_WARNING("Failed to compile scene (Kept as XML): " + entry.path().string());
+								break;
+
+							case OvTools::Utils::PathParser::EFileType::MODEL:
+								if (OvCore::ResourceManagement::ModelManager::CookModel(entry.path().string()))
+									OVLOG_INFO("Model cooked: " + entry.path().string());
+								else
+									OVLOG_WARNING("Failed to cook model (Will be imported at runtime): " + entry.path().string());
+								break;
+
+							case OvTools::Utils::PathParser::EFileType::TEXTURE:
+								if (OvCore::ResourceManagement::TextureManager::CookTexture(entry.path().string()))
+									OVLOG_INFO("Texture cooked: " + entry.path().string());
+								else
+									OVLOG_WARNING("Failed to cook texture (Will be decoded at runtime): " + entry.path().string());
+								break;
+
+							default:
+								break;
+							}
+						}
+
 						std::filesystem::copy(m_context.projectScriptsPath, buildPath + "Data\\User\\Scripts\\", std::filesystem::copy_options::recursive, err);
 
 						if (!err)
 						{
 							OVLOG_INFO("Data\\User\\Scripts\\ directory copied");
 
+							/* Scripts are shipped as bytecode, so the game loads them without parsing */
+							if (OvCore::Scripting::ScriptInterpreter::CompileScripts(buildPath + "Data\\User\\Scripts\\"))
+								OVLOG_INFO("Scripts compiled");
+							else
+								OVLOG_WARNING("Failed to compile some scripts (Kept as sources)");
+
 							std::filesystem::copy(m_context.engineAssetsPath, buildPath + "Data\\Engine\\", std::filesystem::copy_options::recursive, err);
 
 							if (!err)
@@ -427,7 +469,8 @@ void OvEditor::Core::EditorActions::StartPlaying()
 {
 	if (m_editorMode == EEditorMode::EDIT)
 	{
-		m_context.scriptInterpreter->RefreshAll();
+		/* Every play starts from fresh Lua globals, unchanged scripts aren't parsed again */
+		m_context.scriptInterpreter->ResetLuaContext();
 		EDITOR_PANEL(Panels::Inspector, "Inspector").Refresh();
 
 		if (m_context.scriptInterpreter->IsOk())
@@ -470,6 +513,8 @@ void OvEditor::Core::EditorActions::StopPlaying()
 		if (auto targetActor = EDITOR_PANEL(Panels::Inspector, "Inspector").GetTargetActor())
 			focusedActorID = targetActor->GetID();
 
+		/* A scene requested by the game (LoadAndPlayDelayed) must not replace the restored scene once loaded */
+		m_context.sceneManager.CancelAsyncLoad();
 		m_context.sceneManager.LoadSceneFromMemory(m_sceneBackup);
 		if (loadedFromDisk)
 			m_context.sceneManager.StoreCurrentSceneSourcePath(sceneSourcePath); // To bo able to save or reload the scene whereas the scene is loaded from memory (Supposed to have no path)
@@ -839,11 +884,15 @@ void OvEditor::Core::EditorActions::PropagateFileRename(std::string p_previousNa
 		{
 			for (auto[name, instance] : OvCore::Global::ServiceLocator::Get<OvCore::ResourceManagement::MaterialManager>().GetResources())
 				if (instance)
+				{
 					for (auto&[name, value] : instance->GetUniformsData())
 						if (value.has_value() && value.type() == typeid(OvRendering::Resources::Texture*))
 							if (std::any_cast<OvRendering::Resources::Texture*>(value) == texture)
 								value = static_cast<OvRendering::Resources::Texture*>(nullptr);
 
+					instance->UpdateTextureReferences();
+				}
+
 			auto& assetView = EDITOR_PANEL(Panels::AssetView, "Asset View");
 			auto assetViewRes = assetView.GetResource();
 			if (auto pval = std::get_if<OvRendering::Resources::Texture*>(&assetViewRes); pval && *pval)
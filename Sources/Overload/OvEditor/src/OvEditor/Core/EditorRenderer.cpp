@@ -165,12 +165,14 @@ void OvEditor::Core::EditorRenderer::RenderScene(const OvMaths::FVector3& p_came
 	m_context.lightSSBO->Unbind();
 }
 
-void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking()
+void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking(const OvRendering::Data::Frustum& p_frustum)
 {
 	auto& scene = *m_context.sceneManager.GetCurrentScene();
 
 	/* Render models */
-	for (auto modelRenderer : scene.GetFastAccessComponents().modelRenderers)
+	scene.FindModelRenderersInFrustum(p_frustum, m_pickableModelRenderers);
+
+	for (auto modelRenderer : m_pickableModelRenderers)
 	{
 		auto& actor = modelRenderer->owner;
 
@@ -191,7 +193,7 @@ void OvEditor::Core::EditorRenderer::RenderSceneForActorPicking()
 
 						if (mesh->GetMaterialIndex() < MAX_MATERIAL_COUNT)
 						{
-							material = materials.at(mesh->GetMaterialIndex());
+							material = materials.at(mesh->GetMaterialIndex()).Get();
 							if (!material || !material->GetShader())
 								material = &m_emptyMaterial;
 						}
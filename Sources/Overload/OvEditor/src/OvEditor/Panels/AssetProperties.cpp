@@ -241,6 +241,7 @@ void OvEditor::Panels::AssetProperties::CreateModelSettings()
 	m_metadata->Add("FORCE_GEN_NORMALS", false);
 	m_metadata->Add("DROP_NORMALS", false);
 	m_metadata->Add("GEN_BOUNDING_BOXES", false);
+	m_metadata->Add("COMPRESS_VERTICES", false);
 
 	MODEL_FLAG_ENTRY("CALC_TANGENT_SPACE");
 	MODEL_FLAG_ENTRY("JOIN_IDENTICAL_VERTICES");
@@ -273,6 +274,7 @@ void OvEditor::Panels::AssetProperties::CreateModelSettings()
 	MODEL_FLAG_ENTRY("FORCE_GEN_NORMALS");
 	MODEL_FLAG_ENTRY("DROP_NORMALS");
 	MODEL_FLAG_ENTRY("GEN_BOUNDING_BOXES");
+	MODEL_FLAG_ENTRY("COMPRESS_VERTICES");
 };
 
 void OvEditor::Panels::AssetProperties::CreateTextureSettings()
@@ -280,6 +282,7 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	m_metadata->Add("MIN_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR_MIPMAP_LINEAR));
 	m_metadata->Add("MAG_FILTER", static_cast<int>(OvRendering::Settings::ETextureFilteringMode::LINEAR));
 	m_metadata->Add("ENABLE_MIPMAPPING", true);
+	m_metadata->Add("COMPRESSION", static_cast<int>(OvRendering::Settings::ETextureCompression::NONE));
 
     std::map<int, std::string> filteringModes
     {
@@ -308,6 +311,22 @@ void OvEditor::Panels::AssetProperties::CreateTextureSettings()
 	};
 
 	OvCore::Helpers::GUIDrawer::DrawBoolean(*m_settingsColumns, "ENABLE_MIPMAPPING", [&]() { return m_metadata->Get<bool>("ENABLE_MIPMAPPING"); }, [&](bool value) { m_metadata->Set<bool>("ENABLE_MIPMAPPING", value); });
+
+	OvCore::Helpers::GUIDrawer::CreateTitle(*m_settingsColumns, "COMPRESSION");
+	auto& compression = m_settingsColumns->CreateWidget<OvUI::Widgets::Selection::ComboBox>(m_metadata->Get<int>("COMPRESSION"));
+	compression.choices =
+	{
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::NONE), "NONE" },
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::AUTO), "AUTO (BC1 / BC3)" },
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::BC1), "BC1" },
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::BC3), "BC3" },
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::BC5), "BC5 (Normal map)" },
+		{ static_cast<int>(OvRendering::Settings::ETextureCompression::BC7), "BC7" }
+	};
+	compression.ValueChangedEvent += [this](int p_choice)
+	{
+		m_metadata->Set("COMPRESSION", p_choice);
+	};
 }
 
 void OvEditor::Panels::AssetProperties::Apply()
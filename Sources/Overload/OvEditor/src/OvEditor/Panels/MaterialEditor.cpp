@@ -118,6 +118,7 @@ OvEditor::Panels::MaterialEditor::MaterialEditor
 
 	m_materialDroppedEvent	+= std::bind(&MaterialEditor::OnMaterialDropped, this);
 	m_shaderDroppedEvent	+= std::bind(&MaterialEditor::OnShaderDropped, this);
+	m_textureDroppedEvent	+= [this] { if (m_target) m_target->UpdateTextureReferences(); };
 }
 
 void OvEditor::Panels::MaterialEditor::Refresh()
@@ -191,7 +192,10 @@ void OvEditor::Panels::MaterialEditor::OnShaderDropped()
 	m_shaderSettings->enabled = m_shader; // Enable m_shaderSettings group if the shader of the target material is non-null
 
 	if (m_shader != m_target->GetShader())
+	{
 		m_target->SetShader(m_shader);
+		m_target->UpdateTextureReferences();
+	}
 
 	if (m_shaderSettings->enabled)
 	{
@@ -349,7 +353,7 @@ void OvEditor::Panels::MaterialEditor::GenerateShaderSettingsContent()
 			case UniformType::UNIFORM_FLOAT_VEC2:	GUIDrawer::DrawVec2(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector2&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);	break;
 			case UniformType::UNIFORM_FLOAT_VEC3:	DrawHybridVec3(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector3&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);			break;
 			case UniformType::UNIFORM_FLOAT_VEC4:	DrawHybridVec4(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<OvMaths::FVector4&>(*info.second), 0.01f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);			break;
-			case UniformType::UNIFORM_SAMPLER_2D:	GUIDrawer::DrawTexture(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<Texture * &>(*info.second));																break;
+			case UniformType::UNIFORM_SAMPLER_2D:	GUIDrawer::DrawTexture(*m_shaderSettingsColumns, UniformFormat(info.first), reinterpret_cast<Texture * &>(*info.second), &m_textureDroppedEvent);										break;
 			}
 		}
 	}
@@ -9,6 +9,8 @@
 #include <OvDebug/Logger.h>
 #include <OvUI/Widgets/Visual/Separator.h>
 
+#include "OvEditor/Core/EditorActions.h"
+
 using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
 using namespace OvUI::Types;
@@ -38,9 +40,12 @@ OvEditor::Panels::Profiler::Profiler
 	};
 	m_elapsedFramesText = &CreateWidget<Texts::TextColored>("", Color(1.f, 0.8f, 0.01f, 1));
 	m_elapsedTimeText = &CreateWidget<Texts::TextColored>("", Color(1.f, 0.8f, 0.01f, 1));
+	m_frameInfoText = &CreateWidget<Texts::TextColored>("", Color(1.f, 0.8f, 0.01f, 1));
 	m_separator = &CreateWidget<OvUI::Widgets::Visual::Separator>();
 	m_actionList = &CreateWidget<Layout::Columns<5>>();
 	m_actionList->widths = { 300.f, 100.f, 100.f, 100.f, 200.f };
+	m_resourceList = &CreateWidget<Layout::Columns<7>>();
+	m_resourceList->widths = { 100.f, 100.f, 100.f, 100.f, 100.f, 100.f, 100.f };
 
 	Enable(false, true);
 }
@@ -71,6 +76,12 @@ void OvEditor::Panels::Profiler::Update(float p_deltaTime)
 				m_elapsedFramesText->content = "Elapsed frames: " + std::to_string(report.elapsedFrames);
 				m_elapsedTimeText->content = "Elapsed time: " + std::to_string(report.elaspedTime);
 
+				const auto& frameInfo = EDITOR_CONTEXT(renderer)->GetFrameInfo();
+				m_frameInfoText->content =
+					"Batches: " + std::to_string(frameInfo.batchCount) +
+					" | Program binds: " + std::to_string(frameInfo.programBinds) +
+					" | Material binds: " + std::to_string(frameInfo.materialBinds);
+
 				m_actionList->CreateWidget<Texts::Text>("Action");
 				m_actionList->CreateWidget<Texts::Text>("Total duration");
 				m_actionList->CreateWidget<Texts::Text>("Frame duration");
@@ -80,12 +91,27 @@ void OvEditor::Panels::Profiler::Update(float p_deltaTime)
 				for (auto& action : report.actions)
 				{
 					auto color = CalculateActionColor(action.percentage);
-					m_actionList->CreateWidget<Texts::TextColored>(action.name, color);
+					m_actionList->CreateWidget<Texts::TextColored>(action.parent.empty() ? action.name : action.parent + " > " + action.name, color);
 					m_actionList->CreateWidget<Texts::TextColored>(std::to_string(action.duration) + "s", color);
 					m_actionList->CreateWidget<Texts::TextColored>(std::to_string(action.duration / action.calls) + "s", color);
 					m_actionList->CreateWidget<Texts::TextColored>(std::to_string(action.percentage) + "%%", color);
 					m_actionList->CreateWidget<Texts::TextColored>(std::to_string(action.calls) + " calls", color);
 				}
+
+				m_resourceList->RemoveAllWidgets();
+				m_resourceList->CreateWidget<Texts::Text>("Resources");
+				m_resourceList->CreateWidget<Texts::Text>("Loaded");
+				m_resourceList->CreateWidget<Texts::Text>("Memory");
+				m_resourceList->CreateWidget<Texts::Text>("Budget");
+				m_resourceList->CreateWidget<Texts::Text>("Hits");
+				m_resourceList->CreateWidget<Texts::Text>("Misses");
+				m_resourceList->CreateWidget<Texts::Text>("Evictions");
+
+				AddResourceStatistics("Models", EDITOR_CONTEXT(modelManager).GetStatistics());
+				AddResourceStatistics("Textures", EDITOR_CONTEXT(textureManager).GetStatistics());
+				AddResourceStatistics("Shaders", EDITOR_CONTEXT(shaderManager).GetStatistics());
+				AddResourceStatistics("Materials", EDITOR_CONTEXT(materialManager).GetStatistics());
+				AddResourceStatistics("Sounds", EDITOR_CONTEXT(soundManager).GetStatistics());
 			}
 
 			m_timer -= m_frequency;
@@ -108,11 +134,13 @@ void OvEditor::Panels::Profiler::Enable(bool p_value, bool p_disableLog)
 		m_profiler.Disable();
 		m_profiler.ClearHistory();
 		m_actionList->RemoveAllWidgets();
+		m_resourceList->RemoveAllWidgets();
 	}
 
 	m_captureResumeButton->enabled = p_value;
 	m_elapsedFramesText->enabled = p_value;
 	m_elapsedTimeText->enabled = p_value;
+	m_frameInfoText->enabled = p_value;
 	m_separator->enabled = p_value;
 }
 
@@ -124,11 +152,22 @@ OvUI::Types::Color OvEditor::Panels::Profiler::CalculateActionColor(double p_per
 	else							return { 1.0f, 0.0f, 0.0f, 1.0f };
 }
 
+void OvEditor::Panels::Profiler::AddResourceStatistics(const std::string& p_name, const OvCore::ResourceManagement::ResourceStatistics& p_statistics)
+{
+	m_resourceList->CreateWidget<Texts::Text>(p_name);
+	m_resourceList->CreateWidget<Texts::Text>(std::to_string(p_statistics.resourceCount));
+	m_resourceList->CreateWidget<Texts::Text>(std::to_string(p_statistics.memoryUsage / 1024) + " KB");
+	m_resourceList->CreateWidget<Texts::Text>(p_statistics.memoryBudget ? std::to_string(p_statistics.memoryBudget / 1024) + " KB" : "None");
+	m_resourceList->CreateWidget<Texts::Text>(std::to_string(p_statistics.hits));
+	m_resourceList->CreateWidget<Texts::Text>(std::to_string(p_statistics.misses));
+	m_resourceList->CreateWidget<Texts::Text>(std::to_string(p_statistics.evictions));
+}
+
 std::string OvEditor::Panels::Profiler::GenerateActionString(OvAnalytics::Profiling::ProfilerReport::Action & p_action)
 {
 	std::string result;
 
-	result += "[" + p_action.name + "]";
+	result += "[" + (p_action.parent.empty() ? p_action.name : p_action.parent + " > " + p_action.name) + "]";
 	result += std::to_string(p_action.duration) + "s (total) | ";
 	result += std::to_string(p_action.duration / p_action.calls) + "s (per call) | ";
 	result += std::to_string(p_action.percentage) + "%% | ";
@@ -48,6 +48,7 @@ OvEditor::Panels::ProjectSettings::ProjectSettings(const std::string & p_title,
 		columns.widths[0] = 125;
 
 		GUIDrawer::DrawScalar<float>(columns, "Gravity", GenerateGatherer<float>("gravity"), GenerateProvider<float>("gravity"), 0.1f, GUIDrawer::_MIN_FLOAT, GUIDrawer::_MAX_FLOAT);
+		GUIDrawer::DrawScalar<int>(columns, "Fixed rate (Hz)", GenerateGatherer<int>("physics_fixed_rate"), GenerateProvider<int>("physics_fixed_rate"), 1, 1, 1000);
 	}
 
 	{
@@ -92,4 +93,15 @@ OvEditor::Panels::ProjectSettings::ProjectSettings(const std::string & p_title,
 
 		GUIDrawer::DrawDDString(columns, "Start scene", GenerateGatherer<std::string>("start_scene"), GenerateProvider<std::string>("start_scene"), "File");
 	}
+
+	{
+		/* Resources settings (Memory budgets in MB, 0 disables the eviction of unused resources) */
+		auto& resourcesRoot = CreateWidget<Layout::GroupCollapsable>("Resources");
+		auto& columns = resourcesRoot.CreateWidget<Layout::Columns<2>>();
+		columns.widths[0] = 125;
+
+		GUIDrawer::DrawScalar<int>(columns, "Models budget (MB)", GenerateGatherer<int>("model_memory_budget"), GenerateProvider<int>("model_memory_budget"), 1, 0, 65536);
+		GUIDrawer::DrawScalar<int>(columns, "Textures budget (MB)", GenerateGatherer<int>("texture_memory_budget"), GenerateProvider<int>("texture_memory_budget"), 1, 0, 65536);
+		GUIDrawer::DrawScalar<int>(columns, "Materials budget (MB)", GenerateGatherer<int>("material_memory_budget"), GenerateProvider<int>("material_memory_budget"), 1, 0, 65536);
+	}
 }
@@ -157,7 +157,7 @@ void OvEditor::Panels::SceneView::RenderSceneForActorPicking()
 	m_actorPickingFramebuffer.Bind();
 	baseRenderer.SetClearColor(1.0f, 1.0f, 1.0f);
 	baseRenderer.Clear();
-	m_editorRenderer.RenderSceneForActorPicking();
+	m_editorRenderer.RenderSceneForActorPicking(m_camera.GetFrustum());
 
 	if (EDITOR_EXEC(IsAnyActorSelected()))
 	{
@@ -67,13 +67,14 @@ namespace OvGame::Core
 		std::unique_ptr<OvRendering::Buffers::UniformBuffer>		engineUBO;
 		std::unique_ptr<OvRendering::Buffers::ShaderStorageBuffer>	lightSSBO;
 
-		OvCore::SceneSystem::SceneManager sceneManager;
-
+		/* Declared before the scene manager: the components of the scene release their resource references when it is destroyed */
 		OvCore::ResourceManagement::ModelManager	modelManager;
 		OvCore::ResourceManagement::TextureManager	textureManager;
 		OvCore::ResourceManagement::ShaderManager	shaderManager;
 		OvCore::ResourceManagement::MaterialManager	materialManager;
 		OvCore::ResourceManagement::SoundManager	soundManager;
+
+		OvCore::SceneSystem::SceneManager sceneManager;
 		
 		OvTools::Filesystem::IniFile projectSettings;
 	};
@@ -13,6 +13,7 @@
 #include "OvGame/Core/GameRenderer.h"
 
 #include "OvGame/Utils/FPSCounter.h"
+#include "OvGame/Utils/LoadingScreen.h"
 
 #ifdef _DEBUG
 #include "OvGame/Debug/DriverInfo.h"
@@ -63,6 +64,8 @@ namespace OvGame::Core
 
 		OvGame::Core::GameRenderer m_gameRenderer;
 
+		OvGame::Utils::LoadingScreen m_loadingScreen;
+
 		/* Debug elements */
 		OvGame::Utils::FPSCounter	m_fpsCounter;
 
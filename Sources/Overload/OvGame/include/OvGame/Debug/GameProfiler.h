@@ -12,6 +12,7 @@
 #include <OvWindowing/Window.h>
 
 #include <OvAnalytics/Profiling/Profiler.h>
+#include <OvCore/ResourceManagement/AResourceManager.h>
 #include <OvUI/Panels/PanelUndecorated.h>
 #include <OvUI/Widgets/Texts/TextColored.h>
 #include <OvUI/Widgets/Layout/Group.h>
@@ -42,6 +43,7 @@ namespace OvGame::Debug
 	private:
 		OvUI::Types::Color CalculateActionColor(double p_percentage) const;
 		std::string GenerateActionString(OvAnalytics::Profiling::ProfilerReport::Action& p_action);
+		std::string GenerateResourceString(const std::string& p_name, const OvCore::ResourceManagement::ResourceStatistics& p_statistics);
 
 	private:
 
@@ -0,0 +1,39 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <OvUI/Panels/PanelUndecorated.h>
+#include <OvUI/Widgets/Texts/TextColored.h>
+
+#include <OvWindowing/Window.h>
+
+namespace OvGame::Utils
+{
+	/**
+	* Panel that display the progress of a scene loading
+	*/
+	class LoadingScreen : public OvUI::Panels::PanelUndecorated
+	{
+	public:
+		/**
+		* Constructor
+		* @param p_window
+		*/
+		LoadingScreen(OvWindowing::Window& p_window);
+
+		/**
+		* Update the data
+		* @param p_progress (Between 0 and 1)
+		*/
+		void Update(float p_progress);
+
+	private:
+		OvUI::Widgets::Texts::TextColored m_text;
+
+		OvWindowing::Window& m_window;
+	};
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 */
 
 #include <filesystem>
+#include <algorithm>
 
 #include "OvGame/Core/Context.h"
 
@@ -70,7 +71,10 @@ OvGame::Core::Context::Context() :
 	audioPlayer = std::make_unique<OvAudio::Core::AudioPlayer>(*audioEngine);
 
 	/* Physics engine */
-	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(OvPhysics::Settings::PhysicsSettings{ {0.0f, projectSettings.Get<float>("gravity"), 0.0f } });
+	OvPhysics::Settings::PhysicsSettings physicsSettings;
+	physicsSettings.gravity = { 0.0f, projectSettings.Get<float>("gravity"), 0.0f };
+	physicsSettings.fixedTimeStep = 1.0f / std::max(projectSettings.GetOrDefault<int>("physics_fixed_rate", 60), 1);
+	physicsEngine = std::make_unique<OvPhysics::Core::PhysicsEngine>(physicsSettings);
 
 	/* Service Locator providing */
 	ServiceLocator::Provide<OvPhysics::Core::PhysicsEngine>(*physicsEngine);
@@ -85,6 +89,11 @@ OvGame::Core::Context::Context() :
 	ServiceLocator::Provide<OvAudio::Core::AudioEngine>(*audioEngine);
 	ServiceLocator::Provide<OvAudio::Core::AudioPlayer>(*audioPlayer);
 
+	/* Budgets are given in megabytes, 0 keeps every resource loaded */
+	modelManager.SetMemoryBudget(static_cast<size_t>(std::max(projectSettings.GetOrDefault<int>("model_memory_budget", 0), 0)) * 1024 * 1024);
+	textureManager.SetMemoryBudget(static_cast<size_t>(std::max(projectSettings.GetOrDefault<int>("texture_memory_budget", 0), 0)) * 1024 * 1024);
+	materialManager.SetMemoryBudget(static_cast<size_t>(std::max(projectSettings.GetOrDefault<int>("material_memory_budget", 0), 0)) * 1024 * 1024);
+
 	/* Scripting */
 	scriptInterpreter = std::make_unique<OvCore::Scripting::ScriptInterpreter>(projectScriptsPath);
 
@@ -98,7 +107,8 @@ OvGame::Core::Context::Context() :
 		sizeof(float) +
 		sizeof(OvMaths::FMatrix4),
 		0, 0,
-		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW
+		OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW,
+		OvRendering::Buffers::EUniformBufferMode::PERSISTENT_RING
 	);
 
 	lightSSBO = std::make_unique<OvRendering::Buffers::ShaderStorageBuffer>(OvRendering::Buffers::EAccessSpecifier::STREAM_DRAW);
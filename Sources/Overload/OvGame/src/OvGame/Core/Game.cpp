@@ -8,12 +8,14 @@
 
 #include <OvDebug/Logger.h>
 #include <OvUI/Widgets/Texts/Text.h>
+#include <OvCore/ResourceManagement/ResourceLoader.h>
 
 #include <OvAnalytics/Profiling/ProfilerSpy.h>
 
 OvGame::Core::Game::Game(Context & p_context) :
 	m_context(p_context),
 	m_gameRenderer(p_context),
+	m_loadingScreen(*p_context.window),
 	m_fpsCounter(*p_context.window)
 	#ifdef _DEBUG
 	,
@@ -23,6 +25,7 @@ OvGame::Core::Game::Game(Context & p_context) :
 	#endif
 {
 	m_context.uiManager->SetCanvas(m_canvas);
+	m_canvas.AddPanel(m_loadingScreen);
 	m_canvas.AddPanel(m_fpsCounter);
 	#ifdef _DEBUG
 	m_canvas.AddPanel(m_driverInfo);
@@ -41,9 +44,7 @@ OvGame::Core::Game::~Game()
 
 void OvGame::Core::Game::PreUpdate()
 {
-	#ifdef _DEBUG
 	PROFILER_SPY("Pre-Update");
-	#endif
 	m_context.device->PollEvents();
 }
 
@@ -58,37 +59,37 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 	if (auto currentScene = m_context.sceneManager.GetCurrentScene())
 	{
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Physics Update");
-			#endif
 
-			if (m_context.physicsEngine->Update(p_deltaTime))
-				currentScene->FixedUpdate(p_deltaTime);
+			m_context.physicsEngine->Update(p_deltaTime, [currentScene](float p_fixedDeltaTime)
+			{
+				currentScene->FixedUpdate(p_fixedDeltaTime);
+			});
 		}
 
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Scene Update");
-			#endif
 			currentScene->Update(p_deltaTime);
 			currentScene->LateUpdate(p_deltaTime);
 		}
 
 		{
-			#ifdef _DEBUG
+			PROFILER_SPY("Transform Resolve");
+			currentScene->ResolveTransforms();
+		}
+
+		{
 			PROFILER_SPY("Audio Update");
-			#endif
 			m_context.audioEngine->Update();
 		}
 
 		{
-			#ifdef _DEBUG
 			PROFILER_SPY("Render Scene");
-			#endif
 			m_gameRenderer.RenderScene();
 		}
 	}
 
+	OvCore::ResourceManagement::ResourceLoader::ProcessUploads();
 	m_context.sceneManager.Update();
 
 	if  (m_context.inputManager->IsKeyPressed(OvWindowing::Inputs::EKey::KEY_F12))
@@ -99,6 +100,18 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 		OvRendering::Resources::Loaders::ShaderLoader::Recompile(*m_context.shaderManager[":Shaders\\Standard.glsl"], "Data\\Engine\\Shaders\\Standard.glsl");
 	#endif
 
+	m_loadingScreen.enabled = m_context.sceneManager.IsLoadingScene();
+
+	if (m_loadingScreen.enabled)
+		m_loadingScreen.Update(m_context.sceneManager.GetSceneLoadingProgress());
+
+	m_fpsCounter.enabled = m_showDebugInformation;
+	#ifdef _DEBUG
+	m_driverInfo.enabled = m_showDebugInformation;
+	m_gameProfiler.enabled = m_showDebugInformation;
+	m_frameInfo.enabled = m_showDebugInformation;
+	#endif
+
 	if (m_showDebugInformation)
 	{
 		m_fpsCounter.Update(p_deltaTime);
@@ -106,15 +119,16 @@ void OvGame::Core::Game::Update(float p_deltaTime)
 		m_gameProfiler.Update(p_deltaTime);
 		m_frameInfo.Update(p_deltaTime);
 		#endif
-		m_context.uiManager->Render();
 	}
+
+	if (m_showDebugInformation || m_loadingScreen.enabled)
+		m_context.uiManager->Render();
 }
 
 void OvGame::Core::Game::PostUpdate()
 {
-	#ifdef _DEBUG
 	PROFILER_SPY("Post-Update");
-	#endif
 	m_context.window->SwapBuffers();
+	m_context.engineUBO->NextFrame();
 	m_context.inputManager->ClearEvents();
 }
\ No newline at end of file
@@ -20,6 +20,8 @@ OvGame::Debug::FrameInfo::FrameInfo(OvRendering::Core::Renderer& p_renderer, OvW
 	m_frameInfo[0] = &CreateWidget<OvUI::Widgets::Texts::TextColored>("", OvUI::Types::Color::Yellow);
 	m_frameInfo[1] = &CreateWidget<OvUI::Widgets::Texts::TextColored>("", OvUI::Types::Color::Yellow);
 	m_frameInfo[2] = &CreateWidget<OvUI::Widgets::Texts::TextColored>("", OvUI::Types::Color::Yellow);
+	m_frameInfo[3] = &CreateWidget<OvUI::Widgets::Texts::TextColored>("", OvUI::Types::Color::Yellow);
+	m_frameInfo[4] = &CreateWidget<OvUI::Widgets::Texts::TextColored>("", OvUI::Types::Color::Yellow);
 }
 
 void OvGame::Debug::FrameInfo::Update(float p_deltaTime)
@@ -29,6 +31,8 @@ void OvGame::Debug::FrameInfo::Update(float p_deltaTime)
 	m_frameInfo[0]->content = "Triangles: " + std::to_string(frameInfo.polyCount);
 	m_frameInfo[1]->content = "Batches: " + std::to_string(frameInfo.batchCount);
 	m_frameInfo[2]->content = "Instances: " + std::to_string(frameInfo.instanceCount);
+	m_frameInfo[3]->content = "Program binds: " + std::to_string(frameInfo.programBinds);
+	m_frameInfo[4]->content = "Material binds: " + std::to_string(frameInfo.materialBinds);
 
 	SetPosition({ 10.0f , static_cast<float>(m_window.GetSize().second) - 10.f });
 	SetAlignment(OvUI::Settings::EHorizontalAlignment::LEFT, OvUI::Settings::EVerticalAlignment::BOTTOM);
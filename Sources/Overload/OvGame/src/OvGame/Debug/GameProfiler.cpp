@@ -11,6 +11,12 @@
 #include <OvDebug/Logger.h>
 #include <OvUI/Widgets/Visual/Separator.h>
 #include <OvAnalytics/Profiling/ProfilerSpy.h>
+#include <OvCore/Global/ServiceLocator.h>
+#include <OvCore/ResourceManagement/ModelManager.h>
+#include <OvCore/ResourceManagement/TextureManager.h>
+#include <OvCore/ResourceManagement/ShaderManager.h>
+#include <OvCore/ResourceManagement/MaterialManager.h>
+#include <OvCore/ResourceManagement/SoundManager.h>
 
 using namespace OvUI::Panels;
 using namespace OvUI::Widgets;
@@ -66,6 +72,13 @@ void OvGame::Debug::GameProfiler::Update(float p_deltaTime)
 				auto color = CalculateActionColor(action.percentage);
 				m_actionList->CreateWidget<Texts::TextColored>(GenerateActionString(action), color);
 			}
+
+			m_actionList->CreateWidget<Texts::Text>("Resources | Loaded | Memory | Budget | Hits | Misses | Evictions");
+			m_actionList->CreateWidget<Texts::Text>(GenerateResourceString("Models", OVSERVICE(OvCore::ResourceManagement::ModelManager).GetStatistics()));
+			m_actionList->CreateWidget<Texts::Text>(GenerateResourceString("Textures", OVSERVICE(OvCore::ResourceManagement::TextureManager).GetStatistics()));
+			m_actionList->CreateWidget<Texts::Text>(GenerateResourceString("Shaders", OVSERVICE(OvCore::ResourceManagement::ShaderManager).GetStatistics()));
+			m_actionList->CreateWidget<Texts::Text>(GenerateResourceString("Materials", OVSERVICE(OvCore::ResourceManagement::MaterialManager).GetStatistics()));
+			m_actionList->CreateWidget<Texts::Text>(GenerateResourceString("Sounds", OVSERVICE(OvCore::ResourceManagement::SoundManager).GetStatistics()));
 		
 			m_timer -= m_frequency;
 		}
@@ -84,7 +97,7 @@ std::string OvGame::Debug::GameProfiler::GenerateActionString(OvAnalytics::Profi
 {
 	std::string result;
 
-	result += "[" + p_action.name + "]";
+	result += "[" + (p_action.parent.empty() ? p_action.name : p_action.parent + " > " + p_action.name) + "]";
 	result += std::to_string(p_action.duration) + "s (total) | ";
 	result += std::to_string(p_action.duration / p_action.calls) + "s (per call) | ";
 	result += std::to_string(p_action.percentage) + "%% | ";
@@ -93,4 +106,19 @@ std::string OvGame::Debug::GameProfiler::GenerateActionString(OvAnalytics::Profi
 	return result;
 }
 
+std::string OvGame::Debug::GameProfiler::GenerateResourceString(const std::string& p_name, const OvCore::ResourceManagement::ResourceStatistics& p_statistics)
+{
+	std::string result;
+
+	result += "[" + p_name + "]";
+	result += std::to_string(p_statistics.resourceCount) + " loaded | ";
+	result += std::to_string(p_statistics.memoryUsage / 1024) + " KB | ";
+	result += (p_statistics.memoryBudget ? std::to_string(p_statistics.memoryBudget / 1024) + " KB" : std::string("No budget")) + " | ";
+	result += std::to_string(p_statistics.hits) + " hits | ";
+	result += std::to_string(p_statistics.misses) + " misses | ";
+	result += std::to_string(p_statistics.evictions) + " evictions";
+
+	return result;
+}
+
 #endif
\ No newline at end of file
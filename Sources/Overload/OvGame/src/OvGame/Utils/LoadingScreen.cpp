@@ -0,0 +1,25 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvGame/Utils/LoadingScreen.h"
+
+OvGame::Utils::LoadingScreen::LoadingScreen(OvWindowing::Window& p_window) : m_window(p_window)
+{
+	m_text.color = OvUI::Types::Color::White;
+	m_defaultHorizontalAlignment = OvUI::Settings::EHorizontalAlignment::CENTER;
+	m_defaultVerticalAlignment = OvUI::Settings::EVerticalAlignment::MIDDLE;
+	m_defaultPosition = { static_cast<float>(m_window.GetSize().first) / 2.0f, static_cast<float>(m_window.GetSize().second) / 2.0f };
+	m_text.content = "Loading... 0%";
+	ConsiderWidget(m_text, false);
+	enabled = false;
+}
+
+void OvGame::Utils::LoadingScreen::Update(float p_progress)
+{
+	m_text.content = "Loading... " + std::to_string(static_cast<int>(p_progress * 100.0f)) + "%";
+	SetPosition({ static_cast<float>(m_window.GetSize().first) / 2.0f, static_cast<float>(m_window.GetSize().second) / 2.0f });
+	SetAlignment(OvUI::Settings::EHorizontalAlignment::CENTER, OvUI::Settings::EVerticalAlignment::MIDDLE);
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "OvMaths/Internal/TransformNotifier.h"
 #include "OvMaths/FQuaternion.h"
 #include "OvMaths/FMatrix4.h"
@@ -14,7 +16,10 @@
 namespace OvMaths
 {
 	/**
-	* Mathematic representation of a 3D transformation with float precision
+	* Mathematic representation of a 3D transformation with float precision.
+	* The world matrix is computed lazily: modifying a transform only flags it (And its children) as dirty,
+	* the world matrix is recomputed the next time it is read, and decomposed only when the world
+	* position, rotation or scale is requested
 	*/
 	class FTransform
 	{
@@ -73,15 +78,27 @@ namespace OvMaths
 		void GenerateMatricesLocal(FVector3 p_position, FQuaternion p_rotation, FVector3 p_scale);
 
 		/**
-		* Re-update world matrix to use parent transformations
+		* Recompute the world matrix if it is out of date (Dirty parents are resolved first).
+		* Calling it on every transform once per frame resolves the whole hierarchy in a single pass
 		*/
-		void UpdateWorldMatrix();
+		void UpdateWorldMatrix() const;
 
 		/**
 		* Re-update local matrix to use parent transformations
 		*/
 		void UpdateLocalMatrix();
 
+		/**
+		* Returns true if the world matrix needs to be recomputed
+		*/
+		bool IsWorldMatrixDirty() const;
+
+		/**
+		* Returns a counter incremented every time the world matrix is recomputed.
+		* Comparing it with a previously read value tells if the transform moved in the meantime
+		*/
+		uint64_t GetWorldGeneration() const;
+
 		/**
 		* Set the position of the transform in the local space
 		* @param p_newPosition
@@ -211,20 +228,26 @@ namespace OvMaths
 		Internal::TransformNotifier::NotificationHandlerID m_notificationHandlerID;
 
 	private:
-		void PreDecomposeWorldMatrix();
+		void InvalidateWorldMatrix();
+		void PreDecomposeWorldMatrix() const;
 		void PreDecomposeLocalMatrix();
 
 		/* Pre-decomposed data to prevent multiple decomposition */
 		FVector3 m_localPosition;
 		FQuaternion m_localRotation;
 		FVector3 m_localScale;
-		FVector3 m_worldPosition;
-		FQuaternion m_worldRotation;
-		FVector3 m_worldScale;
+		mutable FVector3 m_worldPosition;
+		mutable FQuaternion m_worldRotation;
+		mutable FVector3 m_worldScale;
 
 		FMatrix4 m_localMatrix;
-		FMatrix4 m_worldMatrix;
+		mutable FMatrix4 m_worldMatrix;
 
 		FTransform*	m_parent;
+
+		/* A dirty transform always has dirty children, so invalidating an already dirty transform is free */
+		mutable bool m_worldMatrixDirty;
+		mutable bool m_worldDecompositionDirty;
+		mutable uint64_t m_worldGeneration;
 	};
 }
\ No newline at end of file
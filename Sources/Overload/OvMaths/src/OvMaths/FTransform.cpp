@@ -8,7 +8,10 @@
 
 OvMaths::FTransform::FTransform(FVector3 p_localPosition, FQuaternion p_localRotation, FVector3 p_localScale) :
 	m_notificationHandlerID(-1),
-	m_parent(nullptr)
+	m_parent(nullptr),
+	m_worldMatrixDirty(true),
+	m_worldDecompositionDirty(true),
+	m_worldGeneration(0)
 {
 	GenerateMatricesLocal(p_localPosition, p_localRotation, p_localScale);
 }
@@ -23,17 +26,21 @@ void OvMaths::FTransform::NotificationHandler(Internal::TransformNotifier::ENoti
 	switch (p_notification)
 	{
 	case Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED:
-		UpdateWorldMatrix();
+		InvalidateWorldMatrix();
 		break;
 
 	case Internal::TransformNotifier::ENotification::TRANSFORM_DESTROYED:
-		/* 
-		* RemoveParent() is not called here because it is unsafe to remove a notification handler
-		* while the parent is iterating on his notification handlers (Segfault otherwise)
-		*/
-		GenerateMatricesLocal(m_worldPosition, m_worldRotation, m_worldScale);
-		m_parent = nullptr;
-		UpdateWorldMatrix();
+		{
+			/* 
+			* RemoveParent() is not called here because it is unsafe to remove a notification handler
+			* while the parent is iterating on his notification handlers (Segfault otherwise)
+			*/
+			const FVector3 worldPosition = GetWorldPosition();
+			const FQuaternion worldRotation = GetWorldRotation();
+			const FVector3 worldScale = GetWorldScale();
+			m_parent = nullptr;
+			GenerateMatricesLocal(worldPosition, worldRotation, worldScale);
+		}
 		break;
 	}
 }
@@ -44,7 +51,7 @@ void OvMaths::FTransform::SetParent(FTransform& p_parent)
 
 	m_notificationHandlerID = m_parent->Notifier.AddNotificationHandler(std::bind(&FTransform::NotificationHandler, this, std::placeholders::_1));
 
-	UpdateWorldMatrix();
+	InvalidateWorldMatrix();
 }
 
 bool OvMaths::FTransform::RemoveParent()
@@ -53,7 +60,7 @@ bool OvMaths::FTransform::RemoveParent()
 	{
 		m_parent->Notifier.RemoveNotificationHandler(m_notificationHandlerID);
 		m_parent = nullptr;
-		UpdateWorldMatrix();
+		InvalidateWorldMatrix();
 
 		return true;
 	}
@@ -73,7 +80,7 @@ void OvMaths::FTransform::GenerateMatricesLocal(FVector3 p_position, FQuaternion
 	m_localRotation = p_rotation;
 	m_localScale = p_scale;
 
-	UpdateWorldMatrix();
+	InvalidateWorldMatrix();
 }
 
 void OvMaths::FTransform::GenerateMatricesWorld(FVector3 p_position, FQuaternion p_rotation, FVector3 p_scale)
@@ -82,26 +89,43 @@ void OvMaths::FTransform::GenerateMatricesWorld(FVector3 p_position, FQuaternion
 	m_worldPosition = p_position;
 	m_worldRotation = p_rotation;
 	m_worldScale = p_scale;
+	m_worldMatrixDirty = false;
+	m_worldDecompositionDirty = false;
+	++m_worldGeneration;
 
 	UpdateLocalMatrix();
 }
 
-void OvMaths::FTransform::UpdateWorldMatrix()
+void OvMaths::FTransform::UpdateWorldMatrix() const
 {
-	m_worldMatrix = HasParent() ? m_parent->m_worldMatrix * m_localMatrix : m_localMatrix;
-	PreDecomposeWorldMatrix();
+	if (!m_worldMatrixDirty)
+		return;
 
-	Notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
+	m_worldMatrix = HasParent() ? m_parent->GetWorldMatrix() * m_localMatrix : m_localMatrix;
+	m_worldMatrixDirty = false;
+	++m_worldGeneration;
 }
 
 void OvMaths::FTransform::UpdateLocalMatrix()
 {
-	m_localMatrix = HasParent() ? FMatrix4::Inverse(m_parent->m_worldMatrix) * m_worldMatrix : m_worldMatrix;
+	m_localMatrix = HasParent() ? FMatrix4::Inverse(m_parent->GetWorldMatrix()) * GetWorldMatrix() : GetWorldMatrix();
 	PreDecomposeLocalMatrix();
 
+	/* The world matrix of this transform is already up to date, only the children have to be invalidated */
 	Notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
 }
 
+bool OvMaths::FTransform::IsWorldMatrixDirty() const
+{
+	return m_worldMatrixDirty;
+}
+
+uint64_t OvMaths::FTransform::GetWorldGeneration() const
+{
+	UpdateWorldMatrix();
+	return m_worldGeneration;
+}
+
 void OvMaths::FTransform::SetLocalPosition(FVector3 p_newPosition)
 {
 	GenerateMatricesLocal(p_newPosition, m_localRotation, m_localScale);
@@ -119,17 +143,17 @@ void OvMaths::FTransform::SetLocalScale(FVector3 p_newScale)
 
 void OvMaths::FTransform::SetWorldPosition(FVector3 p_newPosition)
 {
-	GenerateMatricesWorld(p_newPosition, m_worldRotation, m_worldScale);
+	GenerateMatricesWorld(p_newPosition, GetWorldRotation(), GetWorldScale());
 }
 
 void OvMaths::FTransform::SetWorldRotation(FQuaternion p_newRotation)
 {
-	GenerateMatricesWorld(m_worldPosition, p_newRotation, m_worldScale);
+	GenerateMatricesWorld(GetWorldPosition(), p_newRotation, GetWorldScale());
 }
 
 void OvMaths::FTransform::SetWorldScale(FVector3 p_newScale)
 {
-	GenerateMatricesWorld(m_worldPosition, m_worldRotation, p_newScale);
+	GenerateMatricesWorld(GetWorldPosition(), GetWorldRotation(), p_newScale);
 }
 
 void OvMaths::FTransform::TranslateLocal(const FVector3& p_translation)
@@ -169,16 +193,19 @@ const OvMaths::FVector3& OvMaths::FTransform::GetLocalScale() const
 
 const OvMaths::FVector3& OvMaths::FTransform::GetWorldPosition() const
 {
+	PreDecomposeWorldMatrix();
 	return m_worldPosition;
 }
 
 const OvMaths::FQuaternion& OvMaths::FTransform::GetWorldRotation() const
 {
+	PreDecomposeWorldMatrix();
 	return m_worldRotation;
 }
 
 const OvMaths::FVector3& OvMaths::FTransform::GetWorldScale() const
 {
+	PreDecomposeWorldMatrix();
 	return m_worldScale;
 }
 
@@ -189,22 +216,23 @@ const OvMaths::FMatrix4& OvMaths::FTransform::GetLocalMatrix() const
 
 const OvMaths::FMatrix4& OvMaths::FTransform::GetWorldMatrix() const
 {
+	UpdateWorldMatrix();
 	return m_worldMatrix;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetWorldForward() const
 {
-	return m_worldRotation * FVector3::Forward;
+	return GetWorldRotation() * FVector3::Forward;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetWorldUp() const
 {
-	return m_worldRotation * FVector3::Up;
+	return GetWorldRotation() * FVector3::Up;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetWorldRight() const
 {
-	return m_worldRotation * FVector3::Right;
+	return GetWorldRotation() * FVector3::Right;
 }
 
 OvMaths::FVector3 OvMaths::FTransform::GetLocalForward() const
@@ -222,8 +250,26 @@ OvMaths::FVector3 OvMaths::FTransform::GetLocalRight() const
 	return m_localRotation * FVector3::Right;
 }
 
-void OvMaths::FTransform::PreDecomposeWorldMatrix()
+void OvMaths::FTransform::InvalidateWorldMatrix()
 {
+	if (m_worldMatrixDirty)
+		return;
+
+	m_worldMatrixDirty = true;
+	m_worldDecompositionDirty = true;
+
+	Notifier.NotifyChildren(Internal::TransformNotifier::ENotification::TRANSFORM_CHANGED);
+}
+
+void OvMaths::FTransform::PreDecomposeWorldMatrix() const
+{
+	UpdateWorldMatrix();
+
+	if (!m_worldDecompositionDirty)
+		return;
+
+	m_worldDecompositionDirty = false;
+
 	m_worldPosition.x = m_worldMatrix(0, 3);
 	m_worldPosition.y = m_worldMatrix(1, 3);
 	m_worldPosition.z = m_worldMatrix(2, 3);
@@ -9,6 +9,7 @@
 #include <vector>
 #include <map>
 #include <optional>
+#include <functional>
 
 #include "OvPhysics/Entities/PhysicalObject.h"
 #include "OvPhysics/Settings/PhysicsSettings.h"
@@ -30,13 +31,28 @@ namespace OvPhysics::Core
 		PhysicsEngine(const Settings::PhysicsSettings& p_settings);
 
 		/**
-		* Simulate the physics. This method call is decomposed in 3 things:
-		* - Pre-Update (Apply FTransforms to btTransforms, called every Update call)
-		* - Simulation (Simulate the physics, called 60 times per seconds)
-		* - Post-Update (Apply the simulation results, btTransforms, to FTransforms)
-		* This methods returns true if the call invoked a physics simulation
+		* Simulate the physics for the given time, in ticks of the fixed time step. Each tick is decomposed in 3 things:
+		* - Pre-Tick (Apply the FTransforms moved since the last tick to the btTransforms, waking up the bodies around them)
+		* - Simulation (A single simulation step, of the fixed time step)
+		* - Post-Tick (Apply the simulation results of the active bodies, btTransforms, to FTransforms, then call p_fixedUpdate)
+		* The time left is kept for the next call, and the FTransforms are interpolated between the last two ticks with it.
+		* The ticks of a call are limited to the max sub steps, the time beyond is dropped.
+		* This methods returns the number of ticks simulated
+		* @param p_deltaTime
+		* @param p_fixedUpdate (Called after every tick with the fixed time step)
 		*/
-		bool Update(float p_deltaTime);
+		uint32_t Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate = {});
+
+		/**
+		* Defines the duration of a simulation tick
+		* @param p_fixedTimeStep
+		*/
+		void SetFixedTimeStep(float p_fixedTimeStep);
+
+		/**
+		* Returns the duration of a simulation tick
+		*/
+		float GetFixedTimeStep() const;
 
 		/* Casts a ray against all Physical Object in the Scene and returns information on what was hit
 		 * @param p_origin
@@ -56,8 +72,12 @@ namespace OvPhysics::Core
 		OvMaths::FVector3 GetGravity() const;
 
 	private:
-		void PreUpdate();
-		void PostUpdate();
+		void PreTick();
+		void PostTick();
+		void Interpolate(float p_alpha);
+		void WakeUpBodiesAround(const btRigidBody& p_body, const btTransform& p_previousTransform);
+
+		static void InternalTickCallback(btDynamicsWorld* p_world, btScalar p_timeStep);
 
 		void ListenToPhysicalObjects();
 
@@ -81,6 +101,11 @@ namespace OvPhysics::Core
 		std::unique_ptr<btBroadphaseInterface>		m_broadphase;
 		std::unique_ptr<btConstraintSolver>			m_solver;
 
+		/* Fixed time step */
+		float		m_fixedTimeStep;
+		uint32_t	m_maxSubSteps;
+		float		m_accumulator = 0.0f;
+
 		static std::map< std::pair<Entities::PhysicalObject*, Entities::PhysicalObject*>, bool> m_collisionEvents;
 		std::vector<std::reference_wrapper<Entities::PhysicalObject>>							m_physicalObjects;
 	};
@@ -262,8 +262,13 @@ namespace OvPhysics::Entities
 
 		/* Needed by the physics engine */
 		btRigidBody&			GetBody();
-		void					UpdateBtTransform();
+		bool					UpdateBtTransform();
 		void					UpdateFTransform();
+		bool					IsSleeping() const;
+		void					SavePreviousTickTransform();
+		void					UpdateInterpolatedFTransform(float p_alpha);
+		bool					IsFTransformSynced() const;
+		void					SetSyncedFTransform(const btTransform& p_transform);
 
 	public:
 		OvTools::Eventing::Event<PhysicalObject&>			CollisionStartEvent;
@@ -295,6 +300,12 @@ namespace OvPhysics::Entities
 		static OvTools::Eventing::Event<btRigidBody&>		ConsiderEvent;
 		static OvTools::Eventing::Event<btRigidBody&>		UnconsiderEvent;
 
+		/* Fixed time step (World generation of the FTransform when last synced with the body, and pose of the body before the last tick) */
+		uint64_t				m_syncedGeneration = 0;
+		bool					m_hasSyncedFTransform = false;
+		bool					m_interpolated = false;
+		btTransform				m_previousTickTransform = btTransform::getIdentity();
+
 		/* Bullet relatives */
 		std::unique_ptr<btMotionState>		m_motion;
 		std::unique_ptr<btRigidBody>		m_body;
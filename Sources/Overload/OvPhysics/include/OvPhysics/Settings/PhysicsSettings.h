@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include <OvMaths/FVector3.h>
 
 namespace OvPhysics::Settings
@@ -16,5 +18,7 @@ namespace OvPhysics::Settings
 	struct PhysicsSettings
 	{
 		OvMaths::FVector3 gravity = { 0.0f, -9.81f, 0.f };
+		float fixedTimeStep = 1.0f / 60.0f;
+		uint32_t maxSubSteps = 10;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 */
 
 #include <algorithm>
+#include <cmath>
 
 #include "OvPhysics/Core/PhysicsEngine.h"
 #include "OvPhysics/Tools/Conversion.h"
@@ -17,7 +18,22 @@ using namespace OvPhysics::Entities;
 
 std::map< std::pair<PhysicalObject*, PhysicalObject*>, bool> OvPhysics::Core::PhysicsEngine::m_collisionEvents;
 
-OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings)
+namespace
+{
+	/* Activate the dynamic bodies overlapping an AABB (Static and kinematic bodies never wake up) */
+	struct WakeUpCallback : public btBroadphaseAabbCallback
+	{
+		bool process(const btBroadphaseProxy* p_proxy) override
+		{
+			static_cast<const btCollisionObject*>(p_proxy->m_clientObject)->activate();
+			return true;
+		}
+	};
+}
+
+OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings & p_settings) :
+	m_fixedTimeStep(p_settings.fixedTimeStep),
+	m_maxSubSteps(p_settings.maxSubSteps)
 {
 	m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
 	m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfig.get());
@@ -26,36 +42,96 @@ OvPhysics::Core::PhysicsEngine::PhysicsEngine(const Settings::PhysicsSettings &
 	m_world = std::make_unique<btDiscreteDynamicsWorld>(m_dispatcher.get(), m_broadphase.get(), m_solver.get(), m_collisionConfig.get());
 
 	m_world->setGravity(Conversion::ToBtVector3(p_settings.gravity));
+	m_world->setInternalTickCallback(&PhysicsEngine::InternalTickCallback, this);
 
 	ListenToPhysicalObjects();
 	SetCollisionCallback();
 }
 
-void OvPhysics::Core::PhysicsEngine::PreUpdate()
+void OvPhysics::Core::PhysicsEngine::PreTick()
 {
-	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateBtTransform));
+	for (auto& physicalObject : m_physicalObjects)
+	{
+		const btTransform previousTransform = physicalObject.get().GetBody().getWorldTransform();
+
+		/* Sleeping bodies don't notice a moved neighbour by themselves */
+		if (physicalObject.get().UpdateBtTransform())
+			WakeUpBodiesAround(physicalObject.get().GetBody(), previousTransform);
+	}
+
+	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::SavePreviousTickTransform));
 
 	ResetCollisionEvents();
 }
 
-void OvPhysics::Core::PhysicsEngine::PostUpdate()
+void OvPhysics::Core::PhysicsEngine::PostTick()
 {
 	std::for_each(m_physicalObjects.begin(), m_physicalObjects.end(), std::mem_fn(&PhysicalObject::UpdateFTransform));
 
 	CheckCollisionStopEvents();
 }
 
-bool OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime)
+void OvPhysics::Core::PhysicsEngine::Interpolate(float p_alpha)
+{
+	for (auto& physicalObject : m_physicalObjects)
+		physicalObject.get().UpdateInterpolatedFTransform(p_alpha);
+}
+
+void OvPhysics::Core::PhysicsEngine::WakeUpBodiesAround(const btRigidBody& p_body, const btTransform& p_previousTransform)
+{
+	WakeUpCallback callback;
+	btVector3 min;
+	btVector3 max;
+
+	p_body.getCollisionShape()->getAabb(p_previousTransform, min, max);
+	m_broadphase->aabbTest(min, max, callback);
+
+	p_body.getCollisionShape()->getAabb(p_body.getWorldTransform(), min, max);
+	m_broadphase->aabbTest(min, max, callback);
+}
+
+void OvPhysics::Core::PhysicsEngine::InternalTickCallback(btDynamicsWorld* p_world, btScalar)
 {
-	PreUpdate();
+	static_cast<PhysicsEngine*>(p_world->getWorldUserInfo())->PostTick();
+}
+
+uint32_t OvPhysics::Core::PhysicsEngine::Update(float p_deltaTime, const std::function<void(float)>& p_fixedUpdate)
+{
+	m_accumulator += p_deltaTime;
 
-	if (m_world->stepSimulation(p_deltaTime, 10))
+	uint32_t ticks = 0;
+
+	while (m_accumulator >= m_fixedTimeStep && ticks < m_maxSubSteps)
 	{
-		PostUpdate();
-		return true;
+		PreTick();
+
+		/* No sub step: Bullet simulates exactly one tick, and calls the internal tick callback (Post-Tick) at its end */
+		m_world->stepSimulation(m_fixedTimeStep, 0);
+
+		if (p_fixedUpdate)
+			p_fixedUpdate(m_fixedTimeStep);
+
+		m_accumulator -= m_fixedTimeStep;
+		++ticks;
 	}
 
-	return false;
+	/* Time that didn't fit in the max sub steps is dropped, so a slow frame doesn't make the next ones slower */
+	if (m_accumulator >= m_fixedTimeStep)
+		m_accumulator = std::fmod(m_accumulator, m_fixedTimeStep);
+
+	Interpolate(m_accumulator / m_fixedTimeStep);
+
+	return ticks;
+}
+
+void OvPhysics::Core::PhysicsEngine::SetFixedTimeStep(float p_fixedTimeStep)
+{
+	m_fixedTimeStep = std::max(p_fixedTimeStep, 0.0001f);
+}
+
+float OvPhysics::Core::PhysicsEngine::GetFixedTimeStep() const
+{
+	return m_fixedTimeStep;
 }
 
 std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVector3 p_origin, OvMaths::FVector3 p_direction, float p_distance)
@@ -93,6 +169,10 @@ std::optional<RaycastHit> OvPhysics::Core::PhysicsEngine::Raycast(OvMaths::FVect
 
 void OvPhysics::Core::PhysicsEngine::SetGravity(const OvMaths::FVector3 & p_gravity)
 {
+	/* Bullet only gives the new gravity to the active bodies */
+	for (auto& physicalObject : m_physicalObjects)
+		physicalObject.get().GetBody().activate();
+
 	m_world->setGravity(Conversion::ToBtVector3(p_gravity));
 }
 
@@ -165,7 +245,9 @@ void OvPhysics::Core::PhysicsEngine::CheckCollisionStopEvents()
 	for (auto it = m_collisionEvents.begin(); it != m_collisionEvents.end();)
 	{
 		auto objects = it->first;
-		if (!it->second)
+
+		/* Sleeping bodies aren't tested for collision anymore, their contacts are kept until one of them wakes up */
+		if (!it->second && !(objects.first->IsSleeping() && objects.second->IsSleeping()))
 		{
 			if (!objects.first->IsTrigger() && !objects.second->IsTrigger())
 			{
@@ -51,11 +51,13 @@ void OvPhysics::Entities::PhysicalObject::Init()
 
 void OvPhysics::Entities::PhysicalObject::AddForce(const OvMaths::FVector3& p_force)
 {
+	m_body->activate();
 	m_body->applyCentralForce(Conversion::ToBtVector3(p_force));
 }
 
 void OvPhysics::Entities::PhysicalObject::AddImpulse(const OvMaths::FVector3& p_impulse)
 {
+	m_body->activate();
 	m_body->applyCentralImpulse(Conversion::ToBtVector3(p_impulse));
 }
 
@@ -169,11 +171,13 @@ void OvPhysics::Entities::PhysicalObject::SetFriction(float p_friction)
 
 void OvPhysics::Entities::PhysicalObject::SetLinearVelocity(const OvMaths::FVector3 & p_linearVelocity)
 {
+	m_body->activate();
 	m_body->setLinearVelocity(Conversion::ToBtVector3(p_linearVelocity));
 }
 
 void OvPhysics::Entities::PhysicalObject::SetAngularVelocity(const OvMaths::FVector3 & p_angularVelocity)
 {
+	m_body->activate();
 	m_body->setAngularVelocity(Conversion::ToBtVector3(p_angularVelocity));
 }
 
@@ -231,28 +235,82 @@ bool OvPhysics::Entities::PhysicalObject::IsEnabled() const
 	return m_enabled;
 }
 
-void OvPhysics::Entities::PhysicalObject::UpdateBtTransform()
+bool OvPhysics::Entities::PhysicalObject::UpdateBtTransform()
 {
-	m_body->setWorldTransform(Conversion::ToBtTransform(*m_transform));
+	bool moved = false;
+
+	/* The body already holds its pose, it is only overwritten if something moved the FTransform */
+	if (!IsFTransformSynced())
+	{
+		m_body->setWorldTransform(Conversion::ToBtTransform(*m_transform));
+		m_syncedGeneration = m_transform->GetWorldGeneration();
+		m_hasSyncedFTransform = true;
+		m_interpolated = false;
+		moved = true;
+
+		if (!m_kinematic)
+			m_body->activate(true);
+	}
 
 	if (OvMaths::FVector3::Distance(m_transform->GetWorldScale(), m_previousScale) >= 0.01f)
 	{
 		m_previousScale = m_transform->GetWorldScale();
 		SetLocalScaling({ abs(m_previousScale.x), abs(m_previousScale.y), abs(m_previousScale.z) });
 		RecreateBody();
+		moved = true;
 	}
+
+	return moved;
 }
 
 void OvPhysics::Entities::PhysicalObject::UpdateFTransform()
 {
-	if (!m_kinematic)
+	/* Sleeping bodies don't move. The tick after a body moved still syncs it, to replace the interpolated pose */
+	if (!m_kinematic && (m_body->isActive() || m_interpolated))
+	{
+		SetSyncedFTransform(m_body->getWorldTransform());
+		m_interpolated = !(m_body->getWorldTransform() == m_previousTickTransform);
+	}
+}
+
+bool OvPhysics::Entities::PhysicalObject::IsSleeping() const
+{
+	return m_considered && !m_body->isActive();
+}
+
+void OvPhysics::Entities::PhysicalObject::SavePreviousTickTransform()
+{
+	m_previousTickTransform = m_body->getWorldTransform();
+}
+
+void OvPhysics::Entities::PhysicalObject::UpdateInterpolatedFTransform(float p_alpha)
+{
+	/* FTransforms moved since the last tick keep their value, the next tick will apply it to the body */
+	if (!m_kinematic && m_interpolated && IsFTransformSynced())
 	{
-		const btTransform& result = m_body->getWorldTransform();
-		m_transform->SetLocalPosition(Conversion::ToOvVector3(result.getOrigin()));
-		m_transform->SetLocalRotation(Conversion::ToOvQuaternion(result.getRotation()));
+		const btTransform& current = m_body->getWorldTransform();
+
+		btTransform result;
+		result.setOrigin(m_previousTickTransform.getOrigin().lerp(current.getOrigin(), p_alpha));
+		result.setRotation(m_previousTickTransform.getRotation().slerp(current.getRotation(), p_alpha));
+
+		SetSyncedFTransform(result);
 	}
 }
 
+bool OvPhysics::Entities::PhysicalObject::IsFTransformSynced() const
+{
+	/* Also catches FTransforms moved through their parent */
+	return m_hasSyncedFTransform && m_transform->GetWorldGeneration() == m_syncedGeneration;
+}
+
+void OvPhysics::Entities::PhysicalObject::SetSyncedFTransform(const btTransform& p_transform)
+{
+	m_transform->GenerateMatricesLocal(Conversion::ToOvVector3(p_transform.getOrigin()), Conversion::ToOvQuaternion(p_transform.getRotation()), m_transform->GetLocalScale());
+	m_syncedGeneration = m_transform->GetWorldGeneration();
+	m_hasSyncedFTransform = true;
+}
+
 void OvPhysics::Entities::PhysicalObject::RecreateBody()
 {
 	CreateBody(DestroyBody());
@@ -302,8 +360,6 @@ void OvPhysics::Entities::PhysicalObject::CreateBody(const Settings::BodySetting
 	if (p_bodySettings.isTrigger)
 		AddFlag(btCollisionObject::CF_NO_CONTACT_RESPONSE);
 
-	SetActivationState(EActivationState::ALWAYS_ACTIVE); // TODO: Avoid using always active
-
 	if (m_enabled)
 		Consider();
 }
@@ -43,14 +43,44 @@ namespace OvRendering::Buffers
 		void Unbind();
 
 		/**
-		* Send the block data
+		* Bind the given range of the SSBO to the given binding point
+		* @param p_bindingPoint
+		* @param p_offset (Must be a multiple of GetOffsetAlignment())
+		* @param p_size
+		*/
+		void BindRange(uint32_t p_bindingPoint, size_t p_offset, size_t p_size);
+
+		/**
+		* Send the block data (The storage is reallocated to the size of the data)
 		*/
 		template<typename T>
 		void SendBlocks(T* p_data, size_t p_size);
 
+		/**
+		* Make sure the storage holds at least the given size. The storage only grows, its content is lost when it does
+		* @param p_size
+		*/
+		void Reserve(size_t p_size);
+
+		/**
+		* Write the given data at the given offset of the storage, without reallocating it (See Reserve)
+		* @param p_data
+		* @param p_size
+		* @param p_offset
+		*/
+		template<typename T>
+		void SetSubData(T* p_data, size_t p_size, size_t p_offset);
+
+		/**
+		* Returns the alignment required by the offsets given to BindRange
+		*/
+		static size_t GetOffsetAlignment();
+
 	private:
 		uint32_t m_bufferID;
 		uint32_t m_bindingPoint = 0;
+		uint32_t m_accessSpecifier;
+		size_t m_capacity = 0;
 	};
 }
 
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <GL/glew.h>
+
 #include "OvRendering/Buffers/ShaderStorageBuffer.h"
 #include "UniformBuffer.h"
 
@@ -17,5 +19,14 @@ namespace OvRendering::Buffers
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_bufferID);
 		glBufferData(GL_SHADER_STORAGE_BUFFER, p_size, p_data, GL_DYNAMIC_DRAW);
 		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+		m_capacity = p_size;
+	}
+
+	template<typename T>
+	inline void ShaderStorageBuffer::SetSubData(T* p_data, size_t p_size, size_t p_offset)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_bufferID);
+		glBufferSubData(GL_SHADER_STORAGE_BUFFER, p_offset, p_size, p_data);
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 	}
 }
\ No newline at end of file
@@ -8,14 +8,27 @@
 
 #include <vector>
 #include <string>
+#include <array>
 
 #include "OvRendering/Context/Driver.h"
 #include "OvRendering/Buffers/EAccessSpecifier.h"
 
+/* Same declaration as the OpenGL one, so the sync objects of the ring don't require including GL */
+typedef struct __GLsync* GLsync;
+
 namespace OvRendering::Resources { class Shader; }
 
 namespace OvRendering::Buffers
 {
+	/**
+	* Defines how a UniformBuffer sends its data to the GPU
+	*/
+	enum class EUniformBufferMode
+	{
+		SUB_DATA,			// Every update is sent with glBufferSubData on the same buffer region
+		PERSISTENT_RING		// Every update is written into a persistently mapped, triple-buffered ring and bound with glBindBufferRange (The ring grows when a frame overflows it)
+	};
+
 	/**
 	* Wraps OpenGL UBO
 	*/
@@ -28,8 +41,19 @@ namespace OvRendering::Buffers
 		* @param p_bindingPoint (Specify the binding point on which the uniform buffer should be binded)
 		* @parma p_offset (The offset of the UBO, sizeof previouses UBO if the binding point is != 0)
 		* @param p_accessSpecifier
+		* @param p_mode (PERSISTENT_RING falls back to SUB_DATA if buffer storage isn't supported. p_offset is ignored in PERSISTENT_RING mode)
+		* @param p_ringSlotsPerFrame (Initial number of updates a frame can write into the ring, PERSISTENT_RING mode only. Updates past it are
+		*	orphaned into a separate buffer and the ring grows on the next NextFrame)
 		*/
-		UniformBuffer(size_t p_size, uint32_t p_bindingPoint = 0, uint32_t p_offset = 0, EAccessSpecifier p_accessSpecifier = EAccessSpecifier::DYNAMIC_DRAW);
+		UniformBuffer
+		(
+			size_t p_size,
+			uint32_t p_bindingPoint = 0,
+			uint32_t p_offset = 0,
+			EAccessSpecifier p_accessSpecifier = EAccessSpecifier::DYNAMIC_DRAW,
+			EUniformBufferMode p_mode = EUniformBufferMode::SUB_DATA,
+			uint32_t p_ringSlotsPerFrame = 4096
+		);
 
 		/**
 		* Destructor of the UniformBuffer
@@ -63,10 +87,22 @@ namespace OvRendering::Buffers
 		void SetSubData(const T& p_data, std::reference_wrapper<size_t> p_offsetInOut);
 
 		/**
-		* Return the ID of the UBO
+		* Notify the UBO that the frame ended. In PERSISTENT_RING mode, the next ring section becomes the one
+		* written to (Waiting for the GPU if it is still reading it, three frames later), or the ring grows if the frame
+		* overflowed it. Does nothing in SUB_DATA mode
+		*/
+		void NextFrame();
+
+		/**
+		* Return the ID of the UBO (In PERSISTENT_RING mode, the ID changes when the ring grows)
 		*/
 		uint32_t GetID() const;
 
+		/**
+		* Return the mode actually used by the UBO
+		*/
+		EUniformBufferMode GetMode() const;
+
 		/**
 		* Bind a block identified by the given ID to given shader
 		* @param p_shader
@@ -91,7 +127,29 @@ namespace OvRendering::Buffers
 		static uint32_t GetBlockLocation(OvRendering::Resources::Shader& p_shader, const std::string& p_name);
 
 	private:
-		uint32_t m_bufferID;
+		void SendSubData(const void* p_data, size_t p_size, size_t p_offset);
+		void PublishRingSlot();
+		void AllocateRing(uint32_t p_slotsPerFrame);
+		void ReleaseRing();
+		void WaitForFence(GLsync& p_fence);
+
+	private:
+		static constexpr uint32_t RING_SECTIONS = 3;
+
+		uint32_t m_bufferID = 0;
+		uint32_t m_bindingPoint;
+		size_t m_size;
+		EUniformBufferMode m_mode;
+
+		/* PERSISTENT_RING mode data */
+		std::vector<uint8_t> m_shadowData;
+		uint8_t* m_mappedData = nullptr;
+		size_t m_slotStride = 0;
+		uint32_t m_slotsPerFrame = 0;
+		uint32_t m_currentSection = 0;
+		uint32_t m_currentSlot = 0;
+		uint32_t m_overflowBufferID = 0;
+		std::array<GLsync, RING_SECTIONS> m_sectionFences = {};
 	};
 }
 
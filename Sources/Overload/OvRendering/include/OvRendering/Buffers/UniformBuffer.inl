@@ -6,8 +6,6 @@
 
 #pragma once
 
-#include <GL/glew.h>
-
 #include "OvRendering/Buffers/UniformBuffer.h"
 
 namespace OvRendering::Buffers
@@ -15,18 +13,14 @@ namespace OvRendering::Buffers
 	template<typename T>
 	inline void UniformBuffer::SetSubData(const T& p_data, size_t p_offsetInOut)
 	{
-		Bind();
-		glBufferSubData(GL_UNIFORM_BUFFER, p_offsetInOut, sizeof(T), std::addressof(p_data));
-		Unbind();
+		SendSubData(std::addressof(p_data), sizeof(T), p_offsetInOut);
 	}
 
 	template<typename T>
 	inline void UniformBuffer::SetSubData(const T& p_data, std::reference_wrapper<size_t> p_offsetInOut)
 	{
-		Bind();
 		size_t dataSize = sizeof(T);
-		glBufferSubData(GL_UNIFORM_BUFFER, p_offsetInOut.get(), dataSize, std::addressof(p_data));
+		SendSubData(std::addressof(p_data), dataSize, p_offsetInOut.get());
 		p_offsetInOut.get() += dataSize;
-		Unbind();
 	}
 }
\ No newline at end of file
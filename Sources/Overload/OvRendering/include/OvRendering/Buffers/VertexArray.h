@@ -22,7 +22,9 @@ namespace OvRendering::Buffers
 		INT				= 0x1404,
 		UNSIGNED_INT	= 0x1405,
 		FLOAT			= 0x1406,
-		DOUBLE			= 0x140A
+		DOUBLE			= 0x140A,
+		HALF_FLOAT		= 0x140B,
+		INT_2_10_10_10	= 0x8D9F
 	};
 
 	/**
@@ -49,9 +51,10 @@ namespace OvRendering::Buffers
 		* @param p_count
 		* @param p_stride
 		* @param p_offset
+		* @param p_normalized (Integer values are mapped to [-1, 1] for signed types, [0, 1] for unsigned ones)
 		*/
 		template <class T>
-		void BindAttribute(uint32_t p_attribute, VertexBuffer<T>& p_vertexBuffer, EType p_type, uint64_t p_count, uint64_t p_stride, intptr_t p_offset);
+		void BindAttribute(uint32_t p_attribute, VertexBuffer<T>& p_vertexBuffer, EType p_type, uint64_t p_count, uint64_t p_stride, intptr_t p_offset, bool p_normalized = false);
 
 		/**
 		* Bind the buffer
@@ -39,6 +39,8 @@ namespace OvRendering::Core
 			uint64_t batchCount		= 0;
 			uint64_t instanceCount	= 0;
 			uint64_t polyCount		= 0;
+			uint64_t programBinds	= 0;
+			uint64_t materialBinds	= 0;
 		};
 
 		/**
@@ -311,9 +313,11 @@ namespace OvRendering::Core
 		*/
 		const FrameInfo& GetFrameInfo() const;
 
+	protected:
+		FrameInfo			m_frameInfo;
+
 	private:
 		Context::Driver&	m_driver;
-		FrameInfo			m_frameInfo;
 		uint8_t				m_state;
 	};
 }
\ No newline at end of file
@@ -7,12 +7,14 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include <OvMaths/FMatrix4.h>
 #include <OvMaths/FTransform.h>
 
 
 #include "OvRendering/Geometry/BoundingSphere.h"
+#include "OvRendering/Geometry/BoundingSphereArray.h"
 
 namespace OvRendering::Data
 {
@@ -54,6 +56,13 @@ namespace OvRendering::Data
 		*/
 		bool CubeInFrustum(float p_x, float p_y, float p_z, float p_size) const;
 
+		/**
+		* Returns true if the given axis aligned box is in frustum (Or may be: boxes near the frustum corners can be reported as visible)
+		* @param p_min
+		* @param p_max
+		*/
+		bool BoxInFrustum(const OvMaths::FVector3& p_min, const OvMaths::FVector3& p_max) const;
+
 		/**
 		* Returns true if the given bouding sphere is in frustum
 		* @param p_boundingSphere
@@ -61,6 +70,14 @@ namespace OvRendering::Data
 		*/
 		bool BoundingSphereInFrustum(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform) const;
 
+		/**
+		* Fill the given vector with the indices of the spheres that are in frustum (In increasing order).
+		* Spheres are tested by packs of 4 (SSE) or 8 (AVX), and large arrays are split across worker threads
+		* @param p_spheres
+		* @param p_visibleIndices
+		*/
+		void SpheresInFrustum(const OvRendering::Geometry::BoundingSphereArray& p_spheres, std::vector<uint32_t>& p_visibleIndices) const;
+
 		/**
 		* Returns the near plane
 		*/
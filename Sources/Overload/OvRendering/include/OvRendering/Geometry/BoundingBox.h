@@ -0,0 +1,21 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <OvMaths/FVector3.h>
+
+namespace OvRendering::Geometry
+{
+	/**
+	* Data structure that defines an axis aligned bounding box (Min + max corners)
+	*/
+	struct BoundingBox
+	{
+		OvMaths::FVector3 min;
+		OvMaths::FVector3 max;
+	};
+}
\ No newline at end of file
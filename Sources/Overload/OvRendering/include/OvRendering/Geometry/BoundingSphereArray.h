@@ -0,0 +1,77 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include <OvMaths/FVector3.h>
+
+namespace OvRendering::Geometry
+{
+	/**
+	* World space bounding spheres stored as a structure of arrays (One array per component), so
+	* they can be tested by packs of 4 or 8 with SIMD instructions.
+	* Arrays are padded to a multiple of 8 with spheres that are never visible
+	*/
+	class BoundingSphereArray
+	{
+	public:
+		static constexpr size_t PACK_SIZE = 8;
+
+		/**
+		* Change the number of spheres. New spheres are never visible until they are set
+		* @param p_size
+		*/
+		void Resize(size_t p_size);
+
+		/**
+		* Set the sphere at the given index
+		* @param p_index
+		* @param p_center
+		* @param p_radius (An infinite radius makes the sphere always visible, a negative infinite radius makes it never visible)
+		*/
+		void Set(size_t p_index, const OvMaths::FVector3& p_center, float p_radius);
+
+		/**
+		* Returns the number of spheres (Padding excluded)
+		*/
+		size_t Size() const;
+
+		/**
+		* Returns the number of spheres, padding included (Multiple of PACK_SIZE)
+		*/
+		size_t PaddedSize() const;
+
+		/**
+		* Returns the X coordinates of the sphere centers
+		*/
+		const float* GetX() const;
+
+		/**
+		* Returns the Y coordinates of the sphere centers
+		*/
+		const float* GetY() const;
+
+		/**
+		* Returns the Z coordinates of the sphere centers
+		*/
+		const float* GetZ() const;
+
+		/**
+		* Returns the radii of the spheres
+		*/
+		const float* GetRadii() const;
+
+	private:
+		size_t m_size = 0;
+		std::vector<float> m_x;
+		std::vector<float> m_y;
+		std::vector<float> m_z;
+		std::vector<float> m_radii;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "OvRendering/Geometry/BoundingBox.h"
+#include "OvRendering/Data/Frustum.h"
+
+namespace OvRendering::Geometry
+{
+	/**
+	* Bounding volume hierarchy of enlarged ("fat") axis aligned bounding boxes, kept balanced with tree rotations.
+	* Each leaf (proxy) holds a user value. Moving a proxy inside its fat box is free, so slowly moving
+	* objects rarely touch the tree, and queries only visit the branches overlapping the query volume
+	*/
+	class DynamicAABBTree
+	{
+	public:
+		static constexpr int32_t NULL_NODE = -1;
+
+		/**
+		* Constructor of the tree
+		* @param p_margin (Distance added on every side of the proxies boxes)
+		*/
+		DynamicAABBTree(float p_margin = 0.25f);
+
+		/**
+		* Create a proxy for the given box and returns its ID
+		* @param p_box
+		* @param p_userData
+		*/
+		int32_t CreateProxy(const BoundingBox& p_box, uint32_t p_userData);
+
+		/**
+		* Destroy the given proxy
+		* @param p_proxy
+		*/
+		void DestroyProxy(int32_t p_proxy);
+
+		/**
+		* Update the box of the given proxy. Returns true if the proxy had to be re-inserted (The box left the fat box)
+		* @param p_proxy
+		* @param p_box
+		*/
+		bool MoveProxy(int32_t p_proxy, const BoundingBox& p_box);
+
+		/**
+		* Returns the user value of the given proxy
+		* @param p_proxy
+		*/
+		uint32_t GetUserData(int32_t p_proxy) const;
+
+		/**
+		* Returns the number of proxies
+		*/
+		uint32_t GetProxyCount() const;
+
+		/**
+		* Returns the height of the tree (0 for an empty tree or a single proxy)
+		*/
+		int32_t GetHeight() const;
+
+		/**
+		* Append the user values of the proxies whose fat box is in the given frustum
+		* @param p_frustum
+		* @param p_output
+		*/
+		void QueryFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<uint32_t>& p_output) const;
+
+	private:
+		struct Node
+		{
+			BoundingBox box;
+			uint32_t userData = 0;
+			int32_t parent = NULL_NODE; // Next free node when the node is in the free list
+			int32_t child1 = NULL_NODE;
+			int32_t child2 = NULL_NODE;
+			int32_t height = 0; // -1 if the node is free
+		};
+
+		bool IsLeaf(int32_t p_node) const;
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t p_node);
+		void InsertLeaf(int32_t p_leaf);
+		void RemoveLeaf(int32_t p_leaf);
+		int32_t Balance(int32_t p_node);
+		void RefitAncestors(int32_t p_node);
+
+		template<typename Overlaps>
+		void Traverse(Overlaps p_overlaps, std::vector<uint32_t>& p_output) const;
+
+	private:
+		const float m_margin;
+		std::vector<Node> m_nodes;
+		int32_t m_root = NULL_NODE;
+		int32_t m_freeList = NULL_NODE;
+		uint32_t m_proxyCount = 0;
+	};
+}
\ No newline at end of file
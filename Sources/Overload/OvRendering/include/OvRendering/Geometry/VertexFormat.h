@@ -0,0 +1,97 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "OvRendering/Buffers/VertexArray.h"
+#include "OvRendering/Geometry/Vertex.h"
+#include "OvRendering/Geometry/BoundingSphere.h"
+
+namespace OvRendering::Geometry
+{
+	/**
+	* Layout of the vertices of a mesh in its vertex buffer
+	*/
+	enum class EVertexFormat : uint32_t
+	{
+		STANDARD	= 0,	// Vertex (56 bytes), indices on 32 bits
+		COMPRESSED	= 1		// PackedVertex (24 bytes), indices on 16 bits when the mesh has few enough vertices
+	};
+
+	/**
+	* Compressed vertex. Texture coordinates are half floats, normal and tangent are signed normalized 10:10:10:2 integers
+	* (Decoded by the vertex fetch). The bitangent isn't stored: the w component of the tangent holds its sign and the
+	* shaders rebuild it from the normal and the tangent
+	*/
+	struct PackedVertex
+	{
+		float		position[3];
+		uint16_t	texCoords[2];
+		uint32_t	normal;
+		uint32_t	tangent;
+	};
+
+	static_assert(sizeof(PackedVertex) == 24, "Packed vertices are expected to be tightly packed");
+
+	/**
+	* Vertices and indices of a mesh, laid out as its buffers expect them
+	*/
+	struct PackedMesh
+	{
+		EVertexFormat		vertexFormat	= EVertexFormat::STANDARD;
+		Buffers::EType		indexType		= Buffers::EType::UNSIGNED_INT;
+		uint32_t			vertexCount		= 0;
+		uint32_t			indexCount		= 0;
+		uint32_t			materialIndex	= 0;
+		BoundingSphere		boundingSphere	= {};
+		std::vector<char>	vertices;
+		std::vector<char>	indices;
+	};
+
+	/**
+	* Conversion of vertices to the supported vertex formats
+	*/
+	class VertexFormat
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		VertexFormat() = delete;
+
+		/**
+		* Returns the size in bytes of a vertex of the given format
+		* @param p_format
+		*/
+		static uint32_t GetVertexSize(EVertexFormat p_format);
+
+		/**
+		* Returns the size in bytes of an index of the given type (0 if the type can't be used for indices)
+		* @param p_indexType
+		*/
+		static uint32_t GetIndexSize(Buffers::EType p_indexType);
+
+		/**
+		* Compress a vertex
+		* @param p_vertex
+		*/
+		static PackedVertex Pack(const Vertex& p_vertex);
+
+		/**
+		* Convert the given vertices and indices to the given format
+		* @param p_vertices
+		* @param p_vertexCount
+		* @param p_indices
+		* @param p_indexCount
+		* @param p_materialIndex
+		* @param p_format
+		*/
+		static PackedMesh Pack(const Vertex* p_vertices, uint32_t p_vertexCount, const uint32_t* p_indices, uint32_t p_indexCount, uint32_t p_materialIndex, EVertexFormat p_format);
+	};
+}
\ No newline at end of file
@@ -22,5 +22,6 @@ namespace OvRendering::Resources
 		virtual void Unbind() = 0;
 		virtual uint32_t GetVertexCount() = 0;
 		virtual uint32_t GetIndexCount() = 0;
+		virtual Buffers::EType GetIndexType() = 0;
 	};
 }
\ No newline at end of file
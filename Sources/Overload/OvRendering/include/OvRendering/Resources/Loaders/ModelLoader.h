@@ -7,9 +7,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "OvRendering/Resources/Model.h"
 #include "OvRendering/Resources/Parsers/AssimpParser.h"
+#include "OvRendering/Resources/Parsers/CookedModel.h"
 
 namespace OvRendering::Resources::Loaders
 {
@@ -24,20 +26,75 @@ namespace OvRendering::Resources::Loaders
 		*/
 		ModelLoader() = delete;
 
+		/**
+		* Parsed model, packed in its vertex format and ready to be uploaded
+		*/
+		struct ModelData
+		{
+			std::vector<Geometry::PackedMesh>	meshes;
+			std::vector<std::string>			materialNames;
+		};
+
+		/**
+		* Parse a model file and pack its meshes in the given vertex format. Doesn't use the graphics context, so it can be called from any thread.
+		* Returns false on failure
+		* @param p_filepath
+		* @param p_outData
+		* @param p_parserFlags
+		* @param p_vertexFormat
+		*/
+		static bool Decode(const std::string& p_filepath, ModelData& p_outData, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE, Geometry::EVertexFormat p_vertexFormat = Geometry::EVertexFormat::STANDARD);
+
+		/**
+		* Create a model from parsed data
+		* @param p_filepath
+		* @param p_data
+		*/
+		static Model* Upload(const std::string& p_filepath, const ModelData& p_data);
+
+		/**
+		* Create a model from a cooked model (Vertices and indices are uploaded straight from the cooked data)
+		* @param p_filepath
+		* @param p_cookedModel
+		*/
+		static Model* Upload(const std::string& p_filepath, const Parsers::CookedModel& p_cookedModel);
+
+		/**
+		* Parse a model file and write it as a cooked model (.ovmesh), tagged with the key of its source.
+		* Returns false on failure
+		* @param p_filepath
+		* @param p_destinationPath
+		* @param p_parserFlags
+		* @param p_vertexFormat
+		*/
+		static bool Cook(const std::string& p_filepath, const std::string& p_destinationPath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE, Geometry::EVertexFormat p_vertexFormat = Geometry::EVertexFormat::STANDARD);
+
+		/**
+		* Returns a key identifying the version of the given model file (Size and last write time) and the settings it is
+		* loaded with. A cooked model is up to date if its source key matches the one of its source. Only the file status
+		* is read, so the check stays cheap on every load
+		* @param p_filepath
+		* @param p_parserFlags
+		* @param p_vertexFormat
+		*/
+		static uint64_t ComputeSourceKey(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE, Geometry::EVertexFormat p_vertexFormat = Geometry::EVertexFormat::STANDARD);
+
 		/**
 		* Create a model
 		* @param p_filepath
 		* @param p_parserFlags
+		* @param p_vertexFormat
 		*/
-		static Model* Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE);
+		static Model* Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE, Geometry::EVertexFormat p_vertexFormat = Geometry::EVertexFormat::STANDARD);
 
 		/**
 		* Reload a model from file
 		* @param p_model
 		* @param p_filePath
 		* @param p_parserFlags
+		* @param p_vertexFormat
 		*/
-		static void Reload(Model& p_model, const std::string& p_filePath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE);
+		static void Reload(Model& p_model, const std::string& p_filePath, Parsers::EModelParserFlags p_parserFlags = Parsers::EModelParserFlags::NONE, Geometry::EVertexFormat p_vertexFormat = Geometry::EVertexFormat::STANDARD);
 
 		/**
 		* Disabled constructor
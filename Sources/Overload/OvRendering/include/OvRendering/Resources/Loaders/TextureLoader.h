@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "OvRendering/Resources/Texture.h"
+#include "OvRendering/Resources/Parsers/CookedTexture.h"
 
 
 namespace OvRendering::Resources::Loaders
@@ -25,6 +26,64 @@ namespace OvRendering::Resources::Loaders
 		*/
 		TextureLoader() = delete;
 
+		/**
+		* Decoded image, ready to be uploaded
+		*/
+		struct TextureData
+		{
+			std::vector<uint8_t>	pixels;		// RGBA8, bottom row first
+			uint32_t				width			= 0;
+			uint32_t				height			= 0;
+			uint32_t				bitsPerPixel	= 0;
+		};
+
+		/**
+		* Decode an image file. Doesn't use the graphics context, so it can be called from any thread.
+		* Returns false on failure
+		* @param p_filePath
+		* @param p_outData
+		*/
+		static bool Decode(const std::string& p_filePath, TextureData& p_outData);
+
+		/**
+		* Create a texture from decoded data
+		* @param p_filePath
+		* @param p_data
+		* @param p_firstFilter
+		* @param p_secondFilter
+		* @param p_generateMipmap
+		*/
+		static Texture* Upload(const std::string& p_filePath, const TextureData& p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap);
+
+		/**
+		* Create a texture from a cooked texture (Every mip level is uploaded straight from the cooked data)
+		* @param p_filePath
+		* @param p_cookedTexture
+		* @param p_firstFilter
+		* @param p_secondFilter
+		*/
+		static Texture* Upload(const std::string& p_filePath, const Parsers::CookedTexture& p_cookedTexture, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter);
+
+		/**
+		* Decode an image file and write it as a cooked texture (.ovtex) with its precomputed mip chain, tagged with the key of its source.
+		* Returns false on failure
+		* @param p_filePath
+		* @param p_destinationPath
+		* @param p_compression
+		* @param p_generateMipmap
+		*/
+		static bool Cook(const std::string& p_filePath, const std::string& p_destinationPath, OvRendering::Settings::ETextureCompression p_compression, bool p_generateMipmap);
+
+		/**
+		* Returns a key identifying the version of the given image file (Size and last write time) and the settings it is
+		* cooked with. A cooked texture is up to date if its source key matches the one of its source. Only the file status
+		* is read, so the check stays cheap on every load
+		* @param p_filePath
+		* @param p_compression
+		* @param p_generateMipmap
+		*/
+		static uint64_t ComputeSourceKey(const std::string& p_filePath, OvRendering::Settings::ETextureCompression p_compression, bool p_generateMipmap);
+
 		/**
 		* Create a texture from file
 		* @param p_filePath
@@ -13,6 +13,7 @@
 #include "OvRendering/Buffers/IndexBuffer.h"
 #include "OvRendering/Resources/IMesh.h"
 #include "OvRendering/Geometry/Vertex.h"
+#include "OvRendering/Geometry/VertexFormat.h"
 #include "OvRendering/Geometry/BoundingSphere.h"
 
 namespace OvRendering::Resources
@@ -31,6 +32,36 @@ namespace OvRendering::Resources
 		*/
 		Mesh(const std::vector<Geometry::Vertex>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex);
 
+		/**
+		* Create a mesh from raw vertices and indices (Uploaded as is, without intermediate copy) and a precomputed bounding sphere
+		* @param p_vertices
+		* @param p_vertexCount
+		* @param p_indices
+		* @param p_indexCount
+		* @param p_materialIndex
+		* @param p_boundingSphere
+		*/
+		Mesh(const Geometry::Vertex* p_vertices, uint32_t p_vertexCount, const uint32_t* p_indices, uint32_t p_indexCount, uint32_t p_materialIndex, const Geometry::BoundingSphere& p_boundingSphere);
+
+		/**
+		* Create a mesh from vertices and indices already laid out in the given vertex format (Uploaded as is)
+		* @param p_vertexFormat
+		* @param p_vertices
+		* @param p_vertexCount
+		* @param p_indices
+		* @param p_indexType (UNSIGNED_SHORT or UNSIGNED_INT)
+		* @param p_indexCount
+		* @param p_materialIndex
+		* @param p_boundingSphere
+		*/
+		Mesh(Geometry::EVertexFormat p_vertexFormat, const void* p_vertices, uint32_t p_vertexCount, const void* p_indices, Buffers::EType p_indexType, uint32_t p_indexCount, uint32_t p_materialIndex, const Geometry::BoundingSphere& p_boundingSphere);
+
+		/**
+		* Create a mesh from packed vertices and indices
+		* @param p_packedMesh
+		*/
+		Mesh(const Geometry::PackedMesh& p_packedMesh);
+
 		/**
 		* Bind the mesh (Actually bind its VAO)
 		*/
@@ -51,6 +82,16 @@ namespace OvRendering::Resources
 		*/
 		virtual uint32_t GetIndexCount() override;
 
+		/**
+		* Returns the type of the indices (UNSIGNED_SHORT or UNSIGNED_INT)
+		*/
+		virtual Buffers::EType GetIndexType() override;
+
+		/**
+		* Returns the format of the vertices
+		*/
+		Geometry::EVertexFormat GetVertexFormat() const;
+
 		/**
 		* Returns the material index of the mesh
 		*/
@@ -61,18 +102,26 @@ namespace OvRendering::Resources
 		*/
 		const OvRendering::Geometry::BoundingSphere& GetBoundingSphere() const;
 
+		/**
+		* Compute the bounding sphere of the given vertices
+		* @param p_vertices
+		* @param p_vertexCount
+		*/
+		static Geometry::BoundingSphere ComputeBoundingSphere(const Geometry::Vertex* p_vertices, uint32_t p_vertexCount);
+
 	private:
-		void CreateBuffers(const std::vector<Geometry::Vertex>& p_vertices, const std::vector<uint32_t>& p_indices);
-		void ComputeBoundingSphere(const std::vector<Geometry::Vertex>& p_vertices);
+		void CreateBuffers(const void* p_vertices, const void* p_indices);
 
 	private:
 		const uint32_t m_vertexCount;
 		const uint32_t m_indicesCount;
 		const uint32_t m_materialIndex;
+		const Geometry::EVertexFormat m_vertexFormat;
+		const Buffers::EType m_indexType;
 
-		Buffers::VertexArray							m_vertexArray;
-		std::unique_ptr<Buffers::VertexBuffer<float>>	m_vertexBuffer;
-		std::unique_ptr<Buffers::IndexBuffer>			m_indexBuffer;
+		Buffers::VertexArray								m_vertexArray;
+		std::unique_ptr<Buffers::VertexBuffer<uint8_t>>	m_vertexBuffer;
+		std::unique_ptr<Buffers::IndexBuffer>				m_indexBuffer;
 
 		Geometry::BoundingSphere m_boundingSphere;
 	};
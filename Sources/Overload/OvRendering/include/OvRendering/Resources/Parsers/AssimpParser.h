@@ -21,6 +21,22 @@ namespace OvRendering::Resources::Parsers
 	class AssimpParser : public IModelParser
 	{
 	public:
+		/**
+		* Load mesh data from a file using assimp (Can be called from any thread)
+		* Return true on success
+		* @param p_filename
+		* @param p_meshes
+		* @param p_materials
+		* @param p_parserFlags
+		*/
+		bool LoadModel
+		(
+			const std::string& p_fileName,
+			std::vector<MeshData>& p_meshes,
+			std::vector<std::string>& p_materials,
+			EModelParserFlags p_parserFlags
+		) override;
+
 		/**
 		* Simply load meshes from a file using assimp
 		* Return true on success
@@ -38,7 +54,7 @@ namespace OvRendering::Resources::Parsers
 
 	private:
 		void ProcessMaterials(const struct aiScene* p_scene, std::vector<std::string>& p_materials);;
-		void ProcessNode(void* p_transform, struct aiNode* p_node, const struct aiScene* p_scene, std::vector<Mesh*>& p_meshes);
+		void ProcessNode(void* p_transform, struct aiNode* p_node, const struct aiScene* p_scene, std::vector<MeshData>& p_meshes);
 		void ProcessMesh(void* p_transform, struct aiMesh* p_mesh, const struct aiScene* p_scene, std::vector<Geometry::Vertex>& p_outVertices, std::vector<uint32_t>& p_outIndices);
 	};
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "OvRendering/Settings/ETextureCompression.h"
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* CPU encoder of the BC1, BC3, BC5 and BC7 block compression formats.
+	* The encoders favour speed over quality: endpoints are fitted on the principal axis of each block
+	* and texels are assigned by projection on the quantized endpoints (4 texels at once with SSE)
+	*/
+	class BlockCompressor
+	{
+	public:
+		/**
+		* Disabled constructor
+		*/
+		BlockCompressor() = delete;
+
+		/**
+		* Returns true if every texel of the given RGBA8 image is opaque
+		* @param p_pixels
+		* @param p_texelCount
+		*/
+		static bool IsOpaque(const uint8_t* p_pixels, size_t p_texelCount);
+
+		/**
+		* Returns the size in bytes of an image of the given size once compressed (4 bytes per texel for NONE)
+		* @param p_compression (AUTO isn't a format, it must be resolved first)
+		* @param p_width
+		* @param p_height
+		*/
+		static size_t GetCompressedSize(Settings::ETextureCompression p_compression, uint32_t p_width, uint32_t p_height);
+
+		/**
+		* Compress an RGBA8 image. Images whose size isn't a multiple of 4 get their border blocks padded with edge texels
+		* @param p_compression (AUTO isn't a format, it must be resolved first)
+		* @param p_pixels
+		* @param p_width
+		* @param p_height
+		*/
+		static std::vector<uint8_t> Compress(Settings::ETextureCompression p_compression, const uint8_t* p_pixels, uint32_t p_width, uint32_t p_height);
+	};
+}
\ No newline at end of file
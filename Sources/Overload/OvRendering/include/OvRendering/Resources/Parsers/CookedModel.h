@@ -0,0 +1,128 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "OvRendering/Geometry/VertexFormat.h"
+#include "OvRendering/Geometry/BoundingSphere.h"
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Read-only view of a cooked model (.ovmesh). The view doesn't copy the data, which is usually a memory-mapped file:
+	* vertices and indices are stored exactly as the mesh buffers expect them (In the vertex format chosen when cooking),
+	* so they are uploaded straight from the file.
+	* Layout (Little endian):
+	* - Header
+	* - A MeshRecord per mesh (Counts, formats, material index, precomputed bounding sphere and offsets of the blobs)
+	* - Material names, each one prefixed by its length
+	* - Vertex and index blobs, 16 bytes aligned
+	*/
+	class CookedModel
+	{
+	public:
+		static constexpr uint32_t VERSION = 2;
+
+		struct MeshRecord
+		{
+			uint32_t	materialIndex;
+			uint32_t	vertexCount;
+			uint32_t	indexCount;
+			uint16_t	vertexFormat;		// Geometry::EVertexFormat
+			uint16_t	indexType;			// Buffers::EType (UNSIGNED_SHORT or UNSIGNED_INT)
+			float		boundingSphere[4];	// Position then radius
+			uint64_t	verticesOffset;
+			uint64_t	indicesOffset;
+		};
+
+		/**
+		* Create a view over the given data (Check IsValid() before using the view)
+		* @param p_data
+		* @param p_size
+		*/
+		CookedModel(const char* p_data, size_t p_size);
+
+		/**
+		* Returns true if the data is a well-formed cooked model of the supported version
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the key of the source file and settings the model has been cooked from
+		*/
+		uint64_t GetSourceKey() const;
+
+		/**
+		* Returns the number of meshes
+		*/
+		uint32_t GetMeshCount() const;
+
+		/**
+		* Returns the record of the given mesh
+		* @param p_index
+		*/
+		const MeshRecord& GetMesh(uint32_t p_index) const;
+
+		/**
+		* Returns the vertices of the given mesh (Laid out in the vertex format of the mesh)
+		* @param p_index
+		*/
+		const void* GetVertices(uint32_t p_index) const;
+
+		/**
+		* Returns the indices of the given mesh (Of the index type of the mesh)
+		* @param p_index
+		*/
+		const void* GetIndices(uint32_t p_index) const;
+
+		/**
+		* Returns the vertex format of the given mesh
+		* @param p_index
+		*/
+		Geometry::EVertexFormat GetVertexFormat(uint32_t p_index) const;
+
+		/**
+		* Returns the index type of the given mesh
+		* @param p_index
+		*/
+		Buffers::EType GetIndexType(uint32_t p_index) const;
+
+		/**
+		* Returns the bounding sphere of the given mesh
+		* @param p_index
+		*/
+		Geometry::BoundingSphere GetBoundingSphere(uint32_t p_index) const;
+
+		/**
+		* Returns the material names of the model
+		*/
+		const std::vector<std::string>& GetMaterialNames() const;
+
+		/**
+		* Cook packed meshes into a cooked model
+		* @param p_meshes
+		* @param p_materialNames
+		* @param p_sourceKey
+		*/
+		static std::vector<char> Cook(const std::vector<Geometry::PackedMesh>& p_meshes, const std::vector<std::string>& p_materialNames, uint64_t p_sourceKey);
+
+	private:
+		bool Validate();
+
+	private:
+		const char*					m_data;
+		size_t						m_size;
+		bool						m_valid			= false;
+		uint64_t					m_sourceKey		= 0;
+		const MeshRecord*			m_meshes		= nullptr;
+		uint32_t					m_meshCount		= 0;
+		std::vector<std::string>	m_materialNames;
+	};
+}
\ No newline at end of file
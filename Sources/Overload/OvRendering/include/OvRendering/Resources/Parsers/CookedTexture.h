@@ -0,0 +1,106 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+#include "OvRendering/Settings/ETextureCompression.h"
+
+namespace OvRendering::Resources::Parsers
+{
+	/**
+	* Read-only view of a cooked texture (.ovtex). The view doesn't copy the data, which is usually a memory-mapped file:
+	* every mip level is stored already compressed, so the levels are uploaded straight from the file.
+	* Layout (Little endian):
+	* - Header
+	* - A MipRecord per level, the largest first
+	* - Level data, 16 bytes aligned
+	*/
+	class CookedTexture
+	{
+	public:
+		static constexpr uint32_t VERSION = 1;
+
+		struct MipRecord
+		{
+			uint32_t	width;
+			uint32_t	height;
+			uint64_t	offset;
+			uint64_t	size;
+		};
+
+		/**
+		* Create a view over the given data (Check IsValid() before using the view)
+		* @param p_data
+		* @param p_size
+		*/
+		CookedTexture(const char* p_data, size_t p_size);
+
+		/**
+		* Returns true if the data is a well-formed cooked texture of the supported version
+		*/
+		bool IsValid() const;
+
+		/**
+		* Returns the key of the source file and settings the texture has been cooked from
+		*/
+		uint64_t GetSourceKey() const;
+
+		/**
+		* Returns the compression of the levels (Never AUTO)
+		*/
+		Settings::ETextureCompression GetCompression() const;
+
+		/**
+		* Returns the bits per pixel of the source image
+		*/
+		uint32_t GetBitsPerPixel() const;
+
+		/**
+		* Returns the number of mip levels
+		*/
+		uint32_t GetMipCount() const;
+
+		/**
+		* Returns the record of the given mip level
+		* @param p_level
+		*/
+		const MipRecord& GetMip(uint32_t p_level) const;
+
+		/**
+		* Returns the data of the given mip level
+		* @param p_level
+		*/
+		const void* GetMipData(uint32_t p_level) const;
+
+		/**
+		* Cook an RGBA8 image into a cooked texture. The mip chain is computed with a box filter
+		* @param p_pixels
+		* @param p_width
+		* @param p_height
+		* @param p_bitsPerPixel
+		* @param p_compression (AUTO picks BC1 for opaque images, BC3 otherwise)
+		* @param p_generateMipmap
+		* @param p_sourceKey
+		*/
+		static std::vector<char> Cook(const uint8_t* p_pixels, uint32_t p_width, uint32_t p_height, uint32_t p_bitsPerPixel, Settings::ETextureCompression p_compression, bool p_generateMipmap, uint64_t p_sourceKey);
+
+	private:
+		bool Validate();
+
+	private:
+		const char*						m_data;
+		size_t							m_size;
+		bool							m_valid			= false;
+		uint64_t						m_sourceKey		= 0;
+		Settings::ETextureCompression	m_compression	= Settings::ETextureCompression::NONE;
+		uint32_t						m_bitsPerPixel	= 0;
+		const MipRecord*				m_mips			= nullptr;
+		uint32_t						m_mipCount		= 0;
+	};
+}
\ No newline at end of file
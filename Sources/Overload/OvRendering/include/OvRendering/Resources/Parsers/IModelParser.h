@@ -7,18 +7,45 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "OvRendering/Resources/Mesh.h"
 #include "OvRendering/Resources/Parsers/EModelParserFlags.h"
 
 namespace OvRendering::Resources::Parsers
 {
+	/**
+	* Vertices and indices of a mesh, before their upload to the GPU
+	*/
+	struct MeshData
+	{
+		std::vector<Geometry::Vertex>	vertices;
+		std::vector<uint32_t>			indices;
+		uint32_t						materialIndex = 0;
+	};
+
 	/**
 	* Interface for any model parser
 	*/
 	class IModelParser
 	{
 	public:
+		/**
+		* Load mesh data from a file, without creating any GPU resource (Can be called from any thread)
+		* Return true on success
+		* @param p_filename
+		* @param p_meshes
+		* @param p_materials
+		* @param p_parserFlags
+		*/
+		virtual bool LoadModel
+		(
+			const std::string& p_fileName,
+			std::vector<MeshData>& p_meshes,
+			std::vector<std::string>& p_materials,
+			EModelParserFlags p_parserFlags
+		) = 0;
+
 		/**
 		* Load meshes from a file
 		* Return true on success
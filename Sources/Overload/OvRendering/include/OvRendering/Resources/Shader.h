@@ -29,6 +29,9 @@ namespace OvRendering::Resources
 	friend class Loaders::ShaderLoader;
 
 	public:
+		/* Uniform set by the engine while drawing a batch of instances. It is never exposed as a material uniform */
+		static constexpr const char* INSTANCED_UNIFORM = "engine_Instanced";
+
 		/**
 		* Bind the program
 		*/
@@ -117,6 +120,17 @@ namespace OvRendering::Resources
 		*/
 		OvMaths::FMatrix4 GetUniformMat4(const std::string& p_name);
 
+		/**
+		* Returns true if the program declares the instanced uniform (And reads its matrices from the "InstancesSSBO" block when it is set)
+		*/
+		bool SupportsInstancing() const;
+
+		/**
+		* Set the instanced uniform (The program must be bound and support instancing)
+		* @param p_instanced
+		*/
+		void SetInstanced(bool p_instanced);
+
 		/**
 		* Returns information about the uniform identified by the given name or nullptr if not found
 		* @param p_name
@@ -142,5 +156,6 @@ namespace OvRendering::Resources
 
 	private:
 		std::unordered_map<std::string, int> m_uniformLocationCache;
+		int m_instancedUniformLocation = -1;
 	};
 }
\ No newline at end of file
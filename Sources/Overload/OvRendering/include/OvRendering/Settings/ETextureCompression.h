@@ -0,0 +1,25 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+
+
+namespace OvRendering::Settings
+{
+	/**
+	* Block compression applied to a texture when it is cooked
+	*/
+	enum class ETextureCompression
+	{
+		NONE	= 0,	// RGBA8, 4 bytes per texel
+		AUTO	= 1,	// BC1 for opaque textures, BC3 otherwise
+		BC1		= 2,	// RGB, half a byte per texel
+		BC3		= 3,	// RGBA, 1 byte per texel
+		BC5		= 4,	// RG (Normal maps), 1 byte per texel
+		BC7		= 5		// RGBA (Higher quality than BC1 and BC3), 1 byte per texel
+	};
+}
\ No newline at end of file
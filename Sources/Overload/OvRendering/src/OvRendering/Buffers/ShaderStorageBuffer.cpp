@@ -4,11 +4,14 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+
 #include <GL/glew.h>
 
 #include "OvRendering/Buffers/ShaderStorageBuffer.h"
 
-OvRendering::Buffers::ShaderStorageBuffer::ShaderStorageBuffer(EAccessSpecifier p_accessSpecifier)
+OvRendering::Buffers::ShaderStorageBuffer::ShaderStorageBuffer(EAccessSpecifier p_accessSpecifier) :
+	m_accessSpecifier(static_cast<uint32_t>(p_accessSpecifier))
 {
 	glGenBuffers(1, &m_bufferID);
 	glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_bufferID);
@@ -27,7 +30,33 @@ void OvRendering::Buffers::ShaderStorageBuffer::Bind(uint32_t p_bindingPoint)
 	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, p_bindingPoint, m_bufferID);
 }
 
+void OvRendering::Buffers::ShaderStorageBuffer::BindRange(uint32_t p_bindingPoint, size_t p_offset, size_t p_size)
+{
+	m_bindingPoint = p_bindingPoint;
+	glBindBufferRange(GL_SHADER_STORAGE_BUFFER, p_bindingPoint, m_bufferID, p_offset, p_size);
+}
+
 void OvRendering::Buffers::ShaderStorageBuffer::Unbind()
 {
 	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, m_bindingPoint, 0);
+}
+
+void OvRendering::Buffers::ShaderStorageBuffer::Reserve(size_t p_size)
+{
+	if (p_size > m_capacity)
+	{
+		/* Growing geometrically keeps reallocations rare when the size slowly increases */
+		m_capacity = std::max(p_size, m_capacity * 2);
+
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_bufferID);
+		glBufferData(GL_SHADER_STORAGE_BUFFER, m_capacity, nullptr, static_cast<GLenum>(m_accessSpecifier));
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+	}
+}
+
+size_t OvRendering::Buffers::ShaderStorageBuffer::GetOffsetAlignment()
+{
+	GLint alignment = 0;
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	return static_cast<size_t>(std::max(alignment, 1));
 }
\ No newline at end of file
@@ -4,23 +4,59 @@
 * @licence: MIT
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include <GL/glew.h>
 
 #include "OvRendering/Buffers/UniformBuffer.h"
 #include "OvRendering/Resources/Shader.h"
 
-OvRendering::Buffers::UniformBuffer::UniformBuffer(size_t p_size, uint32_t p_bindingPoint, uint32_t p_offset, EAccessSpecifier p_accessSpecifier)
+OvRendering::Buffers::UniformBuffer::UniformBuffer
+(
+	size_t p_size,
+	uint32_t p_bindingPoint,
+	uint32_t p_offset,
+	EAccessSpecifier p_accessSpecifier,
+	EUniformBufferMode p_mode,
+	uint32_t p_ringSlotsPerFrame
+) :
+	m_bindingPoint(p_bindingPoint),
+	m_size(p_size),
+	m_mode(p_mode == EUniformBufferMode::PERSISTENT_RING && GLEW_ARB_buffer_storage ? EUniformBufferMode::PERSISTENT_RING : EUniformBufferMode::SUB_DATA)
 {
-	glGenBuffers(1, &m_bufferID);
-	glBindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
-	glBufferData(GL_UNIFORM_BUFFER, p_size, NULL, static_cast<GLint>(p_accessSpecifier));
-	glBindBuffer(GL_UNIFORM_BUFFER, 0);
-	glBindBufferRange(GL_UNIFORM_BUFFER, p_bindingPoint, m_bufferID, p_offset, p_size);
+	if (m_mode == EUniformBufferMode::PERSISTENT_RING)
+	{
+		/* Every slot must start on an offset accepted by glBindBufferRange */
+		GLint alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		alignment = std::max(alignment, 1);
+
+		m_slotStride = ((p_size + alignment - 1) / alignment) * alignment;
+		m_shadowData.resize(p_size, 0);
+
+		AllocateRing(std::max(p_ringSlotsPerFrame, 1u));
+		PublishRingSlot();
+	}
+	else
+	{
+		glGenBuffers(1, &m_bufferID);
+		glBindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
+		glBufferData(GL_UNIFORM_BUFFER, p_size, NULL, static_cast<GLint>(p_accessSpecifier));
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferRange(GL_UNIFORM_BUFFER, p_bindingPoint, m_bufferID, p_offset, p_size);
+	}
 }
 
 OvRendering::Buffers::UniformBuffer::~UniformBuffer()
 {
-	glDeleteBuffers(1, &m_bufferID);
+	if (m_mode == EUniformBufferMode::PERSISTENT_RING)
+		ReleaseRing();
+	else
+		glDeleteBuffers(1, &m_bufferID);
+
+	if (m_overflowBufferID)
+		glDeleteBuffers(1, &m_overflowBufferID);
 }
 
 void OvRendering::Buffers::UniformBuffer::Bind()
@@ -33,11 +69,44 @@ void OvRendering::Buffers::UniformBuffer::Unbind()
 	glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
+void OvRendering::Buffers::UniformBuffer::NextFrame()
+{
+	if (m_mode == EUniformBufferMode::PERSISTENT_RING)
+	{
+		if (m_currentSlot > m_slotsPerFrame)
+		{
+			/* The frame overflowed its section: the ring grows so a frame like this one fits. The driver releases the
+			previous storage once the GPU is done with it, so nothing waits */
+			uint32_t slotsPerFrame = m_slotsPerFrame;
+			while (slotsPerFrame < m_currentSlot)
+				slotsPerFrame *= 2;
+
+			ReleaseRing();
+			AllocateRing(slotsPerFrame);
+			PublishRingSlot();
+			return;
+		}
+
+		m_sectionFences[m_currentSection] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+		m_currentSection = (m_currentSection + 1) % RING_SECTIONS;
+		m_currentSlot = 0;
+
+		/* The section written three frames ago may still be read by the GPU */
+		WaitForFence(m_sectionFences[m_currentSection]);
+	}
+}
+
 GLuint OvRendering::Buffers::UniformBuffer::GetID() const
 {
 	return m_bufferID;
 }
 
+OvRendering::Buffers::EUniformBufferMode OvRendering::Buffers::UniformBuffer::GetMode() const
+{
+	return m_mode;
+}
+
 void OvRendering::Buffers::UniformBuffer::BindBlockToShader(OvRendering::Resources::Shader& p_shader, uint32_t p_uniformBlockLocation, uint32_t p_bindingPoint)
 {
 	glUniformBlockBinding(p_shader.id, p_uniformBlockLocation, p_bindingPoint);
@@ -52,3 +121,92 @@ uint32_t OvRendering::Buffers::UniformBuffer::GetBlockLocation(OvRendering::Reso
 {
 	return glGetUniformBlockIndex(p_shader.id, p_name.c_str());
 }
+
+void OvRendering::Buffers::UniformBuffer::SendSubData(const void* p_data, size_t p_size, size_t p_offset)
+{
+	if (m_mode == EUniformBufferMode::PERSISTENT_RING)
+	{
+		/* Unchanged data doesn't need a new slot (Ex: The user matrix is often the same for every draw) */
+		if (std::memcmp(m_shadowData.data() + p_offset, p_data, p_size) != 0)
+		{
+			std::memcpy(m_shadowData.data() + p_offset, p_data, p_size);
+			PublishRingSlot();
+		}
+	}
+	else
+	{
+		Bind();
+		glBufferSubData(GL_UNIFORM_BUFFER, p_offset, p_size, p_data);
+		Unbind();
+	}
+}
+
+void OvRendering::Buffers::UniformBuffer::PublishRingSlot()
+{
+	if (m_currentSlot < m_slotsPerFrame)
+	{
+		const size_t offset = (static_cast<size_t>(m_currentSection) * m_slotsPerFrame + m_currentSlot) * m_slotStride;
+		std::memcpy(m_mappedData + offset, m_shadowData.data(), m_size);
+		glBindBufferRange(GL_UNIFORM_BUFFER, m_bindingPoint, m_bufferID, offset, m_size);
+	}
+	else
+	{
+		/* The section is full: the slots of this frame can't be reused before the GPU reads them, so the update
+		orphans a separate buffer instead of waiting (The ring grows on NextFrame) */
+		if (!m_overflowBufferID)
+			glGenBuffers(1, &m_overflowBufferID);
+
+		glBindBuffer(GL_UNIFORM_BUFFER, m_overflowBufferID);
+		glBufferData(GL_UNIFORM_BUFFER, m_size, m_shadowData.data(), GL_STREAM_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+		glBindBufferRange(GL_UNIFORM_BUFFER, m_bindingPoint, m_overflowBufferID, 0, m_size);
+	}
+
+	++m_currentSlot;
+}
+
+void OvRendering::Buffers::UniformBuffer::AllocateRing(uint32_t p_slotsPerFrame)
+{
+	m_slotsPerFrame = p_slotsPerFrame;
+	m_currentSection = 0;
+	m_currentSlot = 0;
+
+	const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	const GLsizeiptr ringSize = static_cast<GLsizeiptr>(m_slotStride * m_slotsPerFrame * RING_SECTIONS);
+
+	glGenBuffers(1, &m_bufferID);
+	glBindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
+	glBufferStorage(GL_UNIFORM_BUFFER, ringSize, nullptr, flags);
+	m_mappedData = static_cast<uint8_t*>(glMapBufferRange(GL_UNIFORM_BUFFER, 0, ringSize, flags));
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+}
+
+void OvRendering::Buffers::UniformBuffer::ReleaseRing()
+{
+	for (auto& fence : m_sectionFences)
+	{
+		if (fence)
+		{
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+
+	glBindBuffer(GL_UNIFORM_BUFFER, m_bufferID);
+	glUnmapBuffer(GL_UNIFORM_BUFFER);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	glDeleteBuffers(1, &m_bufferID);
+
+	m_mappedData = nullptr;
+	m_bufferID = 0;
+}
+
+void OvRendering::Buffers::UniformBuffer::WaitForFence(GLsync& p_fence)
+{
+	if (p_fence)
+	{
+		while (glClientWaitSync(p_fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED);
+		glDeleteSync(p_fence);
+		p_fence = nullptr;
+	}
+}
\ No newline at end of file
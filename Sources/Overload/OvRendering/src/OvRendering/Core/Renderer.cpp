@@ -199,6 +199,8 @@ void OvRendering::Core::Renderer::ClearFrameInfo()
 	m_frameInfo.batchCount		= 0;
 	m_frameInfo.instanceCount	= 0;
 	m_frameInfo.polyCount		= 0;
+	m_frameInfo.programBinds	= 0;
+	m_frameInfo.materialBinds	= 0;
 }
 
 void OvRendering::Core::Renderer::Draw(Resources::IMesh& p_mesh, Settings::EPrimitiveMode p_primitiveMode, uint32_t p_instances)
@@ -214,10 +216,12 @@ void OvRendering::Core::Renderer::Draw(Resources::IMesh& p_mesh, Settings::EPrim
 		if (p_mesh.GetIndexCount() > 0)
 		{
 			/* With EBO */
+			const GLenum indexType = static_cast<GLenum>(p_mesh.GetIndexType());
+
 			if (p_instances == 1)
-				glDrawElements(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), GL_UNSIGNED_INT, nullptr);
+				glDrawElements(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), indexType, nullptr);
 			else
-				glDrawElementsInstanced(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), GL_UNSIGNED_INT, nullptr, p_instances);
+				glDrawElementsInstanced(static_cast<GLenum>(p_primitiveMode), p_mesh.GetIndexCount(), indexType, nullptr, p_instances);
 		}
 		else
 		{
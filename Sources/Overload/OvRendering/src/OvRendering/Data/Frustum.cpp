@@ -6,6 +6,10 @@
 
 #include <cmath>
 #include <algorithm>
+#include <future>
+#include <thread>
+
+#include <immintrin.h>
 
 #include "OvRendering/Data/Frustum.h"
 
@@ -31,6 +35,74 @@ enum PlaneData
 	D = 3				// The distance the plane is from the origin
 };
 
+namespace
+{
+	/* Below this amount of spheres per worker, starting a thread costs more than it saves */
+	constexpr size_t kMinSpheresPerWorker = 16384;
+
+	/* Append the indices of the spheres in [p_first, p_last) that are in front of every plane. Bounds must be multiples of BoundingSphereArray::PACK_SIZE */
+	void CullSpheres(const float p_planes[6][4], const OvRendering::Geometry::BoundingSphereArray& p_spheres, size_t p_first, size_t p_last, std::vector<uint32_t>& p_output)
+	{
+		const float* xs = p_spheres.GetX();
+		const float* ys = p_spheres.GetY();
+		const float* zs = p_spheres.GetZ();
+		const float* radii = p_spheres.GetRadii();
+
+#ifdef __AVX__
+		constexpr size_t laneCount = 8;
+
+		for (size_t i = p_first; i < p_last; i += laneCount)
+		{
+			const __m256 x = _mm256_loadu_ps(xs + i);
+			const __m256 y = _mm256_loadu_ps(ys + i);
+			const __m256 z = _mm256_loadu_ps(zs + i);
+			const __m256 radius = _mm256_loadu_ps(radii + i);
+
+			__m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+			/* Same test as SphereInFrustum: the sphere is culled if (A * x + B * y + C * z + D) <= -radius for any plane */
+			for (int plane = 0; plane < 6; ++plane)
+			{
+				__m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(p_planes[plane][0]), x), _mm256_set1_ps(p_planes[plane][3]));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(p_planes[plane][1]), y));
+				distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(p_planes[plane][2]), z));
+				visible = _mm256_and_ps(visible, _mm256_cmp_ps(distance, _mm256_sub_ps(_mm256_setzero_ps(), radius), _CMP_GT_OQ));
+			}
+
+			const int mask = _mm256_movemask_ps(visible);
+#else
+		constexpr size_t laneCount = 4;
+
+		for (size_t i = p_first; i < p_last; i += laneCount)
+		{
+			const __m128 x = _mm_loadu_ps(xs + i);
+			const __m128 y = _mm_loadu_ps(ys + i);
+			const __m128 z = _mm_loadu_ps(zs + i);
+			const __m128 radius = _mm_loadu_ps(radii + i);
+
+			__m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+			/* Same test as SphereInFrustum: the sphere is culled if (A * x + B * y + C * z + D) <= -radius for any plane */
+			for (int plane = 0; plane < 6; ++plane)
+			{
+				__m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(p_planes[plane][0]), x), _mm_set1_ps(p_planes[plane][3]));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(p_planes[plane][1]), y));
+				distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(p_planes[plane][2]), z));
+				visible = _mm_and_ps(visible, _mm_cmpgt_ps(distance, _mm_sub_ps(_mm_setzero_ps(), radius)));
+			}
+
+			const int mask = _mm_movemask_ps(visible);
+#endif
+			if (mask)
+			{
+				for (size_t lane = 0; lane < laneCount; ++lane)
+					if (mask & (1 << lane))
+						p_output.push_back(static_cast<uint32_t>(i + lane));
+			}
+		}
+	}
+}
+
 ///////////////////////////////// NORMALIZE PLANE \\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\\*
 /////
 /////	This normalizes a plane (A side) from a given frustum.
@@ -251,6 +323,22 @@ bool OvRendering::Data::Frustum::CubeInFrustum(float x, float y, float z, float
 	return true;
 }
 
+bool OvRendering::Data::Frustum::BoxInFrustum(const OvMaths::FVector3& p_min, const OvMaths::FVector3& p_max) const
+{
+	for (int i = 0; i < 6; i++)
+	{
+		/* Only the corner the farthest along the plane normal has to be tested */
+		const float x = m_frustum[i][A] > 0.0f ? p_max.x : p_min.x;
+		const float y = m_frustum[i][B] > 0.0f ? p_max.y : p_min.y;
+		const float z = m_frustum[i][C] > 0.0f ? p_max.z : p_min.z;
+
+		if (m_frustum[i][A] * x + m_frustum[i][B] * y + m_frustum[i][C] * z + m_frustum[i][D] <= 0)
+			return false;
+	}
+
+	return true;
+}
+
 bool OvRendering::Data::Frustum::BoundingSphereInFrustum(const OvRendering::Geometry::BoundingSphere& p_boundingSphere, const OvMaths::FTransform& p_transform) const
 {
 	const auto& position = p_transform.GetWorldPosition();
@@ -266,6 +354,44 @@ bool OvRendering::Data::Frustum::BoundingSphereInFrustum(const OvRendering::Geom
 	return SphereInFrustum(worldCenter.x, worldCenter.y, worldCenter.z, scaledRadius);
 }
 
+void OvRendering::Data::Frustum::SpheresInFrustum(const OvRendering::Geometry::BoundingSphereArray& p_spheres, std::vector<uint32_t>& p_visibleIndices) const
+{
+	using OvRendering::Geometry::BoundingSphereArray;
+
+	p_visibleIndices.clear();
+
+	const size_t packCount = p_spheres.PaddedSize() / BoundingSphereArray::PACK_SIZE;
+	const size_t maxWorkerCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t workerCount = std::clamp<size_t>(p_spheres.Size() / kMinSpheresPerWorker, 1, maxWorkerCount);
+
+	if (workerCount == 1)
+	{
+		CullSpheres(m_frustum, p_spheres, 0, p_spheres.PaddedSize(), p_visibleIndices);
+		return;
+	}
+
+	/* Each worker culls a contiguous range, the calling thread takes the first one. Results are concatenated in order */
+	const size_t packsPerWorker = (packCount + workerCount - 1) / workerCount;
+	const auto rangeStart = [&](size_t p_worker) { return std::min(p_worker * packsPerWorker, packCount) * BoundingSphereArray::PACK_SIZE; };
+
+	std::vector<std::vector<uint32_t>> workerResults(workerCount - 1);
+	std::vector<std::future<void>> workers;
+	workers.reserve(workerCount - 1);
+
+	for (size_t worker = 1; worker < workerCount; ++worker)
+	{
+		workers.push_back(std::async(std::launch::async, CullSpheres, m_frustum, std::cref(p_spheres), rangeStart(worker), rangeStart(worker + 1), std::ref(workerResults[worker - 1])));
+	}
+
+	CullSpheres(m_frustum, p_spheres, 0, rangeStart(1), p_visibleIndices);
+
+	for (size_t worker = 0; worker < workers.size(); ++worker)
+	{
+		workers[worker].wait();
+		p_visibleIndices.insert(p_visibleIndices.end(), workerResults[worker].begin(), workerResults[worker].end());
+	}
+}
+
 std::array<float, 4> OvRendering::Data::Frustum::GetNearPlane() const
 {
 	return { m_frustum[FRONT][0], m_frustum[FRONT][1], m_frustum[FRONT][2], m_frustum[FRONT][3] };
@@ -274,4 +400,4 @@ std::array<float, 4> OvRendering::Data::Frustum::GetNearPlane() const
 std::array<float, 4> OvRendering::Data::Frustum::GetFarPlane() const
 {
 	return { m_frustum[BACK][0], m_frustum[BACK][1], m_frustum[BACK][2], m_frustum[BACK][3] };
-}
+}
\ No newline at end of file
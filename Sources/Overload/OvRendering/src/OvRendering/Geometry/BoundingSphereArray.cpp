@@ -0,0 +1,63 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+#include <limits>
+
+#include "OvRendering/Geometry/BoundingSphereArray.h"
+
+void OvRendering::Geometry::BoundingSphereArray::Resize(size_t p_size)
+{
+	const size_t paddedSize = (p_size + PACK_SIZE - 1) / PACK_SIZE * PACK_SIZE;
+
+	/* Spheres beyond the previous size (Old padding included) are reset to never visible */
+	for (size_t i = p_size; i < std::min(m_radii.size(), paddedSize); ++i)
+		Set(i, OvMaths::FVector3(), -std::numeric_limits<float>::infinity());
+
+	m_x.resize(paddedSize, 0.0f);
+	m_y.resize(paddedSize, 0.0f);
+	m_z.resize(paddedSize, 0.0f);
+	m_radii.resize(paddedSize, -std::numeric_limits<float>::infinity());
+	m_size = p_size;
+}
+
+void OvRendering::Geometry::BoundingSphereArray::Set(size_t p_index, const OvMaths::FVector3& p_center, float p_radius)
+{
+	m_x[p_index] = p_center.x;
+	m_y[p_index] = p_center.y;
+	m_z[p_index] = p_center.z;
+	m_radii[p_index] = p_radius;
+}
+
+size_t OvRendering::Geometry::BoundingSphereArray::Size() const
+{
+	return m_size;
+}
+
+size_t OvRendering::Geometry::BoundingSphereArray::PaddedSize() const
+{
+	return m_radii.size();
+}
+
+const float* OvRendering::Geometry::BoundingSphereArray::GetX() const
+{
+	return m_x.data();
+}
+
+const float* OvRendering::Geometry::BoundingSphereArray::GetY() const
+{
+	return m_y.data();
+}
+
+const float* OvRendering::Geometry::BoundingSphereArray::GetZ() const
+{
+	return m_z.data();
+}
+
+const float* OvRendering::Geometry::BoundingSphereArray::GetRadii() const
+{
+	return m_radii.data();
+}
\ No newline at end of file
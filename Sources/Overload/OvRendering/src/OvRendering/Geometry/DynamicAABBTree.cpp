@@ -0,0 +1,377 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <algorithm>
+
+#include "OvRendering/Geometry/DynamicAABBTree.h"
+
+namespace
+{
+	using OvRendering::Geometry::BoundingBox;
+
+	BoundingBox Union(const BoundingBox& p_a, const BoundingBox& p_b)
+	{
+		return
+		{
+			{ std::min(p_a.min.x, p_b.min.x), std::min(p_a.min.y, p_b.min.y), std::min(p_a.min.z, p_b.min.z) },
+			{ std::max(p_a.max.x, p_b.max.x), std::max(p_a.max.y, p_b.max.y), std::max(p_a.max.z, p_b.max.z) }
+		};
+	}
+
+	bool Contains(const BoundingBox& p_container, const BoundingBox& p_box)
+	{
+		return
+			p_container.min.x <= p_box.min.x && p_container.min.y <= p_box.min.y && p_container.min.z <= p_box.min.z &&
+			p_box.max.x <= p_container.max.x && p_box.max.y <= p_container.max.y && p_box.max.z <= p_container.max.z;
+	}
+
+	/* Insertion cost metric (Surface area heuristic) */
+	float SurfaceArea(const BoundingBox& p_box)
+	{
+		const float dx = p_box.max.x - p_box.min.x;
+		const float dy = p_box.max.y - p_box.min.y;
+		const float dz = p_box.max.z - p_box.min.z;
+		return 2.0f * (dx * dy + dy * dz + dz * dx);
+	}
+}
+
+OvRendering::Geometry::DynamicAABBTree::DynamicAABBTree(float p_margin) :
+	m_margin(p_margin)
+{
+}
+
+int32_t OvRendering::Geometry::DynamicAABBTree::CreateProxy(const BoundingBox& p_box, uint32_t p_userData)
+{
+	const int32_t proxy = AllocateNode();
+	const OvMaths::FVector3 margin(m_margin, m_margin, m_margin);
+
+	m_nodes[proxy].box = { p_box.min - margin, p_box.max + margin };
+	m_nodes[proxy].userData = p_userData;
+	m_nodes[proxy].height = 0;
+
+	InsertLeaf(proxy);
+	++m_proxyCount;
+
+	return proxy;
+}
+
+void OvRendering::Geometry::DynamicAABBTree::DestroyProxy(int32_t p_proxy)
+{
+	RemoveLeaf(p_proxy);
+	FreeNode(p_proxy);
+	--m_proxyCount;
+}
+
+bool OvRendering::Geometry::DynamicAABBTree::MoveProxy(int32_t p_proxy, const BoundingBox& p_box)
+{
+	if (Contains(m_nodes[p_proxy].box, p_box))
+		return false;
+
+	const OvMaths::FVector3 margin(m_margin, m_margin, m_margin);
+
+	RemoveLeaf(p_proxy);
+	m_nodes[p_proxy].box = { p_box.min - margin, p_box.max + margin };
+	InsertLeaf(p_proxy);
+
+	return true;
+}
+
+uint32_t OvRendering::Geometry::DynamicAABBTree::GetUserData(int32_t p_proxy) const
+{
+	return m_nodes[p_proxy].userData;
+}
+
+uint32_t OvRendering::Geometry::DynamicAABBTree::GetProxyCount() const
+{
+	return m_proxyCount;
+}
+
+int32_t OvRendering::Geometry::DynamicAABBTree::GetHeight() const
+{
+	return m_root == NULL_NODE ? 0 : m_nodes[m_root].height;
+}
+
+void OvRendering::Geometry::DynamicAABBTree::QueryFrustum(const OvRendering::Data::Frustum& p_frustum, std::vector<uint32_t>& p_output) const
+{
+	Traverse([&p_frustum](const BoundingBox& p_box)
+	{
+		return p_frustum.BoxInFrustum(p_box.min, p_box.max);
+	}, p_output);
+}
+
+bool OvRendering::Geometry::DynamicAABBTree::IsLeaf(int32_t p_node) const
+{
+	return m_nodes[p_node].child1 == NULL_NODE;
+}
+
+template<typename Overlaps>
+void OvRendering::Geometry::DynamicAABBTree::Traverse(Overlaps p_overlaps, std::vector<uint32_t>& p_output) const
+{
+	if (m_root == NULL_NODE)
+		return;
+
+	std::vector<int32_t> stack;
+	stack.reserve(64);
+	stack.push_back(m_root);
+
+	while (!stack.empty())
+	{
+		const Node& node = m_nodes[stack.back()];
+		stack.pop_back();
+
+		if (p_overlaps(node.box))
+		{
+			if (node.child1 == NULL_NODE)
+			{
+				p_output.push_back(node.userData);
+			}
+			else
+			{
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+}
+
+int32_t OvRendering::Geometry::DynamicAABBTree::AllocateNode()
+{
+	if (m_freeList == NULL_NODE)
+	{
+		m_nodes.emplace_back();
+		return static_cast<int32_t>(m_nodes.size() - 1);
+	}
+
+	const int32_t node = m_freeList;
+	m_freeList = m_nodes[node].parent;
+	m_nodes[node] = Node();
+	return node;
+}
+
+void OvRendering::Geometry::DynamicAABBTree::FreeNode(int32_t p_node)
+{
+	m_nodes[p_node].parent = m_freeList;
+	m_nodes[p_node].height = -1;
+	m_freeList = p_node;
+}
+
+void OvRendering::Geometry::DynamicAABBTree::InsertLeaf(int32_t p_leaf)
+{
+	if (m_root == NULL_NODE)
+	{
+		m_root = p_leaf;
+		m_nodes[m_root].parent = NULL_NODE;
+		return;
+	}
+
+	/* Find the best sibling by descending the tree, following the cheapest surface area increase */
+	const BoundingBox leafBox = m_nodes[p_leaf].box;
+	int32_t index = m_root;
+
+	while (!IsLeaf(index))
+	{
+		const Node& node = m_nodes[index];
+
+		const float area = SurfaceArea(node.box);
+		const float combinedArea = SurfaceArea(Union(node.box, leafBox));
+
+		/* Cost of creating a new parent for this node and the new leaf, and minimum cost of pushing the leaf further down */
+		const float cost = 2.0f * combinedArea;
+		const float inheritanceCost = 2.0f * (combinedArea - area);
+
+		const auto childCost = [&](int32_t p_child)
+		{
+			const float unionArea = SurfaceArea(Union(leafBox, m_nodes[p_child].box));
+			return IsLeaf(p_child) ? unionArea + inheritanceCost : unionArea - SurfaceArea(m_nodes[p_child].box) + inheritanceCost;
+		};
+
+		const float cost1 = childCost(node.child1);
+		const float cost2 = childCost(node.child2);
+
+		if (cost < cost1 && cost < cost2)
+			break;
+
+		index = cost1 < cost2 ? node.child1 : node.child2;
+	}
+
+	const int32_t sibling = index;
+
+	/* AllocateNode can grow the node vector, no node reference is kept across this call */
+	const int32_t oldParent = m_nodes[sibling].parent;
+	const int32_t newParent = AllocateNode();
+
+	m_nodes[newParent].parent = oldParent;
+	m_nodes[newParent].box = Union(leafBox, m_nodes[sibling].box);
+	m_nodes[newParent].height = m_nodes[sibling].height + 1;
+	m_nodes[newParent].child1 = sibling;
+	m_nodes[newParent].child2 = p_leaf;
+	m_nodes[sibling].parent = newParent;
+	m_nodes[p_leaf].parent = newParent;
+
+	if (oldParent != NULL_NODE)
+	{
+		if (m_nodes[oldParent].child1 == sibling)
+			m_nodes[oldParent].child1 = newParent;
+		else
+			m_nodes[oldParent].child2 = newParent;
+	}
+	else
+	{
+		m_root = newParent;
+	}
+
+	RefitAncestors(m_nodes[p_leaf].parent);
+}
+
+void OvRendering::Geometry::DynamicAABBTree::RemoveLeaf(int32_t p_leaf)
+{
+	if (p_leaf == m_root)
+	{
+		m_root = NULL_NODE;
+		return;
+	}
+
+	const int32_t parent = m_nodes[p_leaf].parent;
+	const int32_t grandParent = m_nodes[parent].parent;
+	const int32_t sibling = m_nodes[parent].child1 == p_leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+	if (grandParent != NULL_NODE)
+	{
+		/* The sibling takes the place of the parent */
+		if (m_nodes[grandParent].child1 == parent)
+			m_nodes[grandParent].child1 = sibling;
+		else
+			m_nodes[grandParent].child2 = sibling;
+
+		m_nodes[sibling].parent = grandParent;
+		FreeNode(parent);
+
+		RefitAncestors(grandParent);
+	}
+	else
+	{
+		m_root = sibling;
+		m_nodes[sibling].parent = NULL_NODE;
+		FreeNode(parent);
+	}
+}
+
+void OvRendering::Geometry::DynamicAABBTree::RefitAncestors(int32_t p_node)
+{
+	for (int32_t index = p_node; index != NULL_NODE; index = m_nodes[index].parent)
+	{
+		index = Balance(index);
+
+		Node& node = m_nodes[index];
+		node.height = 1 + std::max(m_nodes[node.child1].height, m_nodes[node.child2].height);
+		node.box = Union(m_nodes[node.child1].box, m_nodes[node.child2].box);
+	}
+}
+
+int32_t OvRendering::Geometry::DynamicAABBTree::Balance(int32_t p_node)
+{
+	/* Rotate the highest child of an unbalanced node up. Returns the node that took the place of the given one */
+	const int32_t iA = p_node;
+	Node& A = m_nodes[iA];
+
+	if (IsLeaf(iA) || A.height < 2)
+		return iA;
+
+	const int32_t iB = A.child1;
+	const int32_t iC = A.child2;
+	Node& B = m_nodes[iB];
+	Node& C = m_nodes[iC];
+
+	const int32_t balance = C.height - B.height;
+
+	const auto replaceInParent = [this, iA](int32_t p_newChild)
+	{
+		const int32_t parent = m_nodes[p_newChild].parent;
+
+		if (parent == NULL_NODE)
+			m_root = p_newChild;
+		else if (m_nodes[parent].child1 == iA)
+			m_nodes[parent].child1 = p_newChild;
+		else
+			m_nodes[parent].child2 = p_newChild;
+	};
+
+	if (balance > 1)
+	{
+		/* Rotate C up */
+		const int32_t iF = C.child1;
+		const int32_t iG = C.child2;
+		Node& F = m_nodes[iF];
+		Node& G = m_nodes[iG];
+
+		C.child1 = iA;
+		C.parent = A.parent;
+		A.parent = iC;
+		replaceInParent(iC);
+
+		if (F.height > G.height)
+		{
+			C.child2 = iF;
+			A.child2 = iG;
+			G.parent = iA;
+			A.box = Union(B.box, G.box);
+			C.box = Union(A.box, F.box);
+			A.height = 1 + std::max(B.height, G.height);
+			C.height = 1 + std::max(A.height, F.height);
+		}
+		else
+		{
+			C.child2 = iG;
+			A.child2 = iF;
+			F.parent = iA;
+			A.box = Union(B.box, F.box);
+			C.box = Union(A.box, G.box);
+			A.height = 1 + std::max(B.height, F.height);
+			C.height = 1 + std::max(A.height, G.height);
+		}
+
+		return iC;
+	}
+
+	if (balance < -1)
+	{
+		/* Rotate B up */
+		const int32_t iD = B.child1;
+		const int32_t iE = B.child2;
+		Node& D = m_nodes[iD];
+		Node& E = m_nodes[iE];
+
+		B.child1 = iA;
+		B.parent = A.parent;
+		A.parent = iB;
+		replaceInParent(iB);
+
+		if (D.height > E.height)
+		{
+			B.child2 = iD;
+			A.child1 = iE;
+			E.parent = iA;
+			A.box = Union(C.box, E.box);
+			B.box = Union(A.box, D.box);
+			A.height = 1 + std::max(C.height, E.height);
+			B.height = 1 + std::max(A.height, D.height);
+		}
+		else
+		{
+			B.child2 = iE;
+			A.child1 = iD;
+			D.parent = iA;
+			A.box = Union(C.box, D.box);
+			B.box = Union(A.box, E.box);
+			A.height = 1 + std::max(C.height, D.height);
+			B.height = 1 + std::max(A.height, E.height);
+		}
+
+		return iB;
+	}
+
+	return iA;
+}
\ No newline at end of file
@@ -0,0 +1,175 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+#include "OvRendering/Geometry/VertexFormat.h"
+#include "OvRendering/Resources/Mesh.h"
+
+namespace
+{
+	/* IEEE 754 binary16 conversion, rounded to nearest even. Out of range values become infinities */
+	uint16_t FloatToHalf(float p_value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &p_value, sizeof(float));
+
+		const uint32_t sign = (bits >> 16) & 0x8000;
+		const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xFF);
+		uint32_t mantissa = bits & 0x7FFFFF;
+
+		if (exponent == 0xFF)
+			return static_cast<uint16_t>(sign | 0x7C00 | (mantissa ? 0x200 : 0));
+
+		const int32_t halfExponent = exponent - 127 + 15;
+
+		if (halfExponent >= 0x1F)
+			return static_cast<uint16_t>(sign | 0x7C00);
+
+		uint32_t shift = 13;
+		uint32_t half;
+
+		if (halfExponent > 0)
+		{
+			half = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> shift);
+		}
+		else
+		{
+			/* Subnormal half, the implicit bit of the float mantissa becomes explicit */
+			if (halfExponent < -10)
+				return static_cast<uint16_t>(sign);
+
+			mantissa |= 0x800000;
+			shift = static_cast<uint32_t>(14 - halfExponent);
+			half = mantissa >> shift;
+		}
+
+		/* A carry out of the mantissa correctly moves to the next exponent (Or to infinity) */
+		const uint32_t remainder = mantissa & ((1u << shift) - 1);
+		const uint32_t halfway = 1u << (shift - 1);
+
+		if (remainder > halfway || (remainder == halfway && (half & 1)))
+			++half;
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	/* Two's complement signed normalized integer on 10 bits */
+	uint32_t ToSnorm10(float p_value)
+	{
+		const int32_t value = static_cast<int32_t>(std::lround(std::clamp(p_value, -1.0f, 1.0f) * 511.0f));
+		return static_cast<uint32_t>(value) & 0x3FF;
+	}
+
+	void Normalize(float (&p_vector)[3], const float* p_source)
+	{
+		const float length = std::sqrt(p_source[0] * p_source[0] + p_source[1] * p_source[1] + p_source[2] * p_source[2]);
+		const float scale = length > 0.0f ? 1.0f / length : 0.0f;
+
+		for (int i = 0; i < 3; ++i)
+			p_vector[i] = p_source[i] * scale;
+	}
+
+	/* x, y and z on 10 bits each, w on the 2 remaining bits (1 or -1) */
+	uint32_t PackDirection(const float (&p_direction)[3], bool p_negativeW)
+	{
+		return ToSnorm10(p_direction[0]) | (ToSnorm10(p_direction[1]) << 10) | (ToSnorm10(p_direction[2]) << 20) | ((p_negativeW ? 0x3u : 0x1u) << 30);
+	}
+}
+
+uint32_t OvRendering::Geometry::VertexFormat::GetVertexSize(EVertexFormat p_format)
+{
+	switch (p_format)
+	{
+	case EVertexFormat::COMPRESSED:	return sizeof(PackedVertex);
+	case EVertexFormat::STANDARD:
+	default:						return sizeof(Vertex);
+	}
+}
+
+uint32_t OvRendering::Geometry::VertexFormat::GetIndexSize(Buffers::EType p_indexType)
+{
+	switch (p_indexType)
+	{
+	case Buffers::EType::UNSIGNED_SHORT:	return sizeof(uint16_t);
+	case Buffers::EType::UNSIGNED_INT:		return sizeof(uint32_t);
+	default:								return 0;
+	}
+}
+
+OvRendering::Geometry::PackedVertex OvRendering::Geometry::VertexFormat::Pack(const Vertex& p_vertex)
+{
+	PackedVertex result;
+
+	std::memcpy(result.position, p_vertex.position, sizeof(result.position));
+	result.texCoords[0] = FloatToHalf(p_vertex.texCoords[0]);
+	result.texCoords[1] = FloatToHalf(p_vertex.texCoords[1]);
+
+	float normal[3];
+	float tangent[3];
+	Normalize(normal, p_vertex.normals);
+	Normalize(tangent, p_vertex.tangent);
+
+	/* Mirrored UVs give a bitangent opposed to cross(normal, tangent), which is all the shaders need to know */
+	const float cross[3] =
+	{
+		normal[1] * tangent[2] - normal[2] * tangent[1],
+		normal[2] * tangent[0] - normal[0] * tangent[2],
+		normal[0] * tangent[1] - normal[1] * tangent[0]
+	};
+
+	const float handedness = cross[0] * p_vertex.bitangent[0] + cross[1] * p_vertex.bitangent[1] + cross[2] * p_vertex.bitangent[2];
+
+	result.normal = PackDirection(normal, false);
+	result.tangent = PackDirection(tangent, handedness < 0.0f);
+
+	return result;
+}
+
+OvRendering::Geometry::PackedMesh OvRendering::Geometry::VertexFormat::Pack(const Vertex* p_vertices, uint32_t p_vertexCount, const uint32_t* p_indices, uint32_t p_indexCount, uint32_t p_materialIndex, EVertexFormat p_format)
+{
+	PackedMesh result;
+	result.vertexFormat = p_format;
+	result.vertexCount = p_vertexCount;
+	result.indexCount = p_indexCount;
+	result.materialIndex = p_materialIndex;
+	result.boundingSphere = Resources::Mesh::ComputeBoundingSphere(p_vertices, p_vertexCount);
+
+	if (p_format == EVertexFormat::COMPRESSED)
+	{
+		result.vertices.resize(static_cast<size_t>(p_vertexCount) * sizeof(PackedVertex));
+		auto packedVertices = reinterpret_cast<PackedVertex*>(result.vertices.data());
+
+		for (uint32_t i = 0; i < p_vertexCount; ++i)
+			packedVertices[i] = Pack(p_vertices[i]);
+	}
+	else
+	{
+		const char* bytes = reinterpret_cast<const char*>(p_vertices);
+		result.vertices.assign(bytes, bytes + static_cast<size_t>(p_vertexCount) * sizeof(Vertex));
+	}
+
+	/* Every index of a mesh of at most 65536 vertices fits in 16 bits */
+	if (p_format == EVertexFormat::COMPRESSED && p_vertexCount <= 0x10000)
+	{
+		result.indexType = Buffers::EType::UNSIGNED_SHORT;
+		result.indices.resize(static_cast<size_t>(p_indexCount) * sizeof(uint16_t));
+		auto shortIndices = reinterpret_cast<uint16_t*>(result.indices.data());
+
+		for (uint32_t i = 0; i < p_indexCount; ++i)
+			shortIndices[i] = static_cast<uint16_t>(p_indices[i]);
+	}
+	else
+	{
+		result.indexType = Buffers::EType::UNSIGNED_INT;
+		const char* bytes = reinterpret_cast<const char*>(p_indices);
+		result.indices.assign(bytes, bytes + static_cast<size_t>(p_indexCount) * sizeof(uint32_t));
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -4,28 +4,136 @@
 * @licence: MIT
 */
 
+#include <fstream>
+#include <filesystem>
+
 #include "OvRendering/Resources/Loaders/ModelLoader.h"
 
 OvRendering::Resources::Parsers::AssimpParser OvRendering::Resources::Loaders::ModelLoader::__ASSIMP;
 
-OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags)
+bool OvRendering::Resources::Loaders::ModelLoader::Decode(const std::string& p_filepath, ModelData& p_outData, Parsers::EModelParserFlags p_parserFlags, Geometry::EVertexFormat p_vertexFormat)
+{
+	std::vector<Parsers::MeshData> meshes;
+
+	/* The parser keeps no state between two loads, so workers can share it */
+	if (!__ASSIMP.LoadModel(p_filepath, meshes, p_outData.materialNames, p_parserFlags))
+		return false;
+
+	p_outData.meshes.reserve(meshes.size());
+
+	for (const auto& mesh : meshes)
+	{
+		p_outData.meshes.push_back(Geometry::VertexFormat::Pack
+		(
+			mesh.vertices.data(), static_cast<uint32_t>(mesh.vertices.size()),
+			mesh.indices.data(), static_cast<uint32_t>(mesh.indices.size()),
+			mesh.materialIndex,
+			p_vertexFormat
+		));
+	}
+
+	return true;
+}
+
+OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Upload(const std::string& p_filepath, const ModelData& p_data)
 {
 	Model* result = new Model(p_filepath);
 
-	if (__ASSIMP.LoadModel(p_filepath, result->m_meshes, result->m_materialNames, p_parserFlags))
+	result->m_materialNames = p_data.materialNames;
+	result->m_meshes.reserve(p_data.meshes.size());
+
+	for (const auto& mesh : p_data.meshes)
+		result->m_meshes.push_back(new Mesh(mesh)); // The model will handle mesh destruction
+
+	result->ComputeBoundingSphere();
+
+	return result;
+}
+
+OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Upload(const std::string& p_filepath, const Parsers::CookedModel& p_cookedModel)
+{
+	Model* result = new Model(p_filepath);
+
+	result->m_materialNames = p_cookedModel.GetMaterialNames();
+	result->m_meshes.reserve(p_cookedModel.GetMeshCount());
+
+	for (uint32_t i = 0; i < p_cookedModel.GetMeshCount(); ++i)
 	{
-		result->ComputeBoundingSphere();
-		return result;
+		const auto& mesh = p_cookedModel.GetMesh(i);
+		result->m_meshes.push_back(new Mesh
+		(
+			p_cookedModel.GetVertexFormat(i),
+			p_cookedModel.GetVertices(i), mesh.vertexCount,
+			p_cookedModel.GetIndices(i), p_cookedModel.GetIndexType(i), mesh.indexCount,
+			mesh.materialIndex,
+			p_cookedModel.GetBoundingSphere(i)
+		));
 	}
 
-	delete result;
+	result->ComputeBoundingSphere();
+
+	return result;
+}
+
+bool OvRendering::Resources::Loaders::ModelLoader::Cook(const std::string& p_filepath, const std::string& p_destinationPath, Parsers::EModelParserFlags p_parserFlags, Geometry::EVertexFormat p_vertexFormat)
+{
+	ModelData data;
+
+	if (!Decode(p_filepath, data, p_parserFlags, p_vertexFormat))
+		return false;
+
+	const std::vector<char> cooked = Parsers::CookedModel::Cook(data.meshes, data.materialNames, ComputeSourceKey(p_filepath, p_parserFlags, p_vertexFormat));
+
+	std::ofstream file(p_destinationPath, std::ios::binary | std::ios::trunc);
+	file.write(cooked.data(), cooked.size());
+
+	return static_cast<bool>(file);
+}
+
+uint64_t OvRendering::Resources::Loaders::ModelLoader::ComputeSourceKey(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags, Geometry::EVertexFormat p_vertexFormat)
+{
+	/* FNV-1a over the file size and last write time (A stat, the content isn't read), then over the settings */
+	uint64_t key = 14695981039346656037ULL;
+
+	const auto hash = [&key](const char* p_data, size_t p_size)
+	{
+		for (size_t i = 0; i < p_size; ++i)
+		{
+			key ^= static_cast<uint8_t>(p_data[i]);
+			key *= 1099511628211ULL;
+		}
+	};
+
+	std::error_code error;
+	const uint64_t version[2] =
+	{
+		static_cast<uint64_t>(std::filesystem::file_size(p_filepath, error)),
+		static_cast<uint64_t>(std::filesystem::last_write_time(p_filepath, error).time_since_epoch().count())
+	};
+	hash(reinterpret_cast<const char*>(version), sizeof(version));
+
+	const uint64_t flags = static_cast<uint64_t>(p_parserFlags);
+	hash(reinterpret_cast<const char*>(&flags), sizeof(flags));
+
+	const uint32_t vertexFormat = static_cast<uint32_t>(p_vertexFormat);
+	hash(reinterpret_cast<const char*>(&vertexFormat), sizeof(vertexFormat));
+
+	return key;
+}
+
+OvRendering::Resources::Model* OvRendering::Resources::Loaders::ModelLoader::Create(const std::string& p_filepath, Parsers::EModelParserFlags p_parserFlags, Geometry::EVertexFormat p_vertexFormat)
+{
+	ModelData data;
+
+	if (Decode(p_filepath, data, p_parserFlags, p_vertexFormat))
+		return Upload(p_filepath, data);
 
 	return nullptr;
 }
 
-void OvRendering::Resources::Loaders::ModelLoader::Reload(Model& p_model, const std::string& p_filePath, Parsers::EModelParserFlags p_parserFlags)
+void OvRendering::Resources::Loaders::ModelLoader::Reload(Model& p_model, const std::string& p_filePath, Parsers::EModelParserFlags p_parserFlags, Geometry::EVertexFormat p_vertexFormat)
 {
-	Model* newModel = Create(p_filePath, p_parserFlags);
+	Model* newModel = Create(p_filePath, p_parserFlags, p_vertexFormat);
 
 	if (newModel)
 	{
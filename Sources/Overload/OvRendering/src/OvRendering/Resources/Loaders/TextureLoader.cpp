@@ -6,49 +6,165 @@
 
 #define STB_IMAGE_IMPLEMENTATION
 
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
 #include <GL/glew.h>
 #include <stb_image/stb_image.h>
 
 #include "OvRendering/Resources/Loaders/TextureLoader.h"
 
-OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+namespace
+{
+	GLenum GetCompressedFormat(OvRendering::Settings::ETextureCompression p_compression)
+	{
+		switch (p_compression)
+		{
+		case OvRendering::Settings::ETextureCompression::BC1:	return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		case OvRendering::Settings::ETextureCompression::BC3:	return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		case OvRendering::Settings::ETextureCompression::BC5:	return GL_COMPRESSED_RG_RGTC2;
+		case OvRendering::Settings::ETextureCompression::BC7:	return GL_COMPRESSED_RGBA_BPTC_UNORM;
+		default:												return GL_NONE;
+		}
+	}
+}
+
+bool OvRendering::Resources::Loaders::TextureLoader::Decode(const std::string& p_filePath, TextureData& p_outData)
 {
-	GLuint textureID;
 	int textureWidth;
 	int textureHeight;
 	int bitsPerPixel;
+
+	unsigned char* dataBuffer = stbi_load(p_filePath.c_str(), &textureWidth, &textureHeight, &bitsPerPixel, 4);
+
+	if (!dataBuffer)
+		return false;
+
+	p_outData.width = static_cast<uint32_t>(textureWidth);
+	p_outData.height = static_cast<uint32_t>(textureHeight);
+	p_outData.bitsPerPixel = static_cast<uint32_t>(bitsPerPixel);
+	p_outData.pixels.resize(static_cast<size_t>(p_outData.width) * p_outData.height * 4);
+
+	/* Rows are flipped here rather than with stbi_set_flip_vertically_on_load, which is a global setting shared by every thread */
+	const size_t rowSize = static_cast<size_t>(p_outData.width) * 4;
+
+	for (size_t row = 0; row < p_outData.height; ++row)
+		std::memcpy(p_outData.pixels.data() + row * rowSize, dataBuffer + (p_outData.height - 1 - row) * rowSize, rowSize);
+
+	stbi_image_free(dataBuffer);
+
+	return true;
+}
+
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Upload(const std::string& p_filePath, const TextureData& p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+{
+	GLuint textureID;
 	glGenTextures(1, &textureID);
+	glBindTexture(GL_TEXTURE_2D, textureID);
 
-	stbi_set_flip_vertically_on_load(true);
-	unsigned char* dataBuffer = stbi_load(p_filepath.c_str(), &textureWidth, &textureHeight, &bitsPerPixel, 4);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, p_data.width, p_data.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, p_data.pixels.data());
 
-	if (dataBuffer)
+	if (p_generateMipmap)
 	{
-		glBindTexture(GL_TEXTURE_2D, textureID);
+		glGenerateMipmap(GL_TEXTURE_2D);
+	}
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(p_firstFilter));
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(p_secondFilter));
 
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, textureWidth, textureHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, dataBuffer);
+	glBindTexture(GL_TEXTURE_2D, 0);
 
-		if (p_generateMipmap)
-		{
-			glGenerateMipmap(GL_TEXTURE_2D);
-		}
-		
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(p_firstFilter));
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(p_secondFilter));
+	return new Texture(p_filePath, textureID, p_data.width, p_data.height, p_data.bitsPerPixel, p_firstFilter, p_secondFilter, p_generateMipmap);
+}
 
-		stbi_image_free(dataBuffer);
-		glBindTexture(GL_TEXTURE_2D, 0);
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Upload(const std::string& p_filePath, const Parsers::CookedTexture& p_cookedTexture, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter)
+{
+	const auto compression = p_cookedTexture.GetCompression();
+	const uint32_t mipCount = p_cookedTexture.GetMipCount();
 
-		return new Texture(p_filepath, textureID, textureWidth, textureHeight, bitsPerPixel, p_firstFilter, p_secondFilter, p_generateMipmap);
-	}
-	else
+	GLuint textureID;
+	glGenTextures(1, &textureID);
+	glBindTexture(GL_TEXTURE_2D, textureID);
+
+	/* The texture is complete with the cooked levels only, even if the filter expects mipmaps and none has been cooked */
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mipCount - 1));
+
+	for (uint32_t level = 0; level < mipCount; ++level)
 	{
-		stbi_image_free(dataBuffer);
-		glBindTexture(GL_TEXTURE_2D, 0);
-		return nullptr;
+		const auto& mip = p_cookedTexture.GetMip(level);
+
+		if (compression == Settings::ETextureCompression::NONE)
+			glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, mip.width, mip.height, 0, GL_RGBA, GL_UNSIGNED_BYTE, p_cookedTexture.GetMipData(level));
+		else
+			glCompressedTexImage2D(GL_TEXTURE_2D, level, GetCompressedFormat(compression), mip.width, mip.height, 0, static_cast<GLsizei>(mip.size), p_cookedTexture.GetMipData(level));
 	}
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(p_firstFilter));
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, static_cast<GLint>(p_secondFilter));
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+
+	const auto& baseLevel = p_cookedTexture.GetMip(0);
+	return new Texture(p_filePath, textureID, baseLevel.width, baseLevel.height, p_cookedTexture.GetBitsPerPixel(), p_firstFilter, p_secondFilter, mipCount > 1, compression);
+}
+
+bool OvRendering::Resources::Loaders::TextureLoader::Cook(const std::string& p_filePath, const std::string& p_destinationPath, OvRendering::Settings::ETextureCompression p_compression, bool p_generateMipmap)
+{
+	TextureData data;
+
+	if (!Decode(p_filePath, data))
+		return false;
+
+	const std::vector<char> cooked = Parsers::CookedTexture::Cook(data.pixels.data(), data.width, data.height, data.bitsPerPixel, p_compression, p_generateMipmap, ComputeSourceKey(p_filePath, p_compression, p_generateMipmap));
+
+	std::ofstream file(p_destinationPath, std::ios::binary | std::ios::trunc);
+	file.write(cooked.data(), cooked.size());
+
+	return static_cast<bool>(file);
+}
+
+uint64_t OvRendering::Resources::Loaders::TextureLoader::ComputeSourceKey(const std::string& p_filePath, OvRendering::Settings::ETextureCompression p_compression, bool p_generateMipmap)
+{
+	/* FNV-1a over the file size and last write time (A stat, the content isn't read), then over the settings */
+	uint64_t key = 14695981039346656037ULL;
+
+	const auto hash = [&key](const char* p_data, size_t p_size)
+	{
+		for (size_t i = 0; i < p_size; ++i)
+		{
+			key ^= static_cast<uint8_t>(p_data[i]);
+			key *= 1099511628211ULL;
+		}
+	};
+
+	std::error_code error;
+	const uint64_t version[2] =
+	{
+		static_cast<uint64_t>(std::filesystem::file_size(p_filePath, error)),
+		static_cast<uint64_t>(std::filesystem::last_write_time(p_filePath, error).time_since_epoch().count())
+	};
+	hash(reinterpret_cast<const char*>(version), sizeof(version));
+
+	const uint32_t settings[2] = { static_cast<uint32_t>(p_compression), p_generateMipmap ? 1u : 0u };
+	hash(reinterpret_cast<const char*>(settings), sizeof(settings));
+
+	return key;
+}
+
+OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::Create(const std::string& p_filepath, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
+{
+	TextureData data;
+
+	if (Decode(p_filepath, data))
+		return Upload(p_filepath, data, p_firstFilter, p_secondFilter, p_generateMipmap);
+
+	return nullptr;
 }
 
 OvRendering::Resources::Texture* OvRendering::Resources::Loaders::TextureLoader::CreateColor(uint32_t p_data, OvRendering::Settings::ETextureFilteringMode p_firstFilter, OvRendering::Settings::ETextureFilteringMode p_secondFilter, bool p_generateMipmap)
@@ -112,6 +228,7 @@ void OvRendering::Resources::Loaders::TextureLoader::Reload(Texture& p_texture,
 		*const_cast<Settings::ETextureFilteringMode*>(&p_texture.firstFilter) = newTexture->firstFilter;
 		*const_cast<Settings::ETextureFilteringMode*>(&p_texture.secondFilter) = newTexture->secondFilter;
 		*const_cast<bool*>(&p_texture.isMimapped) = newTexture->isMimapped;
+		*const_cast<Settings::ETextureCompression*>(&p_texture.compression) = newTexture->compression;
 		delete newTexture;
 	}
 }
@@ -5,16 +5,47 @@
 */
 
 #include <algorithm>
+#include <cstddef>
 
 #include "OvRendering/Resources/Mesh.h"
 
 OvRendering::Resources::Mesh::Mesh(const std::vector<Geometry::Vertex>& p_vertices, const std::vector<uint32_t>& p_indices, uint32_t p_materialIndex) :
-	m_vertexCount(static_cast<uint32_t>(p_vertices.size())),
-	m_indicesCount(static_cast<uint32_t>(p_indices.size())),
-	m_materialIndex(p_materialIndex)
+	Mesh
+	(
+		p_vertices.data(), static_cast<uint32_t>(p_vertices.size()),
+		p_indices.data(), static_cast<uint32_t>(p_indices.size()),
+		p_materialIndex,
+		ComputeBoundingSphere(p_vertices.data(), static_cast<uint32_t>(p_vertices.size()))
+	)
+{
+}
+
+OvRendering::Resources::Mesh::Mesh(const Geometry::Vertex* p_vertices, uint32_t p_vertexCount, const uint32_t* p_indices, uint32_t p_indexCount, uint32_t p_materialIndex, const Geometry::BoundingSphere& p_boundingSphere) :
+	Mesh(Geometry::EVertexFormat::STANDARD, p_vertices, p_vertexCount, p_indices, Buffers::EType::UNSIGNED_INT, p_indexCount, p_materialIndex, p_boundingSphere)
+{
+}
+
+OvRendering::Resources::Mesh::Mesh(Geometry::EVertexFormat p_vertexFormat, const void* p_vertices, uint32_t p_vertexCount, const void* p_indices, Buffers::EType p_indexType, uint32_t p_indexCount, uint32_t p_materialIndex, const Geometry::BoundingSphere& p_boundingSphere) :
+	m_vertexCount(p_vertexCount),
+	m_indicesCount(p_indexCount),
+	m_materialIndex(p_materialIndex),
+	m_vertexFormat(p_vertexFormat),
+	m_indexType(p_indexType),
+	m_boundingSphere(p_boundingSphere)
 {
 	CreateBuffers(p_vertices, p_indices);
-	ComputeBoundingSphere(p_vertices);
+}
+
+OvRendering::Resources::Mesh::Mesh(const Geometry::PackedMesh& p_packedMesh) :
+	Mesh
+	(
+		p_packedMesh.vertexFormat,
+		p_packedMesh.vertices.data(), p_packedMesh.vertexCount,
+		p_packedMesh.indices.data(), p_packedMesh.indexType, p_packedMesh.indexCount,
+		p_packedMesh.materialIndex,
+		p_packedMesh.boundingSphere
+	)
+{
 }
 
 void OvRendering::Resources::Mesh::Bind()
@@ -37,6 +68,16 @@ uint32_t OvRendering::Resources::Mesh::GetIndexCount()
 	return m_indicesCount;
 }
 
+OvRendering::Buffers::EType OvRendering::Resources::Mesh::GetIndexType()
+{
+	return m_indexType;
+}
+
+OvRendering::Geometry::EVertexFormat OvRendering::Resources::Mesh::GetVertexFormat() const
+{
+	return m_vertexFormat;
+}
+
 uint32_t OvRendering::Resources::Mesh::GetMaterialIndex() const
 {
 	return m_materialIndex;
@@ -47,52 +88,48 @@ const OvRendering::Geometry::BoundingSphere& OvRendering::Resources::Mesh::GetBo
 	return m_boundingSphere;
 }
 
-void OvRendering::Resources::Mesh::CreateBuffers(const std::vector<Geometry::Vertex>& p_vertices, const std::vector<uint32_t>& p_indices)
+void OvRendering::Resources::Mesh::CreateBuffers(const void* p_vertices, const void* p_indices)
 {
-	std::vector<float> vertexData;
-
-	std::vector<unsigned int> rawIndices;
-
-	for (const auto& vertex : p_vertices)
-	{
-		vertexData.push_back(vertex.position[0]);
-		vertexData.push_back(vertex.position[1]);
-		vertexData.push_back(vertex.position[2]);
+	static_assert(sizeof(Geometry::Vertex) == sizeof(float) * 14, "The vertex attributes bound below expect tightly packed vertices");
 
-		vertexData.push_back(vertex.texCoords[0]);
-		vertexData.push_back(vertex.texCoords[1]);
+	const uint64_t vertexSize = Geometry::VertexFormat::GetVertexSize(m_vertexFormat);
 
-		vertexData.push_back(vertex.normals[0]);
-		vertexData.push_back(vertex.normals[1]);
-		vertexData.push_back(vertex.normals[2]);
+	/* Vertices are already laid out as the attributes expect them, so they are uploaded without conversion */
+	m_vertexBuffer = std::make_unique<Buffers::VertexBuffer<uint8_t>>(static_cast<uint8_t*>(const_cast<void*>(p_vertices)), static_cast<size_t>(m_vertexCount) * vertexSize);
 
-		vertexData.push_back(vertex.tangent[0]);
-		vertexData.push_back(vertex.tangent[1]);
-		vertexData.push_back(vertex.tangent[2]);
+	if (m_indexType == Buffers::EType::UNSIGNED_SHORT)
+		m_indexBuffer = std::make_unique<Buffers::IndexBuffer>(static_cast<uint16_t*>(const_cast<void*>(p_indices)), m_indicesCount);
+	else
+		m_indexBuffer = std::make_unique<Buffers::IndexBuffer>(static_cast<uint32_t*>(const_cast<void*>(p_indices)), m_indicesCount);
 
-		vertexData.push_back(vertex.bitangent[0]);
-		vertexData.push_back(vertex.bitangent[1]);
-		vertexData.push_back(vertex.bitangent[2]);
+	switch (m_vertexFormat)
+	{
+	case Geometry::EVertexFormat::COMPRESSED:
+		/* Normal and tangent are decoded to [-1, 1] by the vertex fetch. The bitangent is left unbound, the shaders rebuild it */
+		m_vertexArray.BindAttribute(0, *m_vertexBuffer, Buffers::EType::FLOAT,			3, vertexSize, offsetof(Geometry::PackedVertex, position));
+		m_vertexArray.BindAttribute(1, *m_vertexBuffer, Buffers::EType::HALF_FLOAT,		2, vertexSize, offsetof(Geometry::PackedVertex, texCoords));
+		m_vertexArray.BindAttribute(2, *m_vertexBuffer, Buffers::EType::INT_2_10_10_10,	4, vertexSize, offsetof(Geometry::PackedVertex, normal), true);
+		m_vertexArray.BindAttribute(3, *m_vertexBuffer, Buffers::EType::INT_2_10_10_10,	4, vertexSize, offsetof(Geometry::PackedVertex, tangent), true);
+		break;
+
+	case Geometry::EVertexFormat::STANDARD:
+	default:
+		m_vertexArray.BindAttribute(0, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, 0);
+		m_vertexArray.BindAttribute(1, *m_vertexBuffer,	Buffers::EType::FLOAT, 2, vertexSize, sizeof(float) * 3);
+		m_vertexArray.BindAttribute(2, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 5);
+		m_vertexArray.BindAttribute(3, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 8);
+		m_vertexArray.BindAttribute(4, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 11);
+		break;
 	}
-
-	m_vertexBuffer	= std::make_unique<Buffers::VertexBuffer<float>>(vertexData);
-	m_indexBuffer	= std::make_unique<Buffers::IndexBuffer>(const_cast<uint32_t*>(p_indices.data()), p_indices.size());
-
-	uint64_t vertexSize = sizeof(Geometry::Vertex);
-
-	m_vertexArray.BindAttribute(0, *m_vertexBuffer, Buffers::EType::FLOAT, 3, vertexSize, 0);
-	m_vertexArray.BindAttribute(1, *m_vertexBuffer,	Buffers::EType::FLOAT, 2, vertexSize, sizeof(float) * 3);
-	m_vertexArray.BindAttribute(2, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 5);
-	m_vertexArray.BindAttribute(3, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 8);
-	m_vertexArray.BindAttribute(4, *m_vertexBuffer,	Buffers::EType::FLOAT, 3, vertexSize, sizeof(float) * 11);
 }
 
-void OvRendering::Resources::Mesh::ComputeBoundingSphere(const std::vector<Geometry::Vertex>& p_vertices)
+OvRendering::Geometry::BoundingSphere OvRendering::Resources::Mesh::ComputeBoundingSphere(const Geometry::Vertex* p_vertices, uint32_t p_vertexCount)
 {
-	m_boundingSphere.position = OvMaths::FVector3::Zero;
-	m_boundingSphere.radius = 0.0f;
+	Geometry::BoundingSphere boundingSphere;
+	boundingSphere.position = OvMaths::FVector3::Zero;
+	boundingSphere.radius = 0.0f;
 
-	if (!p_vertices.empty())
+	if (p_vertexCount > 0)
 	{
 		float minX = std::numeric_limits<float>::max();
 		float minY = std::numeric_limits<float>::max();
@@ -102,8 +139,10 @@ void OvRendering::Resources::Mesh::ComputeBoundingSphere(const std::vector<Geome
 		float maxY = std::numeric_limits<float>::min();
 		float maxZ = std::numeric_limits<float>::min();
 
-		for (const auto& vertex : p_vertices)
+		for (uint32_t i = 0; i < p_vertexCount; ++i)
 		{
+			const auto& vertex = p_vertices[i];
+
 			minX = std::min(minX, vertex.position[0]);
 			minY = std::min(minY, vertex.position[1]);
 			minZ = std::min(minZ, vertex.position[2]);
@@ -113,12 +152,14 @@ void OvRendering::Resources::Mesh::ComputeBoundingSphere(const std::vector<Geome
 			maxZ = std::max(maxZ, vertex.position[2]);
 		}
 
-		m_boundingSphere.position = OvMaths::FVector3{ minX + maxX, minY + maxY, minZ + maxZ } / 2.0f;
+		boundingSphere.position = OvMaths::FVector3{ minX + maxX, minY + maxY, minZ + maxZ } / 2.0f;
 
-		for (const auto& vertex : p_vertices)
+		for (uint32_t i = 0; i < p_vertexCount; ++i)
 		{
-			const auto& position = reinterpret_cast<const OvMaths::FVector3&>(vertex.position);
-			m_boundingSphere.radius = std::max(m_boundingSphere.radius, OvMaths::FVector3::Distance(m_boundingSphere.position, position));
+			const auto& position = reinterpret_cast<const OvMaths::FVector3&>(p_vertices[i].position);
+			boundingSphere.radius = std::max(boundingSphere.radius, OvMaths::FVector3::Distance(boundingSphere.position, position));
 		}
 	}
+
+	return boundingSphere;
 }
@@ -11,7 +11,7 @@
 
 #include "OvRendering/Resources/Parsers/AssimpParser.h"
 
-bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(const std::string & p_fileName, std::vector<Mesh*>& p_meshes, std::vector<std::string>& p_materials, EModelParserFlags p_parserFlags)
+bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(const std::string & p_fileName, std::vector<MeshData>& p_meshes, std::vector<std::string>& p_materials, EModelParserFlags p_parserFlags)
 {
 	Assimp::Importer import;
 	const aiScene* scene = import.ReadFile(p_fileName, static_cast<unsigned int>(p_parserFlags));
@@ -28,6 +28,19 @@ bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(const std::string
 	return true;
 }
 
+bool OvRendering::Resources::Parsers::AssimpParser::LoadModel(const std::string & p_fileName, std::vector<Mesh*>& p_meshes, std::vector<std::string>& p_materials, EModelParserFlags p_parserFlags)
+{
+	std::vector<MeshData> meshes;
+
+	if (!LoadModel(p_fileName, meshes, p_materials, p_parserFlags))
+		return false;
+
+	for (const auto& mesh : meshes)
+		p_meshes.push_back(new Mesh(mesh.vertices, mesh.indices, mesh.materialIndex)); // The model will handle mesh destruction
+
+	return true;
+}
+
 void OvRendering::Resources::Parsers::AssimpParser::ProcessMaterials(const aiScene * p_scene, std::vector<std::string>& p_materials)
 {
 	for (uint32_t i = 0; i < p_scene->mNumMaterials; ++i)
@@ -42,18 +55,17 @@ void OvRendering::Resources::Parsers::AssimpParser::ProcessMaterials(const aiSce
 	}
 }
 
-void OvRendering::Resources::Parsers::AssimpParser::ProcessNode(void* p_transform, aiNode * p_node, const aiScene * p_scene, std::vector<Mesh*>& p_meshes)
+void OvRendering::Resources::Parsers::AssimpParser::ProcessNode(void* p_transform, aiNode * p_node, const aiScene * p_scene, std::vector<MeshData>& p_meshes)
 {
 	aiMatrix4x4 nodeTransformation = *reinterpret_cast<aiMatrix4x4*>(p_transform) * p_node->mTransformation;
 
 	// Process all the node's meshes (if any)
 	for (uint32_t i = 0; i < p_node->mNumMeshes; ++i)
 	{
-		std::vector<Geometry::Vertex> vertices;
-		std::vector<uint32_t> indices;
 		aiMesh* mesh = p_scene->mMeshes[p_node->mMeshes[i]];
-		ProcessMesh(&nodeTransformation, mesh, p_scene, vertices, indices);
-		p_meshes.push_back(new Mesh(vertices, indices, mesh->mMaterialIndex)); // The model will handle mesh destruction
+		auto& meshData = p_meshes.emplace_back();
+		meshData.materialIndex = mesh->mMaterialIndex;
+		ProcessMesh(&nodeTransformation, mesh, p_scene, meshData.vertices, meshData.indices);
 	}
 
 	// Then do the same for each of its children
@@ -67,6 +79,9 @@ void OvRendering::Resources::Parsers::AssimpParser::ProcessMesh(void* p_transfor
 {
 	aiMatrix4x4 meshTransformation = *reinterpret_cast<aiMatrix4x4*>(p_transform);
 
+	p_outVertices.reserve(p_outVertices.size() + p_mesh->mNumVertices);
+	p_outIndices.reserve(p_outIndices.size() + p_mesh->mNumFaces * 3);
+
 	for (uint32_t i = 0; i < p_mesh->mNumVertices; ++i)
 	{
 		aiVector3D position		= meshTransformation * p_mesh->mVertices[i];
@@ -0,0 +1,444 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include <immintrin.h>
+
+#include "OvRendering/Resources/Parsers/BlockCompressor.h"
+
+namespace
+{
+	using OvRendering::Settings::ETextureCompression;
+
+	/* Below this amount of blocks per worker, starting a thread costs more than it saves */
+	constexpr size_t kMinBlocksPerWorker = 4096;
+
+	/* Texels of a 4x4 block, stored a channel after the other so 4 texels are processed at once */
+	struct Block
+	{
+		alignas(16) float channels[4][16];
+	};
+
+	uint32_t GetBlockSize(ETextureCompression p_compression)
+	{
+		return p_compression == ETextureCompression::BC1 ? 8 : 16;
+	}
+
+	Block FetchBlock(const uint8_t* p_pixels, uint32_t p_width, uint32_t p_height, uint32_t p_blockX, uint32_t p_blockY)
+	{
+		Block block;
+
+		for (uint32_t y = 0; y < 4; ++y)
+		{
+			for (uint32_t x = 0; x < 4; ++x)
+			{
+				const uint32_t pixelX = std::min(p_blockX * 4 + x, p_width - 1);
+				const uint32_t pixelY = std::min(p_blockY * 4 + y, p_height - 1);
+				const uint8_t* texel = p_pixels + (static_cast<size_t>(pixelY) * p_width + pixelX) * 4;
+
+				for (uint32_t channel = 0; channel < 4; ++channel)
+					block.channels[channel][y * 4 + x] = texel[channel];
+			}
+		}
+
+		return block;
+	}
+
+	/* Fit a segment on the texels of the block along their principal axis (Power iteration on the covariance matrix) */
+	void FitEndpoints(const Block& p_block, uint32_t p_channelCount, float (&p_start)[4], float (&p_end)[4])
+	{
+		float mean[4] = {};
+		float covariance[4][4] = {};
+
+		for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+		{
+			for (uint32_t i = 0; i < 16; ++i)
+				mean[channel] += p_block.channels[channel][i];
+
+			mean[channel] /= 16.0f;
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+			for (uint32_t a = 0; a < p_channelCount; ++a)
+				for (uint32_t b = 0; b < p_channelCount; ++b)
+					covariance[a][b] += (p_block.channels[a][i] - mean[a]) * (p_block.channels[b][i] - mean[b]);
+
+		/* Starting from the row of the channel with the largest variance avoids starting orthogonal to the axis */
+		uint32_t largest = 0;
+
+		for (uint32_t channel = 1; channel < p_channelCount; ++channel)
+			if (covariance[channel][channel] > covariance[largest][largest])
+				largest = channel;
+
+		float axis[4] = {};
+
+		for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+			axis[channel] = covariance[largest][channel];
+
+		for (uint32_t iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[4] = {};
+			float norm = 0.0f;
+
+			for (uint32_t a = 0; a < p_channelCount; ++a)
+			{
+				for (uint32_t b = 0; b < p_channelCount; ++b)
+					next[a] += covariance[a][b] * axis[b];
+
+				norm = std::max(norm, std::abs(next[a]));
+			}
+
+			if (norm == 0.0f)
+				break;
+
+			for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+				axis[channel] = next[channel] / norm;
+		}
+
+		float lengthSquared = 0.0f;
+
+		for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+			lengthSquared += axis[channel] * axis[channel];
+
+		float minProjection = 0.0f;
+		float maxProjection = 0.0f;
+
+		if (lengthSquared > 0.0f)
+		{
+			const float inverseLength = 1.0f / std::sqrt(lengthSquared);
+
+			for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+				axis[channel] *= inverseLength;
+
+			minProjection = std::numeric_limits<float>::max();
+			maxProjection = std::numeric_limits<float>::lowest();
+
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				float projection = 0.0f;
+
+				for (uint32_t channel = 0; channel < p_channelCount; ++channel)
+					projection += (p_block.channels[channel][i] - mean[channel]) * axis[channel];
+
+				minProjection = std::min(minProjection, projection);
+				maxProjection = std::max(maxProjection, projection);
+			}
+		}
+
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			p_start[channel] = std::clamp(mean[channel] + axis[channel] * minProjection, 0.0f, 255.0f);
+			p_end[channel] = std::clamp(mean[channel] + axis[channel] * maxProjection, 0.0f, 255.0f);
+		}
+	}
+
+	/* Assign each texel to the nearest of p_levels evenly spaced points of the segment (0 is the start), by projection */
+	void ProjectTexels(const Block& p_block, uint32_t p_firstChannel, uint32_t p_channelCount, const float (&p_start)[4], const float (&p_end)[4], uint32_t p_levels, uint8_t (&p_output)[16])
+	{
+		float direction[4] = {};
+		float lengthSquared = 0.0f;
+
+		for (uint32_t channel = p_firstChannel; channel < p_firstChannel + p_channelCount; ++channel)
+		{
+			direction[channel] = p_end[channel] - p_start[channel];
+			lengthSquared += direction[channel] * direction[channel];
+		}
+
+		if (lengthSquared == 0.0f)
+		{
+			std::fill(std::begin(p_output), std::end(p_output), static_cast<uint8_t>(0));
+			return;
+		}
+
+		const float scale = static_cast<float>(p_levels - 1) / lengthSquared;
+		const __m128 maxLevel = _mm_set1_ps(static_cast<float>(p_levels - 1));
+
+		for (uint32_t i = 0; i < 16; i += 4)
+		{
+			__m128 position = _mm_setzero_ps();
+
+			for (uint32_t channel = p_firstChannel; channel < p_firstChannel + p_channelCount; ++channel)
+			{
+				const __m128 offset = _mm_sub_ps(_mm_load_ps(&p_block.channels[channel][i]), _mm_set1_ps(p_start[channel]));
+				position = _mm_add_ps(position, _mm_mul_ps(offset, _mm_set1_ps(direction[channel] * scale)));
+			}
+
+			position = _mm_min_ps(_mm_max_ps(position, _mm_setzero_ps()), maxLevel);
+
+			alignas(16) int32_t levels[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(levels), _mm_cvtps_epi32(position));
+
+			for (uint32_t lane = 0; lane < 4; ++lane)
+				p_output[i + lane] = static_cast<uint8_t>(levels[lane]);
+		}
+	}
+
+	uint16_t ToRGB565(const float (&p_color)[4])
+	{
+		const uint32_t r = static_cast<uint32_t>(std::lround(p_color[0] * 31.0f / 255.0f));
+		const uint32_t g = static_cast<uint32_t>(std::lround(p_color[1] * 63.0f / 255.0f));
+		const uint32_t b = static_cast<uint32_t>(std::lround(p_color[2] * 31.0f / 255.0f));
+		return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+	}
+
+	void FromRGB565(uint16_t p_color, float (&p_output)[4])
+	{
+		const uint32_t r = (p_color >> 11) & 0x1F;
+		const uint32_t g = (p_color >> 5) & 0x3F;
+		const uint32_t b = p_color & 0x1F;
+
+		p_output[0] = static_cast<float>((r << 3) | (r >> 2));
+		p_output[1] = static_cast<float>((g << 2) | (g >> 4));
+		p_output[2] = static_cast<float>((b << 3) | (b >> 2));
+		p_output[3] = 0.0f;
+	}
+
+	void WriteLittleEndian(uint8_t* p_output, uint64_t p_value, uint32_t p_byteCount)
+	{
+		for (uint32_t i = 0; i < p_byteCount; ++i)
+			p_output[i] = static_cast<uint8_t>(p_value >> (i * 8));
+	}
+
+	/* BC1 block (Also the color part of BC3): two RGB565 endpoints and a 2 bits index per texel */
+	void EncodeColorBlock(const Block& p_block, uint8_t* p_output)
+	{
+		float start[4];
+		float end[4];
+		FitEndpoints(p_block, 3, start, end);
+
+		uint16_t color0 = ToRGB565(end);
+		uint16_t color1 = ToRGB565(start);
+
+		/* color0 > color1 selects the 4 colors mode */
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		uint32_t indices = 0;
+
+		if (color0 != color1)
+		{
+			float endpoint0[4];
+			float endpoint1[4];
+			FromRGB565(color0, endpoint0);
+			FromRGB565(color1, endpoint1);
+
+			uint8_t levels[16];
+			ProjectTexels(p_block, 0, 3, endpoint0, endpoint1, 4, levels);
+
+			/* Palette order is color0, color1, 2/3 color0 + 1/3 color1, 1/3 color0 + 2/3 color1 */
+			constexpr uint32_t kLevelToIndex[4] = { 0, 2, 3, 1 };
+
+			for (uint32_t i = 0; i < 16; ++i)
+				indices |= kLevelToIndex[levels[i]] << (i * 2);
+		}
+
+		WriteLittleEndian(p_output, color0, 2);
+		WriteLittleEndian(p_output + 2, color1, 2);
+		WriteLittleEndian(p_output + 4, indices, 4);
+	}
+
+	/* BC4 block (Alpha of BC3, each channel of BC5): two 8 bits endpoints and a 3 bits index per texel */
+	void EncodeChannelBlock(const Block& p_block, uint32_t p_channel, uint8_t* p_output)
+	{
+		const float* values = p_block.channels[p_channel];
+		const auto [minValue, maxValue] = std::minmax_element(values, values + 16);
+
+		float start[4] = {};
+		float end[4] = {};
+		start[p_channel] = *minValue;
+		end[p_channel] = *maxValue;
+
+		uint64_t indices = 0;
+
+		if (*maxValue > *minValue)
+		{
+			uint8_t levels[16];
+			ProjectTexels(p_block, p_channel, 1, start, end, 8, levels);
+
+			/* With alpha0 > alpha1, the palette is alpha0 (The maximum), alpha1 (The minimum), then 6 steps from alpha0 to alpha1 */
+			for (uint32_t i = 0; i < 16; ++i)
+			{
+				const uint64_t index = levels[i] == 7 ? 0 : levels[i] == 0 ? 1 : 8 - levels[i];
+				indices |= index << (i * 3);
+			}
+		}
+
+		p_output[0] = static_cast<uint8_t>(*maxValue);
+		p_output[1] = static_cast<uint8_t>(*minValue);
+		WriteLittleEndian(p_output + 2, indices, 6);
+	}
+
+	/* BC7 block in mode 6: a single RGBA segment, 7 bits endpoints with a p-bit each and a 4 bits index per texel */
+	void EncodeBC7Block(const Block& p_block, uint8_t* p_output)
+	{
+		float endpoints[2][4];
+		FitEndpoints(p_block, 4, endpoints[0], endpoints[1]);
+
+		uint32_t quantized[2][4];
+		uint32_t pBits[2];
+
+		/* Each endpoint keeps the p-bit (Shared by its 4 channels) giving the lowest quantization error */
+		for (uint32_t endpoint = 0; endpoint < 2; ++endpoint)
+		{
+			float bestError = std::numeric_limits<float>::max();
+
+			for (uint32_t pBit = 0; pBit < 2; ++pBit)
+			{
+				uint32_t candidate[4];
+				float error = 0.0f;
+
+				for (uint32_t channel = 0; channel < 4; ++channel)
+				{
+					const float value = endpoints[endpoint][channel];
+					candidate[channel] = static_cast<uint32_t>(std::clamp<long>(std::lround((value - pBit) / 2.0f), 0, 127));
+
+					const float difference = static_cast<float>((candidate[channel] << 1) | pBit) - value;
+					error += difference * difference;
+				}
+
+				if (error < bestError)
+				{
+					bestError = error;
+					pBits[endpoint] = pBit;
+					std::copy(std::begin(candidate), std::end(candidate), quantized[endpoint]);
+				}
+			}
+
+			for (uint32_t channel = 0; channel < 4; ++channel)
+				endpoints[endpoint][channel] = static_cast<float>((quantized[endpoint][channel] << 1) | pBits[endpoint]);
+		}
+
+		uint8_t levels[16];
+		ProjectTexels(p_block, 0, 4, endpoints[0], endpoints[1], 16, levels);
+
+		/* The index of the first texel is stored without its most significant bit, which swapping the endpoints clears */
+		if (levels[0] >= 8)
+		{
+			std::swap(quantized[0], quantized[1]);
+			std::swap(pBits[0], pBits[1]);
+
+			for (auto& level : levels)
+				level = 15 - level;
+		}
+
+		uint64_t bits[2] = {};
+		uint32_t position = 0;
+
+		const auto write = [&bits, &position](uint64_t p_value, uint32_t p_bitCount)
+		{
+			for (uint32_t bit = 0; bit < p_bitCount; ++bit, ++position)
+				bits[position / 64] |= ((p_value >> bit) & 1) << (position % 64);
+		};
+
+		write(1 << 6, 7);
+
+		for (uint32_t channel = 0; channel < 4; ++channel)
+		{
+			write(quantized[0][channel], 7);
+			write(quantized[1][channel], 7);
+		}
+
+		write(pBits[0], 1);
+		write(pBits[1], 1);
+		write(levels[0], 3);
+
+		for (uint32_t i = 1; i < 16; ++i)
+			write(levels[i], 4);
+
+		WriteLittleEndian(p_output, bits[0], 8);
+		WriteLittleEndian(p_output + 8, bits[1], 8);
+	}
+
+	void EncodeBlock(ETextureCompression p_compression, const Block& p_block, uint8_t* p_output)
+	{
+		switch (p_compression)
+		{
+		case ETextureCompression::BC1:
+			EncodeColorBlock(p_block, p_output);
+			break;
+
+		case ETextureCompression::BC3:
+			EncodeChannelBlock(p_block, 3, p_output);
+			EncodeColorBlock(p_block, p_output + 8);
+			break;
+
+		case ETextureCompression::BC5:
+			EncodeChannelBlock(p_block, 0, p_output);
+			EncodeChannelBlock(p_block, 1, p_output + 8);
+			break;
+
+		case ETextureCompression::BC7:
+			EncodeBC7Block(p_block, p_output);
+			break;
+
+		default:
+			break;
+		}
+	}
+}
+
+bool OvRendering::Resources::Parsers::BlockCompressor::IsOpaque(const uint8_t* p_pixels, size_t p_texelCount)
+{
+	for (size_t i = 0; i < p_texelCount; ++i)
+	{
+		if (p_pixels[i * 4 + 3] != 0xFF)
+			return false;
+	}
+
+	return true;
+}
+
+size_t OvRendering::Resources::Parsers::BlockCompressor::GetCompressedSize(Settings::ETextureCompression p_compression, uint32_t p_width, uint32_t p_height)
+{
+	if (p_compression == Settings::ETextureCompression::NONE)
+		return static_cast<size_t>(p_width) * p_height * 4;
+
+	return static_cast<size_t>((p_width + 3) / 4) * ((p_height + 3) / 4) * GetBlockSize(p_compression);
+}
+
+std::vector<uint8_t> OvRendering::Resources::Parsers::BlockCompressor::Compress(Settings::ETextureCompression p_compression, const uint8_t* p_pixels, uint32_t p_width, uint32_t p_height)
+{
+	if (p_compression == Settings::ETextureCompression::NONE)
+		return std::vector<uint8_t>(p_pixels, p_pixels + GetCompressedSize(p_compression, p_width, p_height));
+
+	std::vector<uint8_t> result(GetCompressedSize(p_compression, p_width, p_height));
+
+	const uint32_t blocksX = (p_width + 3) / 4;
+	const uint32_t blocksY = (p_height + 3) / 4;
+	const uint32_t blockSize = GetBlockSize(p_compression);
+
+	const auto encodeRows = [&](uint32_t p_firstRow, uint32_t p_lastRow)
+	{
+		for (uint32_t blockY = p_firstRow; blockY < p_lastRow; ++blockY)
+			for (uint32_t blockX = 0; blockX < blocksX; ++blockX)
+				EncodeBlock(p_compression, FetchBlock(p_pixels, p_width, p_height, blockX, blockY), result.data() + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize);
+	};
+
+	const size_t maxWorkerCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	const size_t workerCount = std::clamp<size_t>(static_cast<size_t>(blocksX) * blocksY / kMinBlocksPerWorker, 1, std::min<size_t>(maxWorkerCount, blocksY));
+
+	/* Each worker encodes a contiguous range of block rows, the calling thread takes the first one */
+	const uint32_t rowsPerWorker = static_cast<uint32_t>((blocksY + workerCount - 1) / workerCount);
+	const auto rangeStart = [&](size_t p_worker) { return std::min(static_cast<uint32_t>(p_worker) * rowsPerWorker, blocksY); };
+
+	std::vector<std::future<void>> workers;
+	workers.reserve(workerCount - 1);
+
+	for (size_t worker = 1; worker < workerCount; ++worker)
+		workers.push_back(std::async(std::launch::async, encodeRows, rangeStart(worker), rangeStart(worker + 1)));
+
+	encodeRows(0, rangeStart(1));
+
+	for (auto& worker : workers)
+		worker.wait();
+
+	return result;
+}
\ No newline at end of file
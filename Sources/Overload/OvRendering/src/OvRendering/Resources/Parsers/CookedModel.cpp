@@ -0,0 +1,244 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+
+#include "OvRendering/Resources/Parsers/CookedModel.h"
+
+namespace
+{
+	using namespace OvRendering::Resources::Parsers;
+
+	constexpr char		SIGNATURE[4]	= { 'O', 'V', 'M', 'H' };
+	constexpr uint64_t	BLOB_ALIGNMENT	= 16;
+
+	struct Header
+	{
+		char		signature[4];
+		uint32_t	version;
+		uint64_t	sourceKey;
+		uint32_t	meshCount;
+		uint32_t	materialCount;
+		uint64_t	materialsOffset;
+	};
+
+	template<typename T>
+	void Append(std::vector<char>& p_buffer, const T* p_values, size_t p_count)
+	{
+		const char* bytes = reinterpret_cast<const char*>(p_values);
+		p_buffer.insert(p_buffer.end(), bytes, bytes + p_count * sizeof(T));
+	}
+
+	void Align(std::vector<char>& p_buffer)
+	{
+		p_buffer.resize((p_buffer.size() + BLOB_ALIGNMENT - 1) / BLOB_ALIGNMENT * BLOB_ALIGNMENT, 0);
+	}
+
+	bool IsInRange(uint64_t p_offset, uint64_t p_size, size_t p_dataSize)
+	{
+		return p_offset <= p_dataSize && p_size <= p_dataSize - p_offset;
+	}
+
+	template<typename T>
+	bool AreIndicesInRange(const char* p_indices, uint32_t p_indexCount, uint32_t p_vertexCount)
+	{
+		const T* indices = reinterpret_cast<const T*>(p_indices);
+
+		for (uint32_t i = 0; i < p_indexCount; ++i)
+		{
+			if (indices[i] >= p_vertexCount)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+OvRendering::Resources::Parsers::CookedModel::CookedModel(const char* p_data, size_t p_size) :
+	m_data(p_data),
+	m_size(p_size)
+{
+	m_valid = Validate();
+}
+
+bool OvRendering::Resources::Parsers::CookedModel::IsValid() const
+{
+	return m_valid;
+}
+
+uint64_t OvRendering::Resources::Parsers::CookedModel::GetSourceKey() const
+{
+	return m_sourceKey;
+}
+
+uint32_t OvRendering::Resources::Parsers::CookedModel::GetMeshCount() const
+{
+	return m_meshCount;
+}
+
+const OvRendering::Resources::Parsers::CookedModel::MeshRecord& OvRendering::Resources::Parsers::CookedModel::GetMesh(uint32_t p_index) const
+{
+	return m_meshes[p_index];
+}
+
+const void* OvRendering::Resources::Parsers::CookedModel::GetVertices(uint32_t p_index) const
+{
+	return m_data + m_meshes[p_index].verticesOffset;
+}
+
+const void* OvRendering::Resources::Parsers::CookedModel::GetIndices(uint32_t p_index) const
+{
+	return m_data + m_meshes[p_index].indicesOffset;
+}
+
+OvRendering::Geometry::EVertexFormat OvRendering::Resources::Parsers::CookedModel::GetVertexFormat(uint32_t p_index) const
+{
+	return static_cast<Geometry::EVertexFormat>(m_meshes[p_index].vertexFormat);
+}
+
+OvRendering::Buffers::EType OvRendering::Resources::Parsers::CookedModel::GetIndexType(uint32_t p_index) const
+{
+	return static_cast<Buffers::EType>(m_meshes[p_index].indexType);
+}
+
+OvRendering::Geometry::BoundingSphere OvRendering::Resources::Parsers::CookedModel::GetBoundingSphere(uint32_t p_index) const
+{
+	const float* sphere = m_meshes[p_index].boundingSphere;
+	return { { sphere[0], sphere[1], sphere[2] }, sphere[3] };
+}
+
+const std::vector<std::string>& OvRendering::Resources::Parsers::CookedModel::GetMaterialNames() const
+{
+	return m_materialNames;
+}
+
+std::vector<char> OvRendering::Resources::Parsers::CookedModel::Cook(const std::vector<Geometry::PackedMesh>& p_meshes, const std::vector<std::string>& p_materialNames, uint64_t p_sourceKey)
+{
+	std::vector<char> result;
+
+	Header header{};
+	std::memcpy(header.signature, SIGNATURE, sizeof(SIGNATURE));
+	header.version = VERSION;
+	header.sourceKey = p_sourceKey;
+	header.meshCount = static_cast<uint32_t>(p_meshes.size());
+	header.materialCount = static_cast<uint32_t>(p_materialNames.size());
+	header.materialsOffset = sizeof(Header) + sizeof(MeshRecord) * p_meshes.size();
+
+	/* The header and mesh records are patched once the offsets of the blobs are known */
+	result.resize(header.materialsOffset);
+
+	for (const auto& name : p_materialNames)
+	{
+		const uint32_t length = static_cast<uint32_t>(name.size());
+		Append(result, &length, 1);
+		Append(result, name.data(), name.size());
+	}
+
+	std::vector<MeshRecord> records(p_meshes.size());
+
+	for (size_t i = 0; i < p_meshes.size(); ++i)
+	{
+		const auto& mesh = p_meshes[i];
+		auto& record = records[i];
+
+		record = {};
+		record.materialIndex = mesh.materialIndex;
+		record.vertexCount = mesh.vertexCount;
+		record.indexCount = mesh.indexCount;
+		record.vertexFormat = static_cast<uint16_t>(mesh.vertexFormat);
+		record.indexType = static_cast<uint16_t>(mesh.indexType);
+		record.boundingSphere[0] = mesh.boundingSphere.position.x;
+		record.boundingSphere[1] = mesh.boundingSphere.position.y;
+		record.boundingSphere[2] = mesh.boundingSphere.position.z;
+		record.boundingSphere[3] = mesh.boundingSphere.radius;
+
+		Align(result);
+		record.verticesOffset = result.size();
+		Append(result, mesh.vertices.data(), mesh.vertices.size());
+
+		Align(result);
+		record.indicesOffset = result.size();
+		Append(result, mesh.indices.data(), mesh.indices.size());
+	}
+
+	std::memcpy(result.data(), &header, sizeof(Header));
+	std::memcpy(result.data() + sizeof(Header), records.data(), records.size() * sizeof(MeshRecord));
+
+	return result;
+}
+
+bool OvRendering::Resources::Parsers::CookedModel::Validate()
+{
+	if (!m_data || m_size < sizeof(Header))
+		return false;
+
+	Header header;
+	std::memcpy(&header, m_data, sizeof(Header));
+
+	if (std::memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE)) != 0 || header.version != VERSION)
+		return false;
+
+	if (!IsInRange(sizeof(Header), static_cast<uint64_t>(header.meshCount) * sizeof(MeshRecord), m_size))
+		return false;
+
+	m_sourceKey = header.sourceKey;
+	m_meshCount = header.meshCount;
+	m_meshes = reinterpret_cast<const MeshRecord*>(m_data + sizeof(Header));
+
+	for (uint32_t i = 0; i < m_meshCount; ++i)
+	{
+		const auto& mesh = m_meshes[i];
+
+		if (mesh.vertexFormat != static_cast<uint16_t>(Geometry::EVertexFormat::STANDARD) && mesh.vertexFormat != static_cast<uint16_t>(Geometry::EVertexFormat::COMPRESSED))
+			return false;
+
+		const uint64_t vertexSize = Geometry::VertexFormat::GetVertexSize(GetVertexFormat(i));
+		const uint64_t indexSize = Geometry::VertexFormat::GetIndexSize(GetIndexType(i));
+
+		if (indexSize == 0)
+			return false;
+
+		if (mesh.verticesOffset % alignof(float) != 0 || mesh.indicesOffset % indexSize != 0)
+			return false;
+
+		if (!IsInRange(mesh.verticesOffset, static_cast<uint64_t>(mesh.vertexCount) * vertexSize, m_size) ||
+			!IsInRange(mesh.indicesOffset, static_cast<uint64_t>(mesh.indexCount) * indexSize, m_size))
+			return false;
+
+		/* Drivers aren't required to survive out of range indices, so a corrupted file is rejected here */
+		const char* indices = m_data + mesh.indicesOffset;
+
+		if (indexSize == sizeof(uint16_t) ? !AreIndicesInRange<uint16_t>(indices, mesh.indexCount, mesh.vertexCount) : !AreIndicesInRange<uint32_t>(indices, mesh.indexCount, mesh.vertexCount))
+			return false;
+	}
+
+	uint64_t offset = header.materialsOffset;
+
+	/* Each name takes at least its length prefix, which bounds the count before anything is allocated */
+	if (!IsInRange(offset, static_cast<uint64_t>(header.materialCount) * sizeof(uint32_t), m_size))
+		return false;
+
+	m_materialNames.reserve(header.materialCount);
+
+	for (uint32_t i = 0; i < header.materialCount; ++i)
+	{
+		uint32_t length;
+
+		if (!IsInRange(offset, sizeof(uint32_t), m_size))
+			return false;
+
+		std::memcpy(&length, m_data + offset, sizeof(uint32_t));
+		offset += sizeof(uint32_t);
+
+		if (!IsInRange(offset, length, m_size))
+			return false;
+
+		m_materialNames.emplace_back(m_data + offset, length);
+		offset += length;
+	}
+
+	return true;
+}
\ No newline at end of file
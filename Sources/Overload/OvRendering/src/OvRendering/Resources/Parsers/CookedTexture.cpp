@@ -0,0 +1,216 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include <cstring>
+#include <algorithm>
+
+#include "OvRendering/Resources/Parsers/CookedTexture.h"
+#include "OvRendering/Resources/Parsers/BlockCompressor.h"
+
+namespace
+{
+	using OvRendering::Settings::ETextureCompression;
+
+	constexpr char		SIGNATURE[4]	= { 'O', 'V', 'T', 'X' };
+	constexpr uint64_t	DATA_ALIGNMENT	= 16;
+	constexpr uint32_t	MAX_MIP_COUNT	= 32;
+	constexpr uint32_t	MAX_SIZE		= 65536;
+
+	struct Header
+	{
+		char		signature[4];
+		uint32_t	version;
+		uint64_t	sourceKey;
+		uint32_t	compression;
+		uint32_t	bitsPerPixel;
+		uint32_t	mipCount;
+		uint32_t	reserved;
+	};
+
+	bool IsInRange(uint64_t p_offset, uint64_t p_size, size_t p_dataSize)
+	{
+		return p_offset <= p_dataSize && p_size <= p_dataSize - p_offset;
+	}
+
+	/* Half size level with a 2x2 box filter. Odd sizes repeat their last row or column */
+	std::vector<uint8_t> Downsample(const std::vector<uint8_t>& p_pixels, uint32_t p_width, uint32_t p_height)
+	{
+		const uint32_t width = std::max(p_width / 2, 1u);
+		const uint32_t height = std::max(p_height / 2, 1u);
+
+		std::vector<uint8_t> result(static_cast<size_t>(width) * height * 4);
+
+		for (uint32_t y = 0; y < height; ++y)
+		{
+			const uint32_t y0 = std::min(y * 2, p_height - 1);
+			const uint32_t y1 = std::min(y * 2 + 1, p_height - 1);
+
+			for (uint32_t x = 0; x < width; ++x)
+			{
+				const uint32_t x0 = std::min(x * 2, p_width - 1);
+				const uint32_t x1 = std::min(x * 2 + 1, p_width - 1);
+
+				const auto texel = [&](uint32_t p_x, uint32_t p_y) { return p_pixels.data() + (static_cast<size_t>(p_y) * p_width + p_x) * 4; };
+				uint8_t* output = result.data() + (static_cast<size_t>(y) * width + x) * 4;
+
+				for (uint32_t channel = 0; channel < 4; ++channel)
+					output[channel] = static_cast<uint8_t>((texel(x0, y0)[channel] + texel(x1, y0)[channel] + texel(x0, y1)[channel] + texel(x1, y1)[channel] + 2) / 4);
+			}
+		}
+
+		return result;
+	}
+
+	bool IsSupportedCompression(uint32_t p_compression)
+	{
+		switch (static_cast<ETextureCompression>(p_compression))
+		{
+		case ETextureCompression::NONE:
+		case ETextureCompression::BC1:
+		case ETextureCompression::BC3:
+		case ETextureCompression::BC5:
+		case ETextureCompression::BC7:
+			return true;
+
+		default:
+			return false;
+		}
+	}
+}
+
+OvRendering::Resources::Parsers::CookedTexture::CookedTexture(const char* p_data, size_t p_size) :
+	m_data(p_data),
+	m_size(p_size)
+{
+	m_valid = Validate();
+}
+
+bool OvRendering::Resources::Parsers::CookedTexture::IsValid() const
+{
+	return m_valid;
+}
+
+uint64_t OvRendering::Resources::Parsers::CookedTexture::GetSourceKey() const
+{
+	return m_sourceKey;
+}
+
+OvRendering::Settings::ETextureCompression OvRendering::Resources::Parsers::CookedTexture::GetCompression() const
+{
+	return m_compression;
+}
+
+uint32_t OvRendering::Resources::Parsers::CookedTexture::GetBitsPerPixel() const
+{
+	return m_bitsPerPixel;
+}
+
+uint32_t OvRendering::Resources::Parsers::CookedTexture::GetMipCount() const
+{
+	return m_mipCount;
+}
+
+const OvRendering::Resources::Parsers::CookedTexture::MipRecord& OvRendering::Resources::Parsers::CookedTexture::GetMip(uint32_t p_level) const
+{
+	return m_mips[p_level];
+}
+
+const void* OvRendering::Resources::Parsers::CookedTexture::GetMipData(uint32_t p_level) const
+{
+	return m_data + m_mips[p_level].offset;
+}
+
+std::vector<char> OvRendering::Resources::Parsers::CookedTexture::Cook(const uint8_t* p_pixels, uint32_t p_width, uint32_t p_height, uint32_t p_bitsPerPixel, Settings::ETextureCompression p_compression, bool p_generateMipmap, uint64_t p_sourceKey)
+{
+	if (p_compression == Settings::ETextureCompression::AUTO)
+		p_compression = BlockCompressor::IsOpaque(p_pixels, static_cast<size_t>(p_width) * p_height) ? Settings::ETextureCompression::BC1 : Settings::ETextureCompression::BC3;
+
+	uint32_t mipCount = 1;
+
+	if (p_generateMipmap)
+	{
+		for (uint32_t size = std::max(p_width, p_height); size > 1; size /= 2)
+			++mipCount;
+	}
+
+	Header header{};
+	std::memcpy(header.signature, SIGNATURE, sizeof(SIGNATURE));
+	header.version = VERSION;
+	header.sourceKey = p_sourceKey;
+	header.compression = static_cast<uint32_t>(p_compression);
+	header.bitsPerPixel = p_bitsPerPixel;
+	header.mipCount = mipCount;
+
+	std::vector<char> result(sizeof(Header) + sizeof(MipRecord) * mipCount);
+	std::vector<MipRecord> records(mipCount);
+
+	std::vector<uint8_t> level(p_pixels, p_pixels + static_cast<size_t>(p_width) * p_height * 4);
+	uint32_t width = p_width;
+	uint32_t height = p_height;
+
+	/* Each level is filtered from the previous uncompressed one, so compression errors don't accumulate */
+	for (uint32_t mip = 0; mip < mipCount; ++mip)
+	{
+		if (mip > 0)
+		{
+			level = Downsample(level, width, height);
+			width = std::max(width / 2, 1u);
+			height = std::max(height / 2, 1u);
+		}
+
+		const std::vector<uint8_t> compressed = BlockCompressor::Compress(p_compression, level.data(), width, height);
+
+		result.resize((result.size() + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT, 0);
+		records[mip] = { width, height, result.size(), compressed.size() };
+		result.insert(result.end(), compressed.begin(), compressed.end());
+	}
+
+	std::memcpy(result.data(), &header, sizeof(Header));
+	std::memcpy(result.data() + sizeof(Header), records.data(), records.size() * sizeof(MipRecord));
+
+	return result;
+}
+
+bool OvRendering::Resources::Parsers::CookedTexture::Validate()
+{
+	if (!m_data || m_size < sizeof(Header))
+		return false;
+
+	Header header;
+	std::memcpy(&header, m_data, sizeof(Header));
+
+	if (std::memcmp(header.signature, SIGNATURE, sizeof(SIGNATURE)) != 0 || header.version != VERSION)
+		return false;
+
+	if (!IsSupportedCompression(header.compression) || header.mipCount == 0 || header.mipCount > MAX_MIP_COUNT)
+		return false;
+
+	if (!IsInRange(sizeof(Header), static_cast<uint64_t>(header.mipCount) * sizeof(MipRecord), m_size))
+		return false;
+
+	m_sourceKey = header.sourceKey;
+	m_compression = static_cast<Settings::ETextureCompression>(header.compression);
+	m_bitsPerPixel = header.bitsPerPixel;
+	m_mipCount = header.mipCount;
+	m_mips = reinterpret_cast<const MipRecord*>(m_data + sizeof(Header));
+
+	/* Each level must be half the size of the previous one, and hold exactly the data its size requires */
+	for (uint32_t mip = 0; mip < m_mipCount; ++mip)
+	{
+		const auto& record = m_mips[mip];
+
+		if (record.width == 0 || record.height == 0 || record.width > MAX_SIZE || record.height > MAX_SIZE)
+			return false;
+
+		if (mip > 0 && (record.width != std::max(m_mips[mip - 1].width / 2, 1u) || record.height != std::max(m_mips[mip - 1].height / 2, 1u)))
+			return false;
+
+		if (record.size != BlockCompressor::GetCompressedSize(m_compression, record.width, record.height) || !IsInRange(record.offset, record.size, m_size))
+			return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -103,6 +103,16 @@ OvMaths::FMatrix4 OvRendering::Resources::Shader::GetUniformMat4(const std::stri
 	return reinterpret_cast<OvMaths::FMatrix4&>(values);
 }
 
+bool OvRendering::Resources::Shader::SupportsInstancing() const
+{
+	return m_instancedUniformLocation != -1;
+}
+
+void OvRendering::Resources::Shader::SetInstanced(bool p_instanced)
+{
+	glUniform1i(m_instancedUniformLocation, p_instanced);
+}
+
 bool OvRendering::Resources::Shader::IsEngineUBOMember(const std::string & p_uniformName)
 {
 	return p_uniformName.rfind("ubo_", 0) == 0;
@@ -127,6 +137,7 @@ void OvRendering::Resources::Shader::QueryUniforms()
 {
 	GLint numActiveUniforms = 0;
 	uniforms.clear();
+	m_instancedUniformLocation = glGetUniformLocation(id, INSTANCED_UNIFORM);
 	glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &numActiveUniforms);
 	std::vector<GLchar> nameData(256);
 	for (int unif = 0; unif < numActiveUniforms; ++unif)
@@ -137,7 +148,7 @@ void OvRendering::Resources::Shader::QueryUniforms()
 		glGetActiveUniform(id, unif, static_cast<GLsizei>(nameData.size()), &actualLength, &arraySize, &type, &nameData[0]);
 		std::string name(static_cast<char*>(nameData.data()), actualLength);
 
-		if (!IsEngineUBOMember(name))
+		if (!IsEngineUBOMember(name) && name != INSTANCED_UNIFORM)
 		{
 			std::any defaultValue;
 
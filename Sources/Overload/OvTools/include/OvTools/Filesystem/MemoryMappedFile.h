@@ -0,0 +1,59 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#pragma once
+
+#include <string>
+
+
+namespace OvTools::Filesystem
+{
+	/**
+	* Read-only view of a file mapped in memory. Pages are loaded by the system on first access,
+	* so the content can be read in place without copying the file into a buffer
+	*/
+	class MemoryMappedFile final
+	{
+	public:
+		/**
+		* Map the given file in memory (Check IsOpen() to know if the mapping succeeded)
+		* @param p_filePath
+		*/
+		MemoryMappedFile(const std::string& p_filePath);
+
+		/**
+		* Unmap the file
+		*/
+		~MemoryMappedFile();
+
+		MemoryMappedFile(const MemoryMappedFile&) = delete;
+		MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+		/**
+		* Returns true if the file has been mapped (Empty files can't be mapped)
+		*/
+		bool IsOpen() const;
+
+		/**
+		* Returns the mapped content of the file
+		*/
+		const char* GetData() const;
+
+		/**
+		* Returns the size of the file in bytes
+		*/
+		size_t GetSize() const;
+
+	private:
+		void Close();
+
+	private:
+		void*		m_file		= nullptr;
+		void*		m_mapping	= nullptr;
+		const char*	m_data		= nullptr;
+		size_t		m_size		= 0;
+	};
+}
\ No newline at end of file
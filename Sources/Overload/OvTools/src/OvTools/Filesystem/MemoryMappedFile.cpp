@@ -0,0 +1,73 @@
+/**
+* @project: Overload
+* @author: Overload Tech.
+* @licence: MIT
+*/
+
+#include "OvTools/Filesystem/MemoryMappedFile.h"
+
+#include <Windows.h>
+
+OvTools::Filesystem::MemoryMappedFile::MemoryMappedFile(const std::string& p_filePath)
+{
+	HANDLE file = CreateFileA(p_filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return;
+
+	m_file = file;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+	{
+		Close();
+		return;
+	}
+
+	m_mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+	if (m_mapping)
+		m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+
+	if (m_data)
+		m_size = static_cast<size_t>(size.QuadPart);
+	else
+		Close();
+}
+
+OvTools::Filesystem::MemoryMappedFile::~MemoryMappedFile()
+{
+	Close();
+}
+
+bool OvTools::Filesystem::MemoryMappedFile::IsOpen() const
+{
+	return m_data != nullptr;
+}
+
+const char* OvTools::Filesystem::MemoryMappedFile::GetData() const
+{
+	return m_data;
+}
+
+size_t OvTools::Filesystem::MemoryMappedFile::GetSize() const
+{
+	return m_size;
+}
+
+void OvTools::Filesystem::MemoryMappedFile::Close()
+{
+	if (m_data)
+		UnmapViewOfFile(m_data);
+
+	if (m_mapping)
+		CloseHandle(m_mapping);
+
+	if (m_file)
+		CloseHandle(m_file);
+
+	m_data = nullptr;
+	m_mapping = nullptr;
+	m_file = nullptr;
+	m_size = 0;
+}
\ No newline at end of file
@@ -8,6 +8,8 @@
 
 #include <unordered_map>
 
+/* The windowing doesn't use OpenGL itself, GLFW mustn't include gl.h before the renderer includes GLEW */
+#define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
 #include <OvTools/Eventing/Event.h>
@@ -8,6 +8,8 @@
 
 #include <string>
 
+/* The windowing doesn't use OpenGL itself, GLFW mustn't include gl.h before the renderer includes GLEW */
+#define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
 #include "OvWindowing/Context/Device.h"
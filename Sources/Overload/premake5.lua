@@ -19,4 +19,5 @@ include "OvUI"
 include "OvWindowing"
 
 include "OvEditor"
-include "OvGame"
\ No newline at end of file
+include "OvGame"
+include "OvBenchmark"
\ No newline at end of file